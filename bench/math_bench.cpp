@@ -0,0 +1,439 @@
+/**
+ * @file math_bench.cpp
+ * @brief Banco de pruebas de rendimiento de MathLib con salida JSON
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Mide suma, producto, transposición, producto por lotes y producto
+ * disperso por denso para tamaños de --min-size a --max-size (potencias
+ * de dos), con los tipos y números de hilos pedidos. Cada caso se repite
+ * hasta acumular --min-time segundos y se informa el tiempo medio por
+ * iteración junto con GFLOP/s y GB/s (bytes que como mínimo hay que leer
+ * y escribir en memoria).
+ *
+ * El resultado se escribe en JSON (una medida por línea) en la salida
+ * estándar o en --out; el resumen legible va a la salida de errores. Con
+ * --baseline se compara contra un JSON anterior y el programa termina con
+ * código 1 si algún caso es más lento que la referencia en más de
+ * --tolerance (fracción, 0.10 por defecto).
+ *
+ * @code
+ * math_bench --out=antes.json
+ * ... cambio ...
+ * math_bench --baseline=antes.json --out=despues.json
+ * math_bench --filter=multiply --types=float --threads=1,8 --max-size=8192
+ * @endcode
+ */
+
+#include "Matrix.h"
+#include "Batched.h"
+#include "Kernels.h"
+#include "SparseMatrix.h"
+#include "ThreadPool.h"
+#include "Transpose.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Opciones de la línea de órdenes
+ */
+struct BenchConfig {
+    std::string filter;          ///< Solo los casos cuyo nombre contiene este texto
+    int min_size;                ///< Tamaño mínimo (potencia de dos)
+    int max_size;                ///< Tamaño máximo
+    double min_time;             ///< Segundos mínimos medidos por caso
+    std::vector<int> threads;    ///< Números de hilos a probar
+    std::vector<std::string> types;  ///< Tipos de elemento a probar
+    std::string out;             ///< Fichero JSON de salida (vacío: salida estándar)
+    std::string baseline;        ///< JSON de referencia para detectar regresiones
+    double tolerance;            ///< Pérdida relativa admitida frente a la referencia
+};
+
+/**
+ * @brief Resultado de un caso
+ */
+struct BenchResult {
+    std::string name;     ///< operación/tipo/tamaño/hilos, único por caso
+    std::string op;       ///< Operación medida
+    std::string type;     ///< Tipo de elemento
+    int size;             ///< Dimensión característica
+    int threads;          ///< Hilos del grupo global
+    long iterations;      ///< Iteraciones medidas
+    double seconds;       ///< Tiempo medio por iteración
+    double flops;         ///< Operaciones en coma flotante por iteración
+    double bytes;         ///< Bytes mínimos de tráfico con memoria por iteración
+};
+
+std::vector<int> parseInts(const std::string& text) {
+    std::vector<int> values;
+    std::stringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(std::atoi(item.c_str()));
+        }
+    }
+    return values;
+}
+
+std::vector<std::string> parseList(const std::string& text) {
+    std::vector<std::string> values;
+    std::stringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(item);
+        }
+    }
+    return values;
+}
+
+bool readOption(const char* arg, const char* name, std::string& value) {
+    const std::size_t len = std::strlen(name);
+    if (std::strncmp(arg, name, len) == 0 && arg[len] == '=') {
+        value = arg + len + 1;
+        return true;
+    }
+    return false;
+}
+
+void usage() {
+    std::cerr << "Uso: math_bench [--filter=texto] [--min-size=4] [--max-size=2048]\n"
+                 "                  [--min-time=0.2] [--threads=1,N] [--types=float,double]\n"
+                 "                  [--out=fichero.json] [--baseline=fichero.json] [--tolerance=0.10]\n";
+}
+
+/**
+ * @brief Repite f hasta acumular min_time segundos
+ *
+ * La primera llamada no se mide (calienta cachés y el grupo de hilos).
+ * El número de iteraciones se duplica en cada ronda para que el coste
+ * de leer el reloj no influya en casos muy cortos.
+ */
+double timeIt(const std::function<void()>& f, double min_time, long& iterations) {
+    typedef std::chrono::steady_clock Clock;
+    f();
+    long batch = 1;
+    long total = 0;
+    double elapsed = 0.0;
+    while (elapsed < min_time) {
+        Clock::time_point t0 = Clock::now();
+        for (long i = 0; i < batch; ++i) {
+            f();
+        }
+        elapsed += std::chrono::duration<double>(Clock::now() - t0).count();
+        total += batch;
+        batch *= 2;
+    }
+    iterations = total;
+    return elapsed / total;
+}
+
+template <class T>
+BasicMatrix<T> randomMatrix(int rows, int cols) {
+    BasicMatrix<T> m(rows, cols, BasicMatrix<T>::UNINITIALIZED);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            m(i, j) = static_cast<T>(std::rand() % 1000) / static_cast<T>(1000);
+        }
+    }
+    return m;
+}
+
+template <class T>
+const char* typeName();
+
+template <>
+const char* typeName<float>() { return "float"; }
+
+template <>
+const char* typeName<double>() { return "double"; }
+
+/**
+ * @brief Ejecuta los casos de un tipo de elemento con el grupo actual
+ */
+template <class T>
+class Runner {
+public:
+    Runner(const BenchConfig& config, int threads, std::vector<BenchResult>& results)
+        : config(config), threads(threads), results(results),
+          policy(threads > 1 ? mathlib::PARALLEL : mathlib::SEQUENTIAL) {}
+
+    void run() {
+        for (int n = config.min_size; n <= config.max_size; n *= 2) {
+            // Las operaciones sin versión paralela solo se miden con un hilo
+            if (threads == 1) {
+                benchAdd(n);
+                benchTranspose(n);
+            }
+            benchMultiply(n);
+            if (n <= 64) {
+                benchBatched(n);
+            }
+            benchSparse(n);
+        }
+    }
+
+private:
+    bool wanted(const std::string& name) const {
+        return config.filter.empty() || name.find(config.filter) != std::string::npos;
+    }
+
+    std::string caseName(const char* op, int n) const {
+        std::ostringstream name;
+        name << op << "/" << typeName<T>() << "/" << n << "/t" << threads;
+        return name.str();
+    }
+
+    void record(const char* op, int n, const std::function<void()>& f, double flops, double bytes) {
+        BenchResult r;
+        r.name = caseName(op, n);
+        r.op = op;
+        r.type = typeName<T>();
+        r.size = n;
+        r.threads = threads;
+        r.seconds = timeIt(f, config.min_time, r.iterations);
+        r.flops = flops;
+        r.bytes = bytes;
+        results.push_back(r);
+        std::fprintf(stderr, "%-32s %12.3f us %10.2f GFLOP/s %10.2f GB/s\n", r.name.c_str(),
+                     r.seconds * 1e6, r.flops / r.seconds * 1e-9, r.bytes / r.seconds * 1e-9);
+    }
+
+    void benchAdd(int n) {
+        if (!wanted(caseName("add", n))) return;
+        BasicMatrix<T> A = randomMatrix<T>(n, n);
+        BasicMatrix<T> B = randomMatrix<T>(n, n);
+        const double elems = static_cast<double>(n) * n;
+        record("add", n, [&]() { A.add_inplace(B); }, elems, 3.0 * elems * sizeof(T));
+    }
+
+    void benchTranspose(int n) {
+        if (!wanted(caseName("transpose", n))) return;
+        BasicMatrix<T> A = randomMatrix<T>(n, n);
+        BasicMatrix<T> C(n, n, BasicMatrix<T>::UNINITIALIZED);
+        const double elems = static_cast<double>(n) * n;
+        record("transpose", n, [&]() {
+            mathlib::transpose(n, n, A.data(), A.stride(), C.data(), C.stride());
+        }, 0.0, 2.0 * elems * sizeof(T));
+    }
+
+    void benchMultiply(int n) {
+        if (!wanted(caseName("multiply", n))) return;
+        BasicMatrix<T> A = randomMatrix<T>(n, n);
+        BasicMatrix<T> B = randomMatrix<T>(n, n);
+        BasicMatrix<T> C(n, n, BasicMatrix<T>::UNINITIALIZED);
+        const double elems = static_cast<double>(n) * n;
+        mathlib::ExecutionPolicy p = policy;
+        record("multiply", n, [&]() { A.multiply_into(B, C, p); },
+               2.0 * elems * n, 3.0 * elems * sizeof(T));
+    }
+
+    /// Lote de matrices n x n con unos 2^24 flops (entre 16 y 100000 productos)
+    void benchBatched(int n) {
+        if (!wanted(caseName("batched", n))) return;
+        const double perProduct = 2.0 * n * n * n;
+        const int count = static_cast<int>(std::max(16.0, std::min(100000.0, 16777216.0 / perProduct)));
+        const std::size_t each = static_cast<std::size_t>(n) * n;
+        std::vector<T> A(each * count), B(each * count), C(each * count);
+        for (std::size_t i = 0; i < A.size(); ++i) {
+            A[i] = static_cast<T>(std::rand() % 1000) / static_cast<T>(1000);
+            B[i] = static_cast<T>(std::rand() % 1000) / static_cast<T>(1000);
+        }
+        mathlib::ExecutionPolicy p = policy;
+        record("batched", n, [&]() {
+            mathlib::multiply_batched_strided(n, n, n, &A[0], n, static_cast<std::ptrdiff_t>(each),
+                                              &B[0], n, static_cast<std::ptrdiff_t>(each),
+                                              &C[0], n, static_cast<std::ptrdiff_t>(each), count, p);
+        }, perProduct * count, 3.0 * each * count * sizeof(T));
+    }
+
+    /// n x n con 8 elementos por fila, por una matriz densa de n x 16
+    void benchSparse(int n) {
+        if (!wanted(caseName("spmm", n))) return;
+        const int perRow = std::min(8, n);
+        const int width = 16;
+        std::vector<mathlib::SparseEntry<T> > entries;
+        entries.reserve(static_cast<std::size_t>(n) * perRow);
+        for (int i = 0; i < n; ++i) {
+            for (int e = 0; e < perRow; ++e) {
+                entries.push_back(mathlib::SparseEntry<T>(i, std::rand() % n, static_cast<T>(1)));
+            }
+        }
+        mathlib::BasicSparseMatrix<T> S = mathlib::BasicSparseMatrix<T>::from_triplets(n, n, entries);
+        BasicMatrix<T> X = randomMatrix<T>(n, width);
+        BasicMatrix<T> Y(n, width, BasicMatrix<T>::UNINITIALIZED);
+        const double nnz = static_cast<double>(S.nnz());
+        mathlib::ExecutionPolicy p = policy;
+        record("spmm", n, [&]() { S.multiply_into(X, Y, p); }, 2.0 * nnz * width,
+               nnz * (sizeof(T) + sizeof(int)) + 2.0 * n * width * sizeof(T));
+    }
+
+    const BenchConfig& config;
+    int threads;
+    std::vector<BenchResult>& results;
+    mathlib::ExecutionPolicy policy;
+};
+
+void writeJson(std::ostream& out, const std::vector<BenchResult>& results) {
+    char date[32];
+    std::time_t now = std::time(NULL);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << "{\n  \"context\": {\"date\": \"" << date << "\", \"simd\": \""
+        << mathlib::simd_level_name(mathlib::simd_level()) << "\", \"hardware_threads\": "
+        << std::thread::hardware_concurrency() << "},\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        char line[512];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"op\": \"%s\", \"type\": \"%s\", \"size\": %d, "
+                      "\"threads\": %d, \"iterations\": %ld, \"seconds\": %.9g, "
+                      "\"gflops\": %.6g, \"gbytes_per_s\": %.6g}",
+                      r.name.c_str(), r.op.c_str(), r.type.c_str(), r.size, r.threads,
+                      r.iterations, r.seconds, r.flops / r.seconds * 1e-9,
+                      r.bytes / r.seconds * 1e-9);
+        out << line << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+/**
+ * @brief Lee de un JSON escrito por writeJson() el tiempo de cada caso
+ *
+ * No es un lector de JSON general: busca los pares "name" y "seconds" de
+ * cada medida, que writeJson() escribe en ese orden.
+ */
+std::map<std::string, double> readBaseline(const std::string& path) {
+    std::map<std::string, double> times;
+    std::ifstream in(path.c_str());
+    if (!in) {
+        std::cerr << "math_bench - No se puede abrir " << path << "\n";
+        std::exit(2);
+    }
+    std::string line;
+    const std::string nameKey = "\"name\": \"";
+    const std::string secondsKey = "\"seconds\": ";
+    while (std::getline(in, line)) {
+        std::size_t n = line.find(nameKey);
+        std::size_t s = line.find(secondsKey);
+        if (n == std::string::npos || s == std::string::npos) {
+            continue;
+        }
+        n += nameKey.size();
+        std::size_t end = line.find('"', n);
+        times[line.substr(n, end - n)] = std::strtod(line.c_str() + s + secondsKey.size(), NULL);
+    }
+    return times;
+}
+
+/// Devuelve el número de casos más lentos que la referencia más allá de la tolerancia
+int compareBaseline(const std::vector<BenchResult>& results, const std::map<std::string, double>& base,
+                    double tolerance) {
+    int regressions = 0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        std::map<std::string, double>::const_iterator it = base.find(results[i].name);
+        if (it == base.end() || it->second <= 0.0) {
+            continue;
+        }
+        const double ratio = results[i].seconds / it->second;
+        if (ratio > 1.0 + tolerance) {
+            std::fprintf(stderr, "REGRESIÓN %-32s %.2fx más lento (%.3f us -> %.3f us)\n",
+                         results[i].name.c_str(), ratio, it->second * 1e6, results[i].seconds * 1e6);
+            ++regressions;
+        } else if (ratio < 1.0 / (1.0 + tolerance)) {
+            std::fprintf(stderr, "mejora    %-32s %.2fx más rápido\n", results[i].name.c_str(), 1.0 / ratio);
+        }
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    config.min_size = 4;
+    config.max_size = 2048;
+    config.min_time = 0.2;
+    config.tolerance = 0.10;
+    config.threads.push_back(1);
+    const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware > 1) {
+        config.threads.push_back(hardware);
+    }
+    config.types.push_back("float");
+    config.types.push_back("double");
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+        if (readOption(argv[i], "--filter", value)) {
+            config.filter = value;
+        } else if (readOption(argv[i], "--min-size", value)) {
+            config.min_size = std::max(1, std::atoi(value.c_str()));
+        } else if (readOption(argv[i], "--max-size", value)) {
+            config.max_size = std::atoi(value.c_str());
+        } else if (readOption(argv[i], "--min-time", value)) {
+            config.min_time = std::atof(value.c_str());
+        } else if (readOption(argv[i], "--threads", value)) {
+            config.threads = parseInts(value);
+        } else if (readOption(argv[i], "--types", value)) {
+            config.types = parseList(value);
+        } else if (readOption(argv[i], "--out", value)) {
+            config.out = value;
+        } else if (readOption(argv[i], "--baseline", value)) {
+            config.baseline = value;
+        } else if (readOption(argv[i], "--tolerance", value)) {
+            config.tolerance = std::atof(value.c_str());
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    std::vector<BenchResult> results;
+    for (std::size_t t = 0; t < config.threads.size(); ++t) {
+        const int threads = std::max(1, config.threads[t]);
+        mathlib::ThreadPool::configure_global(threads, false);
+        for (std::size_t k = 0; k < config.types.size(); ++k) {
+            if (config.types[k] == "float") {
+                Runner<float>(config, threads, results).run();
+            } else if (config.types[k] == "double") {
+                Runner<double>(config, threads, results).run();
+            } else {
+                std::cerr << "math_bench - Tipo no soportado: " << config.types[k] << "\n";
+                return 2;
+            }
+        }
+    }
+
+    if (config.out.empty()) {
+        writeJson(std::cout, results);
+    } else {
+        std::ofstream out(config.out.c_str());
+        writeJson(out, results);
+    }
+
+    if (!config.baseline.empty()) {
+        const int regressions = compareBaseline(results, readBaseline(config.baseline), config.tolerance);
+        if (regressions > 0) {
+            std::fprintf(stderr, "%d casos más lentos que la referencia\n", regressions);
+            return 1;
+        }
+    }
+    return 0;
+}
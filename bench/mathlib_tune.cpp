@@ -0,0 +1,111 @@
+/**
+ * @file mathlib_tune.cpp
+ * @brief Calibra los parámetros de despacho de MathLib para este equipo
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Ejecuta mathlib::autotune() y guarda el resultado en el fichero de
+ * calibración del equipo (tuning_file_path(), o --out), que la
+ * biblioteca carga al arrancar. Las medidas van a la salida de errores y
+ * el fichero resultante a la salida estándar. Con --show solo se muestra
+ * el fichero que se cargaría y los parámetros activos.
+ *
+ * @code
+ * mathlib_tune
+ * mathlib_tune --max-size=1024 --min-time=0.2 --out=/etc/mathlib/tuning.conf
+ * MATHLIB_TUNING_FILE=/etc/mathlib/tuning.conf ./programa
+ * @endcode
+ */
+
+#include "Tuning.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+bool readOption(const char* arg, const char* name, std::string& value) {
+    const std::size_t len = std::strlen(name);
+    if (std::strncmp(arg, name, len) == 0 && arg[len] == '=') {
+        value = arg + len + 1;
+        return true;
+    }
+    return false;
+}
+
+void usage() {
+    std::cerr << "Uso: mathlib_tune [--out=fichero] [--max-size=512] [--min-time=0.05]\n"
+                 "                    [--no-threads] [--quiet] [--show]\n";
+}
+
+void printParameters(std::ostream& out, const mathlib::TuningParameters& params) {
+    out << "f64 mc/kc/nc = " << params.blocking_f64.mc << "/" << params.blocking_f64.kc
+        << "/" << params.blocking_f64.nc << " (0: según las cachés)\n"
+        << "f32 mc/kc/nc = " << params.blocking_f32.mc << "/" << params.blocking_f32.kc
+        << "/" << params.blocking_f32.nc << "\n"
+        << "small_gemm_volume = " << params.small_gemm_volume << "\n"
+        << "parallel_gemm_volume = " << params.parallel_gemm_volume << "\n"
+        << "tiles_per_thread = " << params.tiles_per_thread << "\n"
+        << "parallel_gemv_elements = " << params.parallel_gemv_elements << "\n"
+        << "strassen_crossover = " << params.strassen_crossover << "\n"
+        << "threads = " << params.threads << " (grupo global: "
+        << mathlib::ThreadPool::global().size() << ")\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string out = mathlib::tuning_file_path();
+    mathlib::TuneOptions options;
+    bool quiet = false;
+    bool show = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+        if (readOption(argv[i], "--out", value)) {
+            out = value;
+        } else if (readOption(argv[i], "--max-size", value)) {
+            options.max_size = std::atoi(value.c_str());
+        } else if (readOption(argv[i], "--min-time", value)) {
+            options.min_time = std::atof(value.c_str());
+        } else if (std::strcmp(argv[i], "--no-threads") == 0) {
+            options.tune_threads = false;
+        } else if (std::strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        } else if (std::strcmp(argv[i], "--show") == 0) {
+            show = true;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    if (show) {
+        std::cout << "fichero: " << (out.empty() ? "(ninguno)" : out) << "\n"
+                  << "simd: " << mathlib::simd_level_name(mathlib::simd_level()) << "\n";
+        printParameters(std::cout, mathlib::tuning());
+        return 0;
+    }
+    if (out.empty()) {
+        std::cerr << "mathlib_tune - No hay directorio de configuración; indique --out\n";
+        return 2;
+    }
+
+    try {
+        const mathlib::TuningParameters params = mathlib::autotune(quiet ? nullptr : &std::cerr, options);
+        mathlib::save_tuning(out, params);
+        std::cerr << "mathlib_tune - Guardado en " << out << "\n";
+        std::ifstream saved(out.c_str());
+        std::cout << saved.rdbuf();
+    } catch (const std::exception& e) {
+        std::cerr << "mathlib_tune - " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
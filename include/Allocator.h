@@ -0,0 +1,247 @@
+/**
+ * @file Allocator.h
+ * @brief Asignadores de memoria para los datos de Matrix
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Este archivo declara la interfaz MatrixAllocator y tres
+ * implementaciones: el montículo global alineado (por defecto), una
+ * arena de puntero creciente que se libera en bloque con reset() y un
+ * pool con clases de tamaño que recicla bloques de formas recurrentes.
+ *
+ * Cada Matrix recuerda el asignador con el que se creó. El asignador se
+ * elige explícitamente en el constructor o, de forma implícita, mediante
+ * un AllocationScope activo en el hilo actual:
+ *
+ * @code
+ * mathlib::ArenaAllocator& arena = mathlib::thread_arena();
+ * {
+ *     mathlib::AllocationScope scope(arena);
+ *     Matrix C = A.multiply(B).add(D); // temporales en la arena
+ *     responder(C);
+ * }                                    // C se destruye
+ * arena.reset();                       // libera todo de una vez
+ * @endcode
+ */
+
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace mathlib {
+
+/// Alineación en bytes de todos los bloques entregados por los asignadores
+static const std::size_t MATRIX_ALIGNMENT = 64;
+
+/**
+ * @brief Reserva bytes alineados a MATRIX_ALIGNMENT en el montículo global
+ *
+ * @param bytes Tamaño en bytes
+ * @return Puntero al bloque, o NULL si bytes es 0
+ * @throws std::bad_alloc Si la reserva falla
+ */
+void* aligned_allocate(std::size_t bytes);
+
+/**
+ * @brief Libera un bloque obtenido con aligned_allocate()
+ *
+ * @param ptr Puntero al bloque (puede ser NULL)
+ */
+void aligned_free(void* ptr);
+
+/**
+ * @class MatrixAllocator
+ * @brief Interfaz de los asignadores de datos de matrices
+ *
+ * Los bloques deben estar alineados a MATRIX_ALIGNMENT bytes. Los tamaños
+ * se expresan en bytes para que un mismo asignador sirva a matrices de
+ * cualquier tipo de elemento (BasicMatrix<float>, Matrix, ...).
+ */
+class MatrixAllocator {
+public:
+    virtual ~MatrixAllocator() {}
+
+    /**
+     * @brief Reserva un bloque de bytes bytes
+     *
+     * @param bytes Tamaño del bloque (mayor que 0)
+     * @return Puntero alineado al bloque (sin inicializar)
+     * @throws std::bad_alloc Si no hay memoria
+     */
+    virtual void* allocate(std::size_t bytes) = 0;
+
+    /**
+     * @brief Devuelve un bloque obtenido con allocate()
+     *
+     * @param ptr Puntero al bloque (puede ser NULL)
+     * @param bytes Tamaño con que se reservó
+     */
+    virtual void deallocate(void* ptr, std::size_t bytes) = 0;
+};
+
+/**
+ * @brief Asignador por defecto: montículo global con bloques alineados
+ *
+ * @return Referencia al asignador global (seguro entre hilos)
+ */
+MatrixAllocator& heap_allocator();
+
+/**
+ * @class ArenaAllocator
+ * @brief Arena de puntero creciente que se libera en bloque
+ *
+ * allocate() solo avanza un puntero dentro de un trozo grande de memoria
+ * y deallocate() no hace nada; reset() recupera todo el espacio de una
+ * vez conservando los trozos para la siguiente petición. Tras unas pocas
+ * peticiones la arena deja de llamar a malloc/free.
+ *
+ * @warning No es segura entre hilos para allocate()/reset(): se usa una
+ * arena por hilo (véase thread_arena()). Todas las matrices creadas en
+ * la arena deben destruirse antes de llamar a reset().
+ */
+class ArenaAllocator : public MatrixAllocator {
+public:
+    /**
+     * @brief Crea una arena vacía
+     *
+     * @param chunk_bytes Tamaño mínimo de cada trozo que se pide al sistema
+     */
+    explicit ArenaAllocator(std::size_t chunk_bytes = 4u << 20);
+
+    ~ArenaAllocator();
+
+    void* allocate(std::size_t bytes);
+    void deallocate(void* ptr, std::size_t bytes);
+
+    /**
+     * @brief Recupera de una vez todo el espacio entregado
+     *
+     * Los trozos reservados se conservan y se reutilizan.
+     */
+    void reset();
+
+    /**
+     * @brief Devuelve al sistema todos los trozos reservados
+     */
+    void release();
+
+    /// Bytes entregados desde el último reset()
+    std::size_t bytes_used() const { return used; }
+
+    /// Bytes reservados al sistema en total
+    std::size_t bytes_reserved() const { return reserved; }
+
+private:
+    struct Chunk {
+        char* base;
+        std::size_t size;
+    };
+
+    ArenaAllocator(const ArenaAllocator&);
+    ArenaAllocator& operator=(const ArenaAllocator&);
+
+    std::vector<Chunk> chunks;  ///< Trozos reservados
+    std::size_t current;        ///< Trozo en uso
+    std::size_t offset;         ///< Posición libre dentro del trozo en uso
+    std::size_t chunkBytes;     ///< Tamaño mínimo de trozo
+    std::size_t used;           ///< Bytes entregados desde el último reset()
+    std::size_t reserved;       ///< Bytes reservados al sistema
+};
+
+/**
+ * @class PoolAllocator
+ * @brief Pool con clases de tamaño que recicla bloques liberados
+ *
+ * Cada petición se redondea a la siguiente potencia de dos y los bloques
+ * liberados se guardan en una lista por clase para reutilizarse con la
+ * siguiente matriz de tamaño parecido. Adecuado cuando las matrices
+ * tienen pocas formas recurrentes pero vidas que no encajan en una arena.
+ * Es seguro entre hilos.
+ */
+class PoolAllocator : public MatrixAllocator {
+public:
+    /**
+     * @brief Crea un pool vacío
+     *
+     * @param max_cached_bytes Bytes máximos retenidos en las listas libres;
+     *        por encima de ese límite los bloques se devuelven al sistema
+     */
+    explicit PoolAllocator(std::size_t max_cached_bytes = 256u << 20);
+
+    ~PoolAllocator();
+
+    void* allocate(std::size_t bytes);
+    void deallocate(void* ptr, std::size_t bytes);
+
+    /**
+     * @brief Devuelve al sistema todos los bloques retenidos
+     */
+    void trim();
+
+    /// Bytes retenidos actualmente en las listas libres
+    std::size_t bytes_cached() const;
+
+private:
+    PoolAllocator(const PoolAllocator&);
+    PoolAllocator& operator=(const PoolAllocator&);
+
+    static const int CLASS_COUNT = 48;
+
+    mutable std::mutex mutex;                      ///< Protege las listas libres
+    std::vector<void*> freeLists[CLASS_COUNT];     ///< Bloques libres por clase
+    std::size_t cached;                            ///< Bytes retenidos
+    std::size_t maxCached;                         ///< Límite de bytes retenidos
+};
+
+/**
+ * @brief Arena propia del hilo actual
+ *
+ * @return Referencia a una ArenaAllocator que vive lo mismo que el hilo
+ */
+ArenaAllocator& thread_arena();
+
+/**
+ * @brief Asignador usado por las matrices que no indican uno explícito
+ *
+ * Es el del AllocationScope más interno activo en este hilo, o
+ * heap_allocator() si no hay ninguno.
+ *
+ * @return Referencia al asignador actual del hilo
+ */
+MatrixAllocator& current_allocator();
+
+/**
+ * @class AllocationScope
+ * @brief Contexto RAII que cambia el asignador por defecto del hilo
+ *
+ * Mientras el objeto existe, las matrices creadas en este hilo sin
+ * asignador explícito (incluidos los resultados de add() o multiply())
+ * usan el asignador indicado. Los contextos pueden anidarse.
+ */
+class AllocationScope {
+public:
+    /**
+     * @brief Activa un asignador para el hilo actual
+     * @param allocator Asignador a usar dentro del contexto
+     */
+    explicit AllocationScope(MatrixAllocator& allocator);
+
+    /**
+     * @brief Restaura el asignador anterior
+     */
+    ~AllocationScope();
+
+private:
+    AllocationScope(const AllocationScope&);
+    AllocationScope& operator=(const AllocationScope&);
+
+    MatrixAllocator* previous;  ///< Asignador activo antes del contexto
+};
+
+} // namespace mathlib
+
+#endif
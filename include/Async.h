@@ -0,0 +1,219 @@
+/**
+ * @file Async.h
+ * @brief Operaciones asíncronas encadenables sobre el grupo de hilos
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada operación async_* devuelve inmediatamente un MatrixFuture con el
+ * resultado pendiente. Los operandos son a su vez futuros, de modo que las
+ * llamadas forman un pequeño grafo de dependencias: una operación se
+ * encola en el grupo de hilos global en cuanto todas sus entradas están
+ * listas, y las operaciones independientes se ejecutan a la vez. Un solo
+ * hilo puede así construir el grafo completo y esperar solo el final.
+ *
+ * Si una operación lanza una excepción, esta se guarda en su futuro, las
+ * operaciones que dependen de él no se ejecutan y get() la relanza.
+ *
+ * MatrixFuture es además un awaitable de C++20 (await_ready,
+ * await_suspend y await_resume), así que dentro de una corrutina basta
+ * con co_await; la corrutina se reanuda en el hilo que completa el
+ * resultado.
+ *
+ * @code
+ * mathlib::MatrixFuture<double> a(A), b(B), c(C);
+ * mathlib::MatrixFuture<double> ab = mathlib::async_multiply(a, b);   // en paralelo
+ * mathlib::MatrixFuture<double> bc = mathlib::async_multiply(b, c);   // con ab
+ * mathlib::MatrixFuture<double> r = mathlib::async_add(ab, bc);       // al terminar ambos
+ * preparar_siguiente_lote();
+ * const Matrix& resultado = r.get();
+ * @endcode
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Gemm.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @class MatrixFuture
+ * @brief Resultado, quizá aún pendiente, de una operación asíncrona
+ *
+ * Las copias comparten el mismo resultado, que vive mientras exista
+ * alguna. Las matrices que se pasan ya calculadas se guardan como
+ * futuros listos.
+ */
+template <class T>
+class MatrixFuture {
+public:
+    /// Trabajo que produce una matriz
+    typedef std::function<BasicMatrix<T>()> Work;
+
+    /**
+     * @brief Futuro vacío (valid() == false)
+     */
+    MatrixFuture() {}
+
+    /**
+     * @brief Futuro listo con una copia de value
+     */
+    explicit MatrixFuture(const BasicMatrix<T>& value);
+
+    /**
+     * @brief Futuro listo que toma posesión de value
+     */
+    explicit MatrixFuture(BasicMatrix<T>&& value);
+
+    /**
+     * @brief Futuro listo que comparte value sin copiarlo
+     *
+     * Útil para operandos grandes que se usan en varias operaciones; la
+     * matriz no debe modificarse mientras haya operaciones pendientes.
+     */
+    explicit MatrixFuture(const std::shared_ptr<const BasicMatrix<T> >& value);
+
+    /**
+     * @brief Ejecuta work en el grupo de hilos cuando inputs estén listos
+     *
+     * Es la pieza con la que se construyen todas las operaciones async_*.
+     * work puede llamar a get() sobre cualquiera de las entradas sin
+     * esperar. Si alguna entrada falló, work no se ejecuta y el futuro
+     * devuelto guarda la excepción de la primera de ellas.
+     *
+     * @param inputs Futuros de los que depende el trabajo (todos válidos)
+     * @param work Cálculo del resultado
+     * @return Futuro del resultado de work
+     * @throws std::invalid_argument Si alguna entrada está vacía
+     */
+    static MatrixFuture after(const std::vector<MatrixFuture>& inputs, const Work& work);
+
+    /**
+     * @brief Indica si el futuro tiene un estado (no es un futuro vacío)
+     */
+    bool valid() const { return static_cast<bool>(state); }
+
+    /**
+     * @brief Indica si el resultado (o su excepción) ya está disponible
+     */
+    bool ready() const;
+
+    /**
+     * @brief Espera al resultado
+     *
+     * Mientras espera, el hilo llamante ejecuta tareas pendientes del
+     * grupo, así que puede llamarse también desde dentro de otra tarea.
+     *
+     * @throws std::runtime_error Si el futuro está vacío
+     */
+    void wait() const;
+
+    /**
+     * @brief Espera y devuelve el resultado
+     *
+     * @return Referencia válida mientras exista alguna copia del futuro
+     * @throws La excepción lanzada por la operación, si falló
+     * @throws std::runtime_error Si el futuro está vacío
+     */
+    const BasicMatrix<T>& get() const;
+
+    /**
+     * @brief Aplica fn al resultado en cuanto esté listo
+     *
+     * @param fn Función del resultado a una nueva matriz
+     * @return Futuro de fn(get())
+     */
+    MatrixFuture then(const std::function<BasicMatrix<T>(const BasicMatrix<T>&)>& fn) const;
+
+    /**
+     * @brief Llama a callback cuando el resultado esté disponible
+     *
+     * Si ya lo está, callback se llama en el acto en el hilo actual; si
+     * no, en el hilo que complete la operación. callback no debe lanzar.
+     */
+    void on_ready(const std::function<void()>& callback) const;
+
+    /// @name Interfaz de awaitable de C++20
+    /// @{
+    bool await_ready() const { return ready(); }
+
+    template <class Handle>
+    void await_suspend(Handle handle) const {
+        on_ready([handle]() mutable { handle.resume(); });
+    }
+
+    const BasicMatrix<T>& await_resume() const { return get(); }
+    /// @}
+
+private:
+    struct State;
+
+    explicit MatrixFuture(const std::shared_ptr<State>& s) : state(s) {}
+
+    std::shared_ptr<State> state;
+};
+
+/**
+ * @brief Ejecuta work en el grupo de hilos global
+ *
+ * Permite meter en el grafo trabajos propios, como leer o preparar una
+ * matriz, de los que dependan otras operaciones.
+ */
+template <class T>
+MatrixFuture<T> async_run(const std::function<BasicMatrix<T>()>& work);
+
+/**
+ * @brief a + b cuando ambos estén listos
+ */
+template <class T>
+MatrixFuture<T> async_add(const MatrixFuture<T>& a, const MatrixFuture<T>& b);
+
+/**
+ * @brief a - b cuando ambos estén listos
+ */
+template <class T>
+MatrixFuture<T> async_subtract(const MatrixFuture<T>& a, const MatrixFuture<T>& b);
+
+/**
+ * @brief Producto elemento a elemento de a y b cuando ambos estén listos
+ */
+template <class T>
+MatrixFuture<T> async_hadamard(const MatrixFuture<T>& a, const MatrixFuture<T>& b);
+
+/**
+ * @brief alpha · a cuando a esté listo
+ */
+template <class T>
+MatrixFuture<T> async_scale(const MatrixFuture<T>& a, T alpha);
+
+/**
+ * @brief Transpuesta de a cuando esté lista
+ */
+template <class T>
+MatrixFuture<T> async_transpose(const MatrixFuture<T>& a);
+
+/**
+ * @brief a × b cuando ambos estén listos
+ *
+ * Con las opciones por defecto cada producto usa un solo hilo y el
+ * paralelismo viene de ejecutar varias operaciones a la vez; con
+ * options.policy = PARALLEL cada producto reparte además sus bloques en
+ * el mismo grupo.
+ *
+ * @param options Algoritmo, política y transposiciones, como en
+ *        BasicMatrix::multiply()
+ */
+template <class T>
+MatrixFuture<T> async_multiply(const MatrixFuture<T>& a, const MatrixFuture<T>& b,
+                               const MultiplyOptions& options = MultiplyOptions());
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * @file Batched.h
+ * @brief Multiplicación por lotes de muchas matrices pequeñas
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * multiply_batched() calcula C[i] = A[i] × B[i] para un lote de pares de
+ * matrices con las mismas dimensiones en una sola llamada: la validación
+ * se hace una vez para todo el lote, no se reserva memoria para los
+ * resultados y el reparto entre hilos se decide una sola vez.
+ *
+ * Las matrices pequeñas se entrelazan en los carriles SIMD: cada registro
+ * lleva el mismo elemento de varias matrices del lote (8 en double y 16
+ * en float con AVX-512), así que incluso un producto de 3 x 3 aprovecha
+ * el ancho completo del vector. Las matrices mayores usan el GEMM
+ * empaquetado, una por hilo.
+ *
+ * Los operandos pueden darse como arreglos de punteros o, si el lote
+ * está en un solo buffer, como un puntero base y una separación entre
+ * matrices consecutivas (multiply_batched_strided()).
+ *
+ * @code
+ * // 100000 productos de 4x4 guardados uno tras otro
+ * mathlib::multiply_batched_strided(4, 4, 4, a, 4, 16, b, 4, 16, c, 4, 16,
+ *                                   100000, mathlib::PARALLEL);
+ * @endcode
+ */
+
+#ifndef BATCHED_H
+#define BATCHED_H
+
+#include <cstddef>
+#include <vector>
+#include "Gemm.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @brief Indica si multiply_batched() entrelaza un lote de productos m x k por k x n
+ *
+ * Se entrelaza cuando m·n·k queda por debajo de
+ * tuning().small_gemm_volume, es decir, justo donde gemm() usaría el
+ * kernel de referencia; a partir de ahí el GEMM empaquetado por matriz
+ * ya es más rápido. Medido con multiply_batched_strided() secuencial
+ * sobre matrices cuadradas en double (AVX-512, un hilo): con el volumen
+ * por defecto (32³), en n = 31 el entrelazado tarda 7,1 µs por producto
+ * frente a 14,9 µs por matriz, y en n = 32 8,0 µs frente a 1,8 µs; con
+ * el volumen calibrado en ese equipo (16³) el GEMM por matriz gana desde
+ * n = 16 (0,47 µs frente a 0,78 µs).
+ */
+bool batch_interleaved(int m, int n, int k);
+
+/**
+ * @brief C[i] = A[i] × B[i] para i en [0, batch_count) con arreglos de punteros
+ *
+ * Todas las matrices del lote comparten dimensiones y separación entre
+ * filas. Los resultados no deben solaparse con ningún operando.
+ *
+ * @param m Filas de cada A[i] y C[i]
+ * @param n Columnas de cada B[i] y C[i]
+ * @param k Columnas de cada A[i] y filas de cada B[i]
+ * @param A Arreglo de batch_count punteros a matrices m x k
+ * @param lda Separación entre filas de cada A[i] (>= k)
+ * @param B Arreglo de batch_count punteros a matrices k x n
+ * @param ldb Separación entre filas de cada B[i] (>= n)
+ * @param C Arreglo de batch_count punteros a matrices m x n; se sobrescriben
+ * @param ldc Separación entre filas de cada C[i] (>= n)
+ * @param batch_count Número de productos
+ * @param policy PARALLEL reparte el lote entre los hilos del grupo global
+ * @throws std::invalid_argument Si alguna dimensión o separación no es válida
+ */
+template <class T>
+void multiply_batched(int m, int n, int k,
+                      const T* const* A, int lda,
+                      const T* const* B, int ldb,
+                      T* const* C, int ldc,
+                      int batch_count, ExecutionPolicy policy = SEQUENTIAL);
+
+/**
+ * @brief C[i] = A[i] × B[i] con el lote almacenado en buffers únicos
+ *
+ * La matriz i de cada operando empieza en base + i * stride.
+ *
+ * @param stride_a Elementos entre el inicio de A[i] y el de A[i + 1]
+ * @param stride_b Elementos entre el inicio de B[i] y el de B[i + 1]
+ * @param stride_c Elementos entre el inicio de C[i] y el de C[i + 1]
+ * @throws std::invalid_argument Si alguna dimensión o separación no es válida
+ *
+ * El resto de parámetros es como en multiply_batched().
+ */
+template <class T>
+void multiply_batched_strided(int m, int n, int k,
+                              const T* A, int lda, std::ptrdiff_t stride_a,
+                              const T* B, int ldb, std::ptrdiff_t stride_b,
+                              T* C, int ldc, std::ptrdiff_t stride_c,
+                              int batch_count, ExecutionPolicy policy = SEQUENTIAL);
+
+/**
+ * @brief C[i] = A[i] × B[i] sobre vectores de matrices
+ *
+ * Todas las A[i] deben tener las mismas dimensiones, igual que las B[i].
+ * Las C[i] que ya tengan la forma del producto se reutilizan sin
+ * reservar memoria; el resto se reemplaza.
+ *
+ * @param A Matrices m x k
+ * @param B Matrices k x n (tantas como en A)
+ * @param C Resultados; se redimensiona a A.size()
+ * @param policy PARALLEL reparte el lote entre los hilos del grupo global
+ * @throws std::invalid_argument Si los tamaños del lote o las dimensiones no coinciden
+ */
+template <class T>
+void multiply_batched(const std::vector<BasicMatrix<T> >& A,
+                      const std::vector<BasicMatrix<T> >& B,
+                      std::vector<BasicMatrix<T> >& C,
+                      ExecutionPolicy policy = SEQUENTIAL);
+
+} // namespace mathlib
+
+#endif
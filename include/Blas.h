@@ -0,0 +1,67 @@
+/**
+ * @file Blas.h
+ * @brief Puente opcional hacia una biblioteca CBLAS/LAPACK del sistema
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Con la opción de CMake MATHLIB_BLAS=ON la biblioteca se enlaza con el
+ * BLAS que encuentra find_package(BLAS) (OpenBLAS, MKL, BLIS...; se
+ * elige con -DBLA_VENDOR=OpenBLAS|Intel10_64lp|FLAME) y, si lo hay, con
+ * su LAPACK. Las mismas llamadas de siempre delegan entonces en el
+ * proveedor, sobre el almacenamiento por filas de la matriz y sin copias:
+ *
+ * - gemm() y gemm_parallel() (y con ellos Matrix::multiply, Strassen,
+ *   los lotes y las factorizaciones) en cblas_sgemm / cblas_dgemm cuando
+ *   m·n·k >= BLAS_MIN_VOLUME;
+ * - gemv() y gemv_parallel() en cblas_sgemv / cblas_dgemv cuando A tiene
+ *   al menos BLAS_MIN_GEMV_ELEMENTS elementos;
+ * - LUFactorization y CholeskyFactorization en ?getrf / ?potrf de LAPACK
+ *   cuando n >= BLAS_MIN_FACTOR (la LU traspone la matriz una vez, O(n²),
+ *   porque getrf pivota por filas en almacenamiento por columnas).
+ *
+ * Los tipos int y std::complex<double>, los tamaños pequeños y
+ * gemm_blocked() siguen usando los kernels propios, que también son la
+ * alternativa cuando la biblioteca se compila sin la opción o cuando la
+ * variable de entorno MATHLIB_BLAS vale "native". El proveedor usa sus
+ * propios hilos (OPENBLAS_NUM_THREADS, MKL_NUM_THREADS...) incluso con
+ * SEQUENTIAL; conviene limitarlos a uno si los productos se lanzan desde
+ * el grupo de hilos de la biblioteca.
+ */
+
+#ifndef BLAS_H
+#define BLAS_H
+
+namespace mathlib {
+
+/// Volumen m·n·k a partir del cual GEMM delega en el proveedor BLAS
+static const double BLAS_MIN_VOLUME = 64.0 * 64.0 * 64.0;
+
+/// Elementos de A a partir de los cuales GEMV delega en el proveedor BLAS
+static const double BLAS_MIN_GEMV_ELEMENTS = 128.0 * 128.0;
+
+/// Orden a partir del cual las factorizaciones delegan en LAPACK
+static const int BLAS_MIN_FACTOR = 128;
+
+/**
+ * @brief Indica si las operaciones delegan en un proveedor BLAS
+ *
+ * @return false si se compiló sin MATHLIB_BLAS o con MATHLIB_BLAS=native
+ */
+bool blas_available();
+
+/**
+ * @brief Indica si las factorizaciones delegan en LAPACK
+ *
+ * @return false si no hay BLAS disponible o si no se encontró LAPACK al compilar
+ */
+bool lapack_available();
+
+/**
+ * @brief Nombre del proveedor: "openblas", "mkl", "cblas" (otro) o "native"
+ */
+const char* blas_backend();
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file Device.h
+ * @brief Matrices residentes en GPU (CUDA o HIP) con vuelta a la CPU
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * El backend se elige al compilar con la opción de CMake MATHLIB_GPU
+ * (OFF, CUDA o HIP). DeviceMatrix guarda una copia en el host, otra en el
+ * dispositivo o ambas, y solo transfiere cuando hace falta: un operando
+ * se sube la primera vez que participa en una operación en el
+ * dispositivo, y los resultados se quedan en él hasta que se lee un
+ * elemento con get() o la matriz completa con host(). Así una cadena de
+ * productos y sumas no vuelve a la memoria principal hasta el final.
+ *
+ * Si la biblioteca se compiló sin backend, no hay ningún dispositivo o la
+ * variable de entorno MATHLIB_DEVICE vale "cpu", las mismas llamadas se
+ * ejecutan con los kernels de CPU (en el grupo de hilos global), de modo
+ * que el código no cambia entre equipos con y sin GPU.
+ *
+ * @code
+ * mathlib::DeviceMatrix<double> a(A), b(B);
+ * mathlib::DeviceMatrix<double> c = a.multiply(b).add(a);   // sin copias al host
+ * double esquina = c.get(0, 0);                             // aquí se descarga
+ * @endcode
+ */
+
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include <memory>
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * Volumen m·n·k a partir del cual un producto con ambos operandos en el
+ * host se envía al dispositivo; por debajo las transferencias cuestan
+ * más que el cálculo
+ */
+static const double DEVICE_MIN_VOLUME = 256.0 * 256.0 * 256.0;
+
+/**
+ * @brief Indica si hay un dispositivo utilizable
+ *
+ * @return false sin backend, sin dispositivos o con MATHLIB_DEVICE=cpu
+ */
+bool device_available();
+
+/**
+ * @brief Nombre del backend en uso: "cuda", "hip" o "cpu"
+ */
+const char* device_backend();
+
+/**
+ * @class DeviceMatrix
+ * @brief Matriz densa (float o double) que puede residir en la GPU
+ *
+ * Los objetos son valores inmutables: las operaciones devuelven matrices
+ * nuevas y las copias comparten los datos, así que copiar un
+ * DeviceMatrix no transfiere nada.
+ *
+ * Una operación se ejecuta en el dispositivo cuando este está disponible
+ * y alguno de los operandos ya reside en él, o cuando se trata de un
+ * producto de volumen DEVICE_MIN_VOLUME o mayor. En otro caso se ejecuta
+ * en la CPU, descargando antes los operandos que solo estén en el
+ * dispositivo.
+ */
+template <class T>
+class DeviceMatrix {
+public:
+    /**
+     * @brief Copia una matriz del host; la subida se hace al usarla
+     */
+    explicit DeviceMatrix(const BasicMatrix<T>& host);
+
+    int num_rows() const;
+    int num_cols() const;
+
+    /// Indica si hay una copia válida en el dispositivo
+    bool on_device() const;
+
+    /// Indica si hay una copia válida en el host
+    bool on_host() const;
+
+    /**
+     * @brief Sube la matriz al dispositivo ya (sin efecto si ya está o si
+     *        no hay dispositivo)
+     *
+     * Permite adelantar la transferencia, por ejemplo mientras la CPU
+     * prepara otros datos.
+     */
+    void upload() const;
+
+    /**
+     * @brief Producto this × other
+     *
+     * @throws std::invalid_argument Si las columnas de this no coinciden
+     *         con las filas de other
+     * @throws std::runtime_error Si el dispositivo devuelve un error
+     */
+    DeviceMatrix multiply(const DeviceMatrix& other) const;
+
+    /**
+     * @brief Suma elemento a elemento
+     *
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     * @throws std::runtime_error Si el dispositivo devuelve un error
+     */
+    DeviceMatrix add(const DeviceMatrix& other) const;
+
+    /**
+     * @brief Resta elemento a elemento
+     *
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     * @throws std::runtime_error Si el dispositivo devuelve un error
+     */
+    DeviceMatrix subtract(const DeviceMatrix& other) const;
+
+    /**
+     * @brief Elemento (r, c); descarga la matriz si solo está en el dispositivo
+     *
+     * @throws std::out_of_range Si el índice está fuera de la matriz
+     */
+    T get(int r, int c) const;
+
+    /**
+     * @brief Copia en el host (se descarga la primera vez que hace falta)
+     *
+     * @return Referencia válida mientras exista alguna copia de este objeto
+     */
+    const BasicMatrix<T>& host() const;
+
+private:
+    struct Storage;
+
+    explicit DeviceMatrix(const std::shared_ptr<Storage>& s) : storage(s) {}
+
+    DeviceMatrix combine(const DeviceMatrix& other, T beta, const char* where) const;
+
+    std::shared_ptr<Storage> storage;
+};
+
+extern template class DeviceMatrix<float>;
+extern template class DeviceMatrix<double>;
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file Distributed.h
+ * @brief Matrices distribuidas por bloques cíclicos 2D y producto SUMMA sobre MPI
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Solo está disponible en la biblioteca opcional mathlib_mpi (opción de
+ * CMake MATHLIB_MPI=ON); el resto de la biblioteca no depende de MPI.
+ *
+ * Los procesos se organizan en una malla de Pr x Pc (ProcessGrid). La
+ * matriz global se corta en bloques de block_rows x block_cols y el
+ * bloque (I, J) lo guarda el proceso (I mod Pr, J mod Pc), como en
+ * ScaLAPACK. Cada proceso guarda sus bloques juntos en una matriz local
+ * por filas.
+ *
+ * multiply() usa SUMMA: para cada bloque de la dimensión compartida, la
+ * columna de procesos que tiene ese panel de A lo difunde por su fila de
+ * la malla y la fila de procesos que tiene el panel de B lo difunde por su
+ * columna; cada proceso acumula entonces panel A × panel B en su parte de
+ * C con el GEMM empaquetado de la biblioteca. Las difusiones del panel
+ * siguiente se lanzan sin bloqueo (MPI_Ibcast) antes de calcular el
+ * actual, de modo que la comunicación se solapa con el cálculo.
+ *
+ * Las llamadas MPI se hacen desde el hilo que llama a multiply(); el
+ * grupo de hilos solo calcula, así que basta con MPI_THREAD_FUNNELED.
+ *
+ * @code
+ * MPI_Init(&argc, &argv);
+ * {
+ *     mathlib::ProcessGrid grid(MPI_COMM_WORLD);          // malla casi cuadrada
+ *     mathlib::DistributedMatrix<double> A(grid, n, n), B(grid, n, n);
+ *     A.generate([](int i, int j) { return valor_a(i, j); });
+ *     B.generate([](int i, int j) { return valor_b(i, j); });
+ *     mathlib::DistributedMatrix<double> C = A.multiply(B);
+ * }
+ * MPI_Finalize();
+ * @endcode
+ */
+
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+// Solo se usa la API de C de MPI; se omiten las antiguas interfaces de C++
+#ifndef OMPI_SKIP_MPICXX
+#define OMPI_SKIP_MPICXX 1
+#endif
+#ifndef MPICH_SKIP_MPICXX
+#define MPICH_SKIP_MPICXX 1
+#endif
+#include <mpi.h>
+#include <functional>
+#include <vector>
+#include "Gemm.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/// Lado de bloque por defecto de las matrices distribuidas
+static const int DISTRIBUTED_BLOCK = 256;
+
+/**
+ * @class ProcessGrid
+ * @brief Malla 2D de procesos MPI con comunicadores por fila y por columna
+ *
+ * El proceso de rango r del comunicador ocupa la posición
+ * (r / cols, r % cols). Debe existir mientras la usen matrices
+ * distribuidas y destruirse antes de MPI_Finalize().
+ */
+class ProcessGrid {
+public:
+    /**
+     * @brief Crea la malla sobre todos los procesos de comm
+     *
+     * @param comm Comunicador (se duplica; el original no se usa después)
+     * @param rows Filas de la malla; con rows = cols = 0 se elige la
+     *        factorización más cuadrada del número de procesos
+     * @param cols Columnas de la malla
+     * @throws std::invalid_argument Si rows · cols no es el número de procesos
+     */
+    explicit ProcessGrid(MPI_Comm comm, int rows = 0, int cols = 0);
+
+    ~ProcessGrid();
+
+    int rows() const { return gridRows; }
+    int cols() const { return gridCols; }
+    int row() const { return myRow; }     ///< Fila de este proceso en la malla
+    int col() const { return myCol; }     ///< Columna de este proceso en la malla
+    int rank() const { return myRank; }   ///< Rango en comm()
+    MPI_Comm comm() const { return all; }
+    MPI_Comm row_comm() const { return rowComm; }   ///< Procesos de la misma fila (rango = columna)
+    MPI_Comm col_comm() const { return colComm; }   ///< Procesos de la misma columna (rango = fila)
+
+private:
+    ProcessGrid(const ProcessGrid&);
+    ProcessGrid& operator=(const ProcessGrid&);
+
+    MPI_Comm all;
+    MPI_Comm rowComm;
+    MPI_Comm colComm;
+    int gridRows;
+    int gridCols;
+    int myRow;
+    int myCol;
+    int myRank;
+};
+
+/**
+ * @class DistributedMatrix
+ * @brief Matriz densa (float o double) repartida en bloques cíclicos 2D
+ *
+ * Cada proceso guarda local_rows() x local_cols() elementos contiguos por
+ * filas en local_data(); la fila local r corresponde a la fila global
+ * global_row(r) y lo mismo para las columnas. Un proceso puede no tener
+ * ningún elemento si la matriz es pequeña para la malla.
+ *
+ * Todas las funciones que comunican (scatter, gather, multiply) son
+ * colectivas: deben llamarlas todos los procesos de la malla.
+ */
+template <class T>
+class DistributedMatrix {
+public:
+    /**
+     * @brief Matriz distribuida de rows x cols inicializada con ceros
+     *
+     * @param grid Malla de procesos (debe sobrevivir a la matriz)
+     * @param block_rows Filas de cada bloque
+     * @param block_cols Columnas de cada bloque
+     * @throws std::invalid_argument Si alguna dimensión o bloque no es positivo
+     */
+    DistributedMatrix(const ProcessGrid& grid, int rows, int cols,
+                      int block_rows = DISTRIBUTED_BLOCK, int block_cols = DISTRIBUTED_BLOCK);
+
+    /**
+     * @brief Reparte una matriz que está completa en el proceso root
+     *
+     * @param global Matriz completa en root; se ignora (puede ser NULL) en
+     *        los demás procesos
+     * @throws std::invalid_argument Si en root global es NULL o no mide rows x cols
+     */
+    static DistributedMatrix scatter(const ProcessGrid& grid, const BasicMatrix<T>* global, int rows, int cols,
+                                     int block_rows = DISTRIBUTED_BLOCK, int block_cols = DISTRIBUTED_BLOCK,
+                                     int root = 0);
+
+    /**
+     * @brief Reúne la matriz completa en el proceso root
+     *
+     * @param global En root, matriz de num_rows() x num_cols() que recibe el
+     *        resultado; se ignora en los demás procesos
+     * @throws std::invalid_argument Si en root global es NULL o no tiene el tamaño correcto
+     */
+    void gather(BasicMatrix<T>* global, int root = 0) const;
+
+    /**
+     * @brief Rellena la parte local con f(i, j) en coordenadas globales
+     *
+     * No comunica: permite crear matrices que no caben en un solo nodo.
+     */
+    DistributedMatrix& generate(const std::function<T(int, int)>& f);
+
+    /**
+     * @brief Producto distribuido this × other (SUMMA)
+     *
+     * @param other Matriz sobre la misma malla con block_rows() igual a
+     *        block_cols() de this
+     * @param policy PARALLEL reparte cada producto local en el grupo de hilos
+     * @return C con bloques de block_rows() x other.block_cols()
+     * @throws std::invalid_argument Si las dimensiones, los bloques o la
+     *         malla no son compatibles
+     */
+    DistributedMatrix multiply(const DistributedMatrix& other, ExecutionPolicy policy = PARALLEL) const;
+
+    int num_rows() const { return rows; }
+    int num_cols() const { return cols; }
+    int block_rows() const { return mb; }
+    int block_cols() const { return nb; }
+    int local_rows() const { return localRows; }
+    int local_cols() const { return localCols; }
+
+    /// Elementos locales por filas, con separación local_cols()
+    T* local_data() { return local.empty() ? nullptr : &local[0]; }
+    const T* local_data() const { return local.empty() ? nullptr : &local[0]; }
+
+    /// Fila global de la fila local r
+    int global_row(int r) const;
+    /// Columna global de la columna local c
+    int global_col(int c) const;
+
+    const ProcessGrid& grid() const { return *procs; }
+
+private:
+    const ProcessGrid* procs;
+    int rows;
+    int cols;
+    int mb;
+    int nb;
+    int localRows;
+    int localCols;
+    std::vector<T> local;
+};
+
+extern template class DistributedMatrix<float>;
+extern template class DistributedMatrix<double>;
+
+} // namespace mathlib
+
+#endif
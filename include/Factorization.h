@@ -0,0 +1,176 @@
+/**
+ * @file Factorization.h
+ * @brief Factorizaciones LU y de Cholesky por bloques con resolución de sistemas
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Las factorizaciones se calculan una vez al construir el objeto y se
+ * reutilizan después para resolver tantos sistemas como haga falta, cada
+ * uno con una sustitución hacia delante y otra hacia atrás (O(n²) por
+ * columna del lado derecho en lugar de O(n³) por factorización).
+ *
+ * Ambas siguen el esquema por bloques de LAPACK: se factoriza un panel de
+ * FACTOR_BLOCK columnas y el resto de la matriz se actualiza con el
+ * kernel GEMM (gemm() o gemm_parallel()), que concentra casi todas las
+ * operaciones de la factorización.
+ *
+ * @code
+ * mathlib::LUFactorization lu(A);          // PA = LU, una sola vez
+ * for (int paso = 0; paso < pasos; ++paso) {
+ *     lu.solve_in_place(b);                 // b <- A⁻¹ b
+ * }
+ * @endcode
+ */
+
+#ifndef FACTORIZATION_H
+#define FACTORIZATION_H
+
+#include <vector>
+#include "Matrix.h"
+#include "Span.h"
+
+namespace mathlib {
+
+/// Columnas del panel que se factoriza antes de cada actualización con GEMM
+static const int FACTOR_BLOCK = 64;
+
+/**
+ * @class BasicLUFactorization
+ * @brief Factorización LU con pivoteo parcial por filas: P·A = L·U
+ *
+ * L es triangular inferior con diagonal unidad y U triangular superior;
+ * ambas se guardan juntas en una sola matriz (la diagonal de L no se
+ * almacena). Instanciada para float y double; LUFactorization es el
+ * alias para double.
+ */
+template <class T>
+class BasicLUFactorization {
+public:
+    /**
+     * @brief Factoriza una matriz cuadrada
+     *
+     * @param A Matriz n x n
+     * @param policy PARALLEL reparte las actualizaciones con GEMM entre los hilos
+     * @throws std::invalid_argument Si A no es cuadrada
+     * @throws std::runtime_error Si A es singular (un pivote es exactamente cero)
+     */
+    explicit BasicLUFactorization(const BasicMatrix<T>& A, ExecutionPolicy policy = SEQUENTIAL);
+
+    /// Dimensión n de la matriz factorizada
+    int size() const { return factors.num_rows(); }
+
+    /// L (por debajo de la diagonal, sin la diagonal unidad) y U (resto) en una matriz
+    const BasicMatrix<T>& packed() const { return factors; }
+
+    /// La fila i de P·A es la fila permutation()[i] de A
+    const std::vector<int>& permutation() const { return perm; }
+
+    /// Determinante de A
+    T determinant() const;
+
+    /**
+     * @brief Resuelve A·X = B
+     *
+     * @param B Lados derechos (n x nrhs)
+     * @return X (n x nrhs)
+     * @throws std::invalid_argument Si B no tiene n filas
+     */
+    BasicMatrix<T> solve(const BasicMatrix<T>& B) const;
+
+    /**
+     * @brief Resuelve A·X = B sobrescribiendo B con X
+     *
+     * @throws std::invalid_argument Si B no tiene n filas
+     */
+    void solve_in_place(BasicMatrix<T>& B) const;
+
+    /**
+     * @brief Resuelve A·x = b para un vector, sobrescribiendo b con x
+     *
+     * @throws std::invalid_argument Si b no tiene n elementos
+     */
+    void solve_in_place(Span<T> b) const;
+
+    /// A⁻¹ (resuelve contra la identidad; casi siempre es mejor usar solve())
+    BasicMatrix<T> inverse() const;
+
+private:
+    BasicMatrix<T> factors;   ///< L y U empaquetadas
+    std::vector<int> perm;    ///< Permutación de filas
+    int swaps;                ///< Número de intercambios de filas (signo del determinante)
+};
+
+/**
+ * @class BasicCholeskyFactorization
+ * @brief Factorización de Cholesky de una matriz simétrica definida positiva: A = L·Lᵀ
+ *
+ * Solo se lee el triángulo inferior de A. Cuesta la mitad que LU y no
+ * necesita pivoteo. Instanciada para float y double;
+ * CholeskyFactorization es el alias para double.
+ */
+template <class T>
+class BasicCholeskyFactorization {
+public:
+    /**
+     * @brief Factoriza una matriz simétrica definida positiva
+     *
+     * @param A Matriz n x n (se usa su triángulo inferior)
+     * @param policy PARALLEL reparte las actualizaciones con GEMM entre los hilos
+     * @throws std::invalid_argument Si A no es cuadrada
+     * @throws std::runtime_error Si A no es definida positiva
+     */
+    explicit BasicCholeskyFactorization(const BasicMatrix<T>& A, ExecutionPolicy policy = SEQUENTIAL);
+
+    /// Dimensión n de la matriz factorizada
+    int size() const { return factor.num_rows(); }
+
+    /// L triangular inferior (el triángulo superior queda a cero)
+    const BasicMatrix<T>& lower() const { return factor; }
+
+    /// Determinante de A
+    T determinant() const;
+
+    /**
+     * @brief Resuelve A·X = B
+     *
+     * @throws std::invalid_argument Si B no tiene n filas
+     */
+    BasicMatrix<T> solve(const BasicMatrix<T>& B) const;
+
+    /**
+     * @brief Resuelve A·X = B sobrescribiendo B con X
+     *
+     * @throws std::invalid_argument Si B no tiene n filas
+     */
+    void solve_in_place(BasicMatrix<T>& B) const;
+
+    /**
+     * @brief Resuelve A·x = b para un vector, sobrescribiendo b con x
+     *
+     * @throws std::invalid_argument Si b no tiene n elementos
+     */
+    void solve_in_place(Span<T> b) const;
+
+    /// A⁻¹
+    BasicMatrix<T> inverse() const;
+
+private:
+    BasicMatrix<T> factor;    ///< L
+};
+
+/// Factorización LU de doble precisión
+typedef BasicLUFactorization<double> LUFactorization;
+
+/// Factorización de Cholesky de doble precisión
+typedef BasicCholeskyFactorization<double> CholeskyFactorization;
+
+// Instancias compiladas en Factorization.cpp
+extern template class BasicLUFactorization<float>;
+extern template class BasicLUFactorization<double>;
+extern template class BasicCholeskyFactorization<float>;
+extern template class BasicCholeskyFactorization<double>;
+
+} // namespace mathlib
+
+#endif
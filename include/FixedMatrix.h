@@ -0,0 +1,335 @@
+/**
+ * @file FixedMatrix.h
+ * @brief Matrices de dimensiones fijas en tiempo de compilación
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * FixedMatrix<R, C, T> guarda sus R x C elementos en la propia instancia
+ * (en la pila si es una variable local), sin reservas de memoria. Las
+ * dimensiones son constantes de compilación: sumar o multiplicar
+ * matrices de formas incompatibles no compila, y todos los bucles se
+ * desenrollan por completo mediante plantillas. Pensada para
+ * transformaciones 3x3/4x4, covarianzas y otros productos diminutos.
+ *
+ * @code
+ * FixedMatrix<3, 3> R = FixedMatrix<3, 3>::identity();
+ * FixedMatrix<3, 1> p = {1.0, 2.0, 3.0};
+ * FixedMatrix<3, 1> q = R.multiply(p);
+ * // R.multiply(R.multiply(p).transpose()); // error de compilación
+ * @endcode
+ */
+
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include "Matrix.h"
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+
+namespace mathlib {
+namespace detail {
+
+/**
+ * @brief Desenrolla f(Offset), f(Offset + 1), ..., f(Offset + N - 1) en tiempo de compilación
+ *
+ * Parte el rango por la mitad en cada nivel, de modo que la profundidad
+ * de instanciación es log2(N) y no N: FixedMatrix<32, 32> y mayores
+ * compilan sin tocar el límite del compilador.
+ */
+template <int N, int Offset = 0>
+struct Unroll {
+    template <class F>
+    static void run(F& f) {
+        Unroll<N / 2, Offset>::run(f);
+        Unroll<N - N / 2, Offset + N / 2>::run(f);
+    }
+};
+
+template <int Offset>
+struct Unroll<1, Offset> {
+    template <class F>
+    static void run(F& f) {
+        f(Offset);
+    }
+};
+
+template <int Offset>
+struct Unroll<0, Offset> {
+    template <class F>
+    static void run(F&) {}
+};
+
+/**
+ * @brief Suma desenrollada de f(0) + f(1) + ... + f(N-1)
+ *
+ * Acumula de izquierda a derecha (el mismo redondeo que un bucle) sobre
+ * el desenrollado equilibrado de Unroll.
+ */
+template <int N, class T>
+struct UnrollSum {
+    template <class F>
+    static T run(F& f) {
+        T sum = f(0);
+        auto add = [&](int p) { sum = sum + f(p); };
+        Unroll<N - 1, 1>::run(add);
+        return sum;
+    }
+};
+
+} // namespace detail
+} // namespace mathlib
+
+/**
+ * @class FixedMatrix
+ * @brief Matriz R x C con almacenamiento interno y dimensiones constexpr
+ *
+ * @tparam R Número de filas (mayor que 0)
+ * @tparam C Número de columnas (mayor que 0)
+ * @tparam T Tipo de los elementos (double por defecto)
+ */
+template <int R, int C, class T = double>
+class FixedMatrix {
+    static_assert(R > 0 && C > 0, "FixedMatrix - Las dimensiones deben ser positivas");
+
+private:
+    template <int, int, class> friend class FixedMatrix;
+
+    T values[R * C];  ///< Elementos en orden por filas
+
+    /// Etiqueta del constructor que no inicializa los elementos
+    struct NoInit {};
+
+    /// Resultado que se va a sobrescribir por completo: sin el llenado con ceros
+    explicit FixedMatrix(NoInit) {}
+
+public:
+    /// Número de filas
+    static constexpr int ROWS = R;
+
+    /// Número de columnas
+    static constexpr int COLS = C;
+
+    /**
+     * @brief Constructor que crea una matriz llena de ceros
+     */
+    FixedMatrix() {
+        auto f = [this](int i) { values[i] = T(); };
+        mathlib::detail::Unroll<R * C>::run(f);
+    }
+
+    /**
+     * @brief Constructor a partir de una lista de valores en orden por filas
+     *
+     * Los elementos no indicados quedan a cero.
+     *
+     * @param init Valores iniciales (a lo sumo R * C)
+     * @throws std::invalid_argument Si la lista tiene más de R * C valores
+     *
+     * @code
+     * FixedMatrix<2, 2> m = {1, 2,
+     *                        3, 4};
+     * @endcode
+     */
+    FixedMatrix(std::initializer_list<T> init) : FixedMatrix() {
+        if (init.size() > static_cast<std::size_t>(R * C)) {
+            throw std::invalid_argument("FixedMatrix::FixedMatrix - Demasiados valores iniciales");
+        }
+        int i = 0;
+        for (typename std::initializer_list<T>::const_iterator it = init.begin(); it != init.end(); ++it) {
+            values[i++] = *it;
+        }
+    }
+
+    /**
+     * @brief Construye desde una BasicMatrix dinámica de las mismas dimensiones
+     *
+     * Los elementos se convierten con static_cast<T>.
+     *
+     * @param m Matriz de origen
+     * @throws std::invalid_argument Si m no es R x C
+     */
+    template <class U>
+    explicit FixedMatrix(const BasicMatrix<U>& m) {
+        if (m.num_rows() != R || m.num_cols() != C) {
+            throw std::invalid_argument("FixedMatrix::FixedMatrix - Las dimensiones no coinciden");
+        }
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                values[r * C + c] = static_cast<T>(m.coeff(r, c));
+            }
+        }
+    }
+
+    /**
+     * @brief Matriz identidad (solo para matrices cuadradas)
+     */
+    static FixedMatrix identity() {
+        static_assert(R == C, "FixedMatrix::identity - La matriz debe ser cuadrada");
+        FixedMatrix m;
+        auto f = [&m](int i) { m.values[i * C + i] = T(1); };
+        mathlib::detail::Unroll<R>::run(f);
+        return m;
+    }
+
+    /// Número de filas
+    static constexpr int num_rows() { return R; }
+
+    /// Número de columnas
+    static constexpr int num_cols() { return C; }
+
+    /**
+     * @brief Obtiene el valor en (r, c) con validación de límites
+     * @throws std::out_of_range Si los índices están fuera de rango
+     */
+    T get(int r, int c) const {
+        if (r < 0 || r >= R || c < 0 || c >= C) {
+            throw std::out_of_range("FixedMatrix::get - Índice fuera de rango");
+        }
+        return values[r * C + c];
+    }
+
+    /**
+     * @brief Establece el valor en (r, c) con validación de límites
+     * @throws std::out_of_range Si los índices están fuera de rango
+     */
+    void set(int r, int c, T value) {
+        if (r < 0 || r >= R || c < 0 || c >= C) {
+            throw std::out_of_range("FixedMatrix::set - Índice fuera de rango");
+        }
+        values[r * C + c] = value;
+    }
+
+    /// Acceso sin comprobación de límites
+    T& operator()(int r, int c) { return values[r * C + c]; }
+
+    /// Acceso de solo lectura sin comprobación de límites
+    const T& operator()(int r, int c) const { return values[r * C + c]; }
+
+    /// Puntero a los R * C elementos contiguos en orden por filas
+    T* data() { return values; }
+
+    /// Puntero de solo lectura a los elementos
+    const T* data() const { return values; }
+
+    /**
+     * @brief Suma elemento a elemento (las dimensiones se comprueban al compilar)
+     */
+    FixedMatrix add(const FixedMatrix& other) const {
+        FixedMatrix out((NoInit()));
+        auto f = [&](int i) { out.values[i] = values[i] + other.values[i]; };
+        mathlib::detail::Unroll<R * C>::run(f);
+        return out;
+    }
+
+    /**
+     * @brief Resta elemento a elemento
+     */
+    FixedMatrix subtract(const FixedMatrix& other) const {
+        FixedMatrix out((NoInit()));
+        auto f = [&](int i) { out.values[i] = values[i] - other.values[i]; };
+        mathlib::detail::Unroll<R * C>::run(f);
+        return out;
+    }
+
+    /**
+     * @brief Multiplica todos los elementos por un escalar
+     */
+    FixedMatrix scale(T alpha) const {
+        FixedMatrix out((NoInit()));
+        auto f = [&](int i) { out.values[i] = alpha * values[i]; };
+        mathlib::detail::Unroll<R * C>::run(f);
+        return out;
+    }
+
+    /**
+     * @brief Producto matricial R x C por C x K, desenrollado por completo
+     *
+     * Solo acepta operandos con C filas: cualquier otra forma es un error
+     * de compilación.
+     *
+     * @tparam K Columnas de la otra matriz
+     * @param other Matriz C x K
+     * @return Matriz R x K
+     */
+    template <int K>
+    FixedMatrix<R, K, T> multiply(const FixedMatrix<C, K, T>& other) const {
+        FixedMatrix<R, K, T> out((typename FixedMatrix<R, K, T>::NoInit()));
+        auto cell = [&](int idx) {
+            const int i = idx / K;
+            const int j = idx % K;
+            auto term = [&](int p) { return values[i * C + p] * other(p, j); };
+            out(i, j) = mathlib::detail::UnrollSum<C, T>::run(term);
+        };
+        mathlib::detail::Unroll<R * K>::run(cell);
+        return out;
+    }
+
+    /**
+     * @brief Transpuesta C x R
+     */
+    FixedMatrix<C, R, T> transpose() const {
+        FixedMatrix<C, R, T> out((typename FixedMatrix<C, R, T>::NoInit()));
+        auto f = [&](int idx) { out(idx % C, idx / C) = values[idx]; };
+        mathlib::detail::Unroll<R * C>::run(f);
+        return out;
+    }
+
+    /**
+     * @brief Copia los elementos a una BasicMatrix<T> dinámica R x C
+     */
+    BasicMatrix<T> to_matrix() const {
+        BasicMatrix<T> m(R, C, BasicMatrix<T>::UNINITIALIZED);
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                m.data()[r * m.stride() + c] = values[r * C + c];
+            }
+        }
+        return m;
+    }
+
+    /**
+     * @brief Imprime la matriz en la salida estándar
+     *
+     * Mismo formato que Matrix::print(): valores separados por un espacio,
+     * sin espacio al final de la fila.
+     */
+    void print() const {
+        for (int r = 0; r < R; ++r) {
+            for (int c = 0; c < C; ++c) {
+                if (c > 0) {
+                    std::cout << ' ';
+                }
+                std::cout << values[r * C + c];
+            }
+            std::cout << "\n";
+        }
+    }
+
+    /// Suma elemento a elemento
+    friend FixedMatrix operator+(const FixedMatrix& a, const FixedMatrix& b) { return a.add(b); }
+
+    /// Resta elemento a elemento
+    friend FixedMatrix operator-(const FixedMatrix& a, const FixedMatrix& b) { return a.subtract(b); }
+
+    /// Producto escalar × matriz
+    friend FixedMatrix operator*(T alpha, const FixedMatrix& a) { return a.scale(alpha); }
+
+    /// Producto matriz × escalar
+    friend FixedMatrix operator*(const FixedMatrix& a, T alpha) { return a.scale(alpha); }
+};
+
+template <int R, int C, class T>
+constexpr int FixedMatrix<R, C, T>::ROWS;
+
+template <int R, int C, class T>
+constexpr int FixedMatrix<R, C, T>::COLS;
+
+/// Alias para transformaciones 3x3
+typedef FixedMatrix<3, 3> Matrix3;
+
+/// Alias para transformaciones homogéneas 4x4
+typedef FixedMatrix<4, 4> Matrix4;
+
+#endif
@@ -0,0 +1,487 @@
+/**
+ * @file Gemm.h
+ * @brief Motor de multiplicación de matrices por bloques (GEMM)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Este archivo declara los kernels de bajo nivel que usa Matrix::multiply.
+ * Trabajan sobre bloques contiguos en orden por filas descritos por un
+ * puntero y una separación entre filas (leading dimension), por lo que
+ * pueden aplicarse directamente sobre Matrix::data().
+ *
+ * Los kernels son plantillas sobre el tipo de elemento T y están
+ * instanciados para float, double, int y std::complex<double>. float y
+ * double usan los micro-kernels SIMD; el resto el micro-kernel escalar
+ * genérico.
+ */
+
+#ifndef GEMM_H
+#define GEMM_H
+
+#include <cstddef>
+
+namespace mathlib {
+
+class ThreadPool;
+
+/**
+ * @enum ExecutionPolicy
+ * @brief Política de ejecución de las operaciones que admiten paralelismo
+ */
+enum ExecutionPolicy {
+    SEQUENTIAL,  ///< Ejecutar en el hilo llamante
+    PARALLEL     ///< Repartir el trabajo en teselas sobre el grupo de hilos
+};
+
+/**
+ * @enum Transpose
+ * @brief Indica si un operando del producto se usa tal cual o transpuesto
+ *
+ * Con TRANS el operando se lee como su transpuesta directamente desde su
+ * almacenamiento (el empaquetado de GEMM reordena los elementos), sin
+ * construir una copia transpuesta.
+ */
+enum Transpose {
+    NO_TRANS,  ///< op(X) = X
+    TRANS      ///< op(X) = Xᵀ
+};
+
+/**
+ * @enum MultiplyAlgorithm
+ * @brief Algoritmo usado por el producto de matrices
+ */
+enum MultiplyAlgorithm {
+    MULTIPLY_CLASSIC,   ///< Producto O(n³) por bloques (exacto al orden habitual de redondeo)
+    MULTIPLY_STRASSEN   ///< Recursión de Strassen-Winograd sobre el producto por bloques
+};
+
+/// Tamaño por defecto por debajo del cual Strassen-Winograd pasa al kernel por bloques
+static const int STRASSEN_DEFAULT_CROSSOVER = 512;
+
+/**
+ * @brief Punto de corte de Strassen-Winograd calibrado para este equipo
+ *
+ * @return tuning().strassen_crossover, que vale STRASSEN_DEFAULT_CROSSOVER
+ *         si no hay fichero de calibración (véase Tuning.h)
+ */
+int default_strassen_crossover();
+
+/**
+ * @struct MultiplyOptions
+ * @brief Selección de algoritmo y política para Matrix::multiply
+ *
+ * @code
+ * mathlib::MultiplyOptions opts;
+ * opts.algorithm = mathlib::MULTIPLY_STRASSEN;
+ * opts.strassen_crossover = 1024;
+ * Matrix C = A.multiply(B, opts);
+ *
+ * mathlib::MultiplyOptions abt;
+ * abt.trans_b = mathlib::TRANS;
+ * Matrix G = A.multiply(B, abt);       // A × Bᵀ sin copiar Bᵀ
+ * @endcode
+ */
+struct MultiplyOptions {
+    MultiplyAlgorithm algorithm;  ///< Algoritmo del producto
+    ExecutionPolicy policy;       ///< Política de los productos por bloques
+    int strassen_crossover;       ///< Dimensión mínima de las hojas de la recursión
+    Transpose trans_a;            ///< Usar la transpuesta del operando izquierdo
+    Transpose trans_b;            ///< Usar la transpuesta del operando derecho
+
+    explicit MultiplyOptions(ExecutionPolicy policy = SEQUENTIAL)
+        : algorithm(MULTIPLY_CLASSIC), policy(policy),
+          strassen_crossover(default_strassen_crossover()),
+          trans_a(NO_TRANS), trans_b(NO_TRANS) {}
+};
+
+/**
+ * @enum Activation
+ * @brief Función aplicada a cada elemento de C al terminar el producto
+ */
+enum Activation {
+    ACTIVATION_NONE,    ///< Sin activación
+    ACTIVATION_RELU     ///< max(c, 0); no admitida para std::complex<double>
+};
+
+/**
+ * @struct GemmEpilogue
+ * @brief Operaciones elemento a elemento fusionadas al final de GEMM
+ *
+ * Se aplican a cada tesela de C justo después de calcularse su último
+ * bloque de la dimensión compartida, mientras sigue en caché, en el orden
+ * C(i, j) = activation(C(i, j) + bias[j]). Evitan las pasadas extra que
+ * harían falta para sumar el sesgo y aplicar la activación después.
+ *
+ * @code
+ * mathlib::GemmEpilogue<double> capa;
+ * capa.bias = b.data();                    // n elementos
+ * capa.activation = mathlib::ACTIVATION_RELU;
+ * Y.gemm(1.0, X, W, 0.0, mathlib::MultiplyOptions(), capa);   // Y = relu(X·W + b)
+ * @endcode
+ */
+template <class T>
+struct GemmEpilogue {
+    const T* bias;              ///< Sesgo por columna de C (n elementos), o nullptr
+    Activation activation;      ///< Activación aplicada tras el sesgo
+
+    GemmEpilogue() : bias(nullptr), activation(ACTIVATION_NONE) {}
+};
+
+/**
+ * @struct GemmBlocking
+ * @brief Tamaños de bloque usados por el kernel GEMM empaquetado
+ *
+ * Siguen el esquema de Goto/BLIS: un panel de B de kc x nc que reside en
+ * L3, un bloque de A de mc x kc que reside en L2 y micro-paneles de
+ * kc x nr que residen en L1 mientras el micro-kernel recorre A.
+ */
+struct GemmBlocking {
+    int mc;  ///< Filas de A empaquetadas por bloque (múltiplo de mr)
+    int kc;  ///< Profundidad del bloque (dimensión compartida)
+    int nc;  ///< Columnas de B empaquetadas por panel (múltiplo de nr)
+    int mr;  ///< Filas de la tesela del micro-kernel activo
+    int nr;  ///< Columnas de la tesela del micro-kernel activo
+};
+
+/**
+ * @brief Tamaños de bloque calculados a partir de la jerarquía de caché
+ *
+ * Los tamaños de L1, L2 y L3 se consultan al sistema una sola vez; los
+ * bloques se ajustan además a la tesela del micro-kernel SIMD activo
+ * (véase Kernels.h). Si el sistema no informa los tamaños se usan
+ * valores conservadores (32 KiB, 256 KiB y 2 MiB).
+ *
+ * @tparam T Tipo de elemento; determina la tesela y el tamaño de los bloques
+ * @return Tamaños de bloque para este equipo y nivel SIMD
+ */
+template <class T>
+GemmBlocking gemm_blocking();
+
+/**
+ * @brief Producto de referencia C = A × B mediante el triple bucle i-j-k
+ *
+ * Implementación directa sin bloqueo, conservada como referencia para
+ * validar los kernels optimizados y para matrices muy pequeñas.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param A Puntero a A (m x k) con separación lda
+ * @param lda Separación entre filas de A
+ * @param B Puntero a B (k x n) con separación ldb
+ * @param ldb Separación entre filas de B
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ */
+template <class T>
+void gemm_reference(int m, int n, int k,
+                    const T* A, int lda,
+                    const T* B, int ldb,
+                    T* C, int ldc);
+
+/**
+ * @brief Producto C = A × B con empaquetado por bloques y micro-kernel SIMD
+ *
+ * Empaqueta paneles de A y B en bloques que caben en L2/L1 y calcula C
+ * en teselas de mr x nr mantenidas en registros por el micro-kernel del
+ * nivel SIMD activo (en double: 4x8 escalar, 6x8
+ * AVX2, 8x16 AVX-512, ...; en float el doble de columnas). No
+ * necesita que C esté inicializada: su contenido previo se sobrescribe.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param A Puntero a A (m x k) con separación lda
+ * @param lda Separación entre filas de A
+ * @param B Puntero a B (k x n) con separación ldb
+ * @param ldb Separación entre filas de B
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ */
+template <class T>
+void gemm_blocked(int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc);
+
+/**
+ * @brief Producto C = A × B eligiendo el kernel adecuado al tamaño
+ *
+ * Usa gemv() cuando B tiene una sola columna o A una sola fila,
+ * gemm_reference() cuando el volumen de trabajo m·n·k es tan pequeño que
+ * el empaquetado no compensa, y gemm_blocked() en otro caso.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param A Puntero a A (m x k) con separación lda
+ * @param lda Separación entre filas de A
+ * @param B Puntero a B (k x n) con separación ldb
+ * @param ldb Separación entre filas de B
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ */
+template <class T>
+void gemm(int m, int n, int k,
+          const T* A, int lda,
+          const T* B, int ldb,
+          T* C, int ldc);
+
+/**
+ * @brief Producto C = A × B repartido en teselas sobre un grupo de hilos
+ *
+ * Divide C en teselas independientes (múltiplos de la tesela del
+ * micro-kernel) y calcula cada una con gemm_blocked() en un hilo del
+ * grupo. Si el volumen de trabajo es pequeño o el grupo tiene un solo
+ * hilo se ejecuta gemm() en serie, para no pagar la sincronización.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param A Puntero a A (m x k) con separación lda
+ * @param lda Separación entre filas de A
+ * @param B Puntero a B (k x n) con separación ldb
+ * @param ldb Separación entre filas de B
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ * @param pool Grupo de hilos a usar
+ */
+template <class T>
+void gemm_parallel(int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   ThreadPool& pool);
+
+/**
+ * @brief Producto C = op(A) × op(B) con operandos opcionalmente transpuestos
+ *
+ * Versión con transposición de gemm_reference(), para validar las
+ * variantes transpuestas de los kernels.
+ *
+ * @param transA TRANS para usar Aᵀ: A se almacena como k x m
+ * @param transB TRANS para usar Bᵀ: B se almacena como n x k
+ * @param m Filas de op(A) y de C
+ * @param n Columnas de op(B) y de C
+ * @param k Columnas de op(A) y filas de op(B)
+ * @param A Puntero a A con separación lda
+ * @param lda Separación entre filas de A tal como está almacenada
+ * @param B Puntero a B con separación ldb
+ * @param ldb Separación entre filas de B tal como está almacenada
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ */
+template <class T>
+void gemm_reference(Transpose transA, Transpose transB, int m, int n, int k,
+                    const T* A, int lda,
+                    const T* B, int ldb,
+                    T* C, int ldc);
+
+/**
+ * @brief Producto C = op(A) × op(B) por bloques con operandos opcionalmente transpuestos
+ *
+ * La transposición se resuelve al empaquetar los paneles, que ya copian
+ * cada bloque en el orden del micro-kernel; por eso A × Bᵀ o Aᵀ × B
+ * cuestan prácticamente lo mismo que A × B y no necesitan memoria extra.
+ *
+ * @param transA TRANS para usar Aᵀ: A se almacena como k x m
+ * @param transB TRANS para usar Bᵀ: B se almacena como n x k
+ * @param m Filas de op(A) y de C
+ * @param n Columnas de op(B) y de C
+ * @param k Columnas de op(A) y filas de op(B)
+ * @param A Puntero a A con separación lda
+ * @param lda Separación entre filas de A tal como está almacenada
+ * @param B Puntero a B con separación ldb
+ * @param ldb Separación entre filas de B tal como está almacenada
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe
+ * @param ldc Separación entre filas de C
+ */
+template <class T>
+void gemm_blocked(Transpose transA, Transpose transB, int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc);
+
+/**
+ * @brief Producto C = op(A) × op(B) eligiendo el kernel adecuado al tamaño
+ *
+ * Igual que gemm() con los operandos transpuestos según transA y
+ * transB (véase gemm_blocked()).
+ *
+ * @code
+ * // Gradiente de una capa lineal: dW = dYᵀ × X
+ * mathlib::gemm(mathlib::TRANS, mathlib::NO_TRANS, out, in, batch,
+ *               dY.data(), dY.stride(), X.data(), X.stride(),
+ *               dW.data(), dW.stride());
+ * @endcode
+ */
+template <class T>
+void gemm(Transpose transA, Transpose transB, int m, int n, int k,
+          const T* A, int lda,
+          const T* B, int ldb,
+          T* C, int ldc);
+
+/**
+ * @brief Producto C = op(A) × op(B) repartido en teselas sobre un grupo de hilos
+ *
+ * Igual que gemm_parallel() con los operandos transpuestos según
+ * transA y transB.
+ */
+template <class T>
+void gemm_parallel(Transpose transA, Transpose transB, int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   ThreadPool& pool);
+
+/**
+ * @brief Producto fusionado C = epilogue(alpha · op(A) × op(B) + beta · C)
+ *
+ * Las dos escalas y el epílogo se aplican dentro del producto por
+ * bloques: alpha al empaquetar los paneles de A, beta a cada tesela de C
+ * justo antes de que el micro-kernel acumule sobre ella su primer bloque
+ * y el epílogo tras el último. C se lee y escribe una sola vez por
+ * bloque de la dimensión compartida, sin temporales. Con beta == 0 el
+ * contenido previo de C no se lee.
+ *
+ * @param alpha Escala del producto
+ * @param beta Escala del valor previo de C
+ * @param C Puntero a C (m x n) con separación ldc; no debe solaparse con A ni con B
+ * @param epilogue Sesgo por columna y activación (por defecto ninguno)
+ * @throws std::invalid_argument Si se pide ACTIVATION_RELU con complejos
+ */
+template <class T>
+void gemm(Transpose transA, Transpose transB, int m, int n, int k,
+          T alpha, const T* A, int lda,
+          const T* B, int ldb,
+          T beta, T* C, int ldc,
+          const GemmEpilogue<T>& epilogue = GemmEpilogue<T>());
+
+/**
+ * @brief Producto fusionado repartido en teselas sobre un grupo de hilos
+ *
+ * Igual que el gemm() fusionado; cada hilo aplica beta y el epílogo a
+ * sus propias teselas.
+ */
+template <class T>
+void gemm_parallel(Transpose transA, Transpose transB, int m, int n, int k,
+                   T alpha, const T* A, int lda,
+                   const T* B, int ldb,
+                   T beta, T* C, int ldc,
+                   ThreadPool& pool,
+                   const GemmEpilogue<T>& epilogue = GemmEpilogue<T>());
+
+/**
+ * @brief Producto matriz-vector y = alpha · op(A) · x + beta · y (GEMV)
+ *
+ * Con NO_TRANS cada y(i) es el producto escalar de la fila i de A por x,
+ * calculado cuatro filas a la vez con el kernel SIMD activo. Con TRANS se
+ * acumulan las filas de A escaladas por x(i) con vec_axpy() sobre bloques
+ * de columnas de y que caben en L1. En ambos casos A se lee una sola vez
+ * por sus filas, sin empaquetar. Con beta == 0 y no se lee (puede estar
+ * sin inicializar).
+ *
+ * gemm() usa esta función cuando op(B) tiene una sola columna u op(A) una
+ * sola fila.
+ *
+ * @param trans TRANS para usar Aᵀ
+ * @param m Filas de A tal como está almacenada
+ * @param n Columnas de A tal como está almacenada
+ * @param alpha Escala del producto
+ * @param A Puntero a A (m x n) con separación lda
+ * @param lda Separación entre filas de A
+ * @param x Vector contiguo de n elementos (NO_TRANS) o m (TRANS)
+ * @param beta Escala del valor previo de y
+ * @param y Vector contiguo de m elementos (NO_TRANS) o n (TRANS); no debe
+ *        solaparse con A ni con x
+ */
+template <class T>
+void gemv(Transpose trans, int m, int n, T alpha,
+          const T* A, int lda,
+          const T* x, T beta, T* y);
+
+/**
+ * @brief GEMV repartido sobre un grupo de hilos
+ *
+ * Con NO_TRANS cada hilo calcula un bloque de filas de y; con TRANS un
+ * bloque de columnas, recorriendo todas las filas de A restringidas a
+ * esas columnas, de modo que no hacen falta sumas parciales. Si A tiene
+ * pocos elementos o el grupo un solo hilo se ejecuta gemv() en serie.
+ */
+template <class T>
+void gemv_parallel(Transpose trans, int m, int n, T alpha,
+                   const T* A, int lda,
+                   const T* x, T beta, T* y,
+                   ThreadPool& pool);
+
+/**
+ * @brief Elementos de espacio de trabajo que necesita gemm_strassen()
+ *
+ * Incluye los temporales de todos los niveles de la recursión y, si
+ * alguna dimensión no es múltiplo de 2^niveles, las copias rellenadas
+ * con ceros de A, B y C.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param crossover Dimensión mínima de las hojas de la recursión (>= 1)
+ * @return Número de elementos de tipo T
+ */
+template <class T>
+std::size_t gemm_strassen_workspace(int m, int n, int k, int crossover);
+
+/**
+ * @brief Producto C = A × B con la recursión de Strassen-Winograd
+ *
+ * Cada nivel divide A, B y C en cuatro bloques y sustituye los ocho
+ * productos de bloques por siete (variante de Winograd: 7 productos y
+ * 15 sumas). Se baja un nivel mientras las tres dimensiones a la mitad
+ * sigan siendo >= crossover; las hojas se calculan con gemm() (o con
+ * gemm_parallel() sobre el grupo global con PARALLEL). Si ninguna
+ * dimensión llega a 2·crossover se calcula directamente con el producto
+ * por bloques. Las dimensiones que no son múltiplo de 2^niveles se
+ * rellenan con ceros en copias dentro del espacio de trabajo.
+ *
+ * Precisión: el resultado no cumple la cota elemento a elemento del
+ * producto clásico, |C - Ĉ| <= k·u·|A|·|B|, sino solo una cota en norma
+ * (Higham, Accuracy and Stability of Numerical Algorithms, §23.2.2):
+ *
+ *     max|C - Ĉ| <= [(k/k0)^log2(18) · (k0² + 6·k0) - 6·k] · u · max|A| · max|B|
+ *
+ * con u el épsilon de la máquina / 2 y k0 = k / 2^niveles la dimensión
+ * de las hojas. Cada nivel multiplica la cota por unas 4,5 veces
+ * respecto a la del producto clásico de la misma dimensión. Los
+ * elementos pequeños de C pueden tener un error relativo grande cuando
+ * A o B tienen elementos de magnitudes muy distintas; conviene evitarlo
+ * con matrices mal escaladas. En la práctica la cota es pesimista: con
+ * datos uniformes en [0, 1], n = 4096 y crossover 512 (3 niveles) el
+ * error máximo observado en double es unas 1,2 veces el del producto
+ * clásico.
+ *
+ * @param m Filas de A y de C
+ * @param n Columnas de B y de C
+ * @param k Columnas de A y filas de B
+ * @param A Puntero a A (m x k) con separación lda
+ * @param lda Separación entre filas de A
+ * @param B Puntero a B (k x n) con separación ldb
+ * @param ldb Separación entre filas de B
+ * @param C Puntero a C (m x n) con separación ldc; se sobrescribe; no
+ *        debe solaparse con A ni con B
+ * @param ldc Separación entre filas de C
+ * @param crossover Dimensión mínima de las hojas de la recursión (>= 1)
+ * @param workspace gemm_strassen_workspace() elementos reservados por el
+ *        llamante, o nullptr para que la función los reserve una vez
+ * @param policy PARALLEL calcula las hojas con gemm_parallel()
+ */
+template <class T>
+void gemm_strassen(int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   int crossover, T* workspace = nullptr,
+                   ExecutionPolicy policy = SEQUENTIAL);
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file Kernels.h
+ * @brief Kernels vectorizados con selección en tiempo de ejecución
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Este archivo declara la capa de despacho de kernels. Al primer uso se
+ * detectan las extensiones SIMD del procesador (SSE2, AVX2+FMA, AVX-512F
+ * o NEON) y todas las operaciones elemento a elemento y el micro-kernel
+ * de multiplicación, tanto en float como en double, se enrutan a la
+ * variante más rápida disponible. El mismo binario funciona así en
+ * cualquier equipo de la flota sin necesidad de compilar con
+ * -march=native.
+ *
+ * La variable de entorno MATHLIB_SIMD (scalar, sse2, avx2, avx512, neon)
+ * permite limitar el nivel elegido al arrancar, por ejemplo para
+ * reproducir en un equipo moderno el comportamiento de uno antiguo.
+ */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <cstddef>
+
+namespace mathlib {
+
+/**
+ * @enum SimdLevel
+ * @brief Conjuntos de instrucciones para los que existen kernels
+ */
+enum SimdLevel {
+    SIMD_SCALAR = 0,  ///< C++ portable sin intrínsecos
+    SIMD_SSE2,        ///< x86 SSE2 (registros de 128 bits)
+    SIMD_AVX2,        ///< x86 AVX2 + FMA (registros de 256 bits)
+    SIMD_AVX512,      ///< x86 AVX-512F (registros de 512 bits)
+    SIMD_NEON         ///< ARMv8 Advanced SIMD (registros de 128 bits)
+};
+
+/**
+ * @brief Nivel SIMD que usan actualmente los kernels
+ *
+ * @return Nivel activo
+ *
+ * @code
+ * std::cout << "Kernels: " << mathlib::simd_level_name(mathlib::simd_level()) << "\n";
+ * @endcode
+ */
+SimdLevel simd_level();
+
+/**
+ * @brief Nombre legible de un nivel SIMD ("scalar", "sse2", "avx2", ...)
+ *
+ * @param level Nivel a describir
+ * @return Cadena estática con el nombre
+ */
+const char* simd_level_name(SimdLevel level);
+
+/**
+ * @brief Indica si el procesador y el binario admiten un nivel SIMD
+ *
+ * @param level Nivel a consultar
+ * @return true si los kernels de ese nivel pueden ejecutarse en este equipo
+ */
+bool simd_supported(SimdLevel level);
+
+/**
+ * @brief Fuerza el uso de un nivel SIMD concreto
+ *
+ * Pensado para pruebas y diagnóstico. No debe llamarse mientras otros
+ * hilos ejecutan operaciones con matrices.
+ *
+ * @param level Nivel deseado
+ * @return true si el nivel es compatible y quedó activo; false si no se cambió
+ */
+bool set_simd_level(SimdLevel level);
+
+/**
+ * @brief out[i] = a[i] + b[i] para i en [0, n)
+ *
+ * Existen variantes vectorizadas para double y float; para el resto de
+ * tipos se usa la plantilla genérica.
+ */
+void vec_add(std::size_t n, const double* a, const double* b, double* out);
+void vec_add(std::size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = a[i] - b[i] para i en [0, n)
+ */
+void vec_sub(std::size_t n, const double* a, const double* b, double* out);
+void vec_sub(std::size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = a[i] * b[i] para i en [0, n) (producto de Hadamard)
+ */
+void vec_mul(std::size_t n, const double* a, const double* b, double* out);
+void vec_mul(std::size_t n, const float* a, const float* b, float* out);
+
+/**
+ * @brief out[i] = alpha * a[i] para i en [0, n)
+ */
+void vec_scale(std::size_t n, double alpha, const double* a, double* out);
+void vec_scale(std::size_t n, float alpha, const float* a, float* out);
+
+/**
+ * @brief y[i] += alpha * x[i] para i en [0, n)
+ */
+void vec_axpy(std::size_t n, double alpha, const double* x, double* y);
+void vec_axpy(std::size_t n, float alpha, const float* x, float* y);
+
+/**
+ * @brief Producto escalar: suma de a[i] * b[i] para i en [0, n)
+ *
+ * n no debe superar el mayor int.
+ */
+double vec_dot(std::size_t n, const double* a, const double* b);
+float vec_dot(std::size_t n, const float* a, const float* b);
+
+/// Suma genérica para tipos sin variante vectorizada
+template <class T>
+void vec_add(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] + b[i];
+}
+
+/// Resta genérica para tipos sin variante vectorizada
+template <class T>
+void vec_sub(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] - b[i];
+}
+
+/// Producto elemento a elemento genérico
+template <class T>
+void vec_mul(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] * b[i];
+}
+
+/// Escalado genérico
+template <class T>
+void vec_scale(std::size_t n, T alpha, const T* a, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = alpha * a[i];
+}
+
+/// axpy genérico
+template <class T>
+void vec_axpy(std::size_t n, T alpha, const T* x, T* y) {
+    for (std::size_t i = 0; i < n; ++i) y[i] += alpha * x[i];
+}
+
+/// Producto escalar genérico
+template <class T>
+T vec_dot(std::size_t n, const T* a, const T* b) {
+    T acc = T();
+    for (std::size_t i = 0; i < n; ++i) acc += a[i] * b[i];
+    return acc;
+}
+
+} // namespace mathlib
+
+#endif
@@ -13,14 +13,34 @@
 #ifndef MATRIX_H
 #define MATRIX_H
 
+#include <atomic>
 #include <vector>
 #include <stdexcept>
+#include <cstddef>
+#include <complex>
+#include <type_traits>
+#include <cassert>
+#include "Gemm.h"
+#include "MatrixExpr.h"
+#include "Allocator.h"
+#include "Span.h"
+#include "MatrixView.h"
+
+namespace mathlib {
+template <class T>
+class BasicVector;
+}
 
 /**
- * @class Matrix
+ * @class BasicMatrix
  * @brief Clase que representa una matriz matemática y sus operaciones
+ *
+ * @tparam T Tipo de los elementos. La biblioteca está instanciada para
+ *         float, double, int y std::complex<double>; float y double usan
+ *         los kernels SIMD y el resto las versiones escalares genéricas.
+ *         Matrix es el alias de BasicMatrix<double>.
  * 
- * La clase Matrix proporciona una implementación orientada a objetos
+ * La clase BasicMatrix proporciona una implementación orientada a objetos
  * para trabajar con matrices de dimensiones arbitrarias. Incluye
  * operaciones básicas como suma y multiplicación, validación de
  * dimensiones y manejo robusto de errores mediante excepciones.
@@ -28,15 +48,102 @@
  * @note Todas las operaciones siguen los principios SOLID y promueven
  * la reutilización de código.
  * 
+ * BasicMatrix participa además en las plantillas de expresión de
+ * MatrixExpr.h: A + B, A - B y alpha * A se evalúan de forma diferida y
+ * fusionada al asignarse a una matriz.
+ * 
+ * Las copias son O(1): comparten el bloque de datos, con un contador de
+ * referencias atómico, hasta que una de ellas llama a un método que la
+ * modifica (set(), fill(), data() o row() no constantes, +=...), que la
+ * pasa antes a un bloque propio con make_unique() (copia al escribir).
+ * clone() hace la copia profunda de inmediato. operator() no constante
+ * no comprueba nada, para que los bucles críticos no paguen una lectura
+ * atómica por elemento: tras copiar la matriz hay que llamar a
+ * make_unique() (o a cualquiera de esos métodos) antes de escribir con
+ * él. Del mismo modo, copiar la matriz invalida para escritura los
+ * punteros, filas y vistas obtenidos antes: escribir con ellos cambiaría
+ * también la copia, así que se piden de nuevo después de la última copia.
+ * 
  * @see https://github.com/tu-usuario/MathLib para más información
  */
-class Matrix {
+template <class T>
+class BasicMatrix : public MatrixExpr<BasicMatrix<T> > {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "BasicMatrix - El tipo de elemento debe poder copiarse con memcpy");
+
 private:
-    std::vector<std::vector<double>> data;  ///< Almacenamiento interno de los datos de la matriz (fila x columna)
+    T* elements;                            ///< Bloque contiguo y alineado con los datos en orden por filas (row-major)
     int rows;                               ///< Número de filas de la matriz
     int cols;                               ///< Número de columnas de la matriz
+    int ld;                                 ///< Separación entre filas consecutivas (leading dimension), en elementos
+    mathlib::MatrixAllocator* allocator;    ///< Asignador que reservó el bloque de datos
+
+    /**
+     * @brief Número de matrices que comparten el bloque de datos
+     *
+     * El contador ocupa los primeros bytes de la cabecera de ALIGNMENT
+     * bytes que precede a elements dentro de la misma reserva.
+     */
+    std::atomic<int>& references() const {
+        return *reinterpret_cast<std::atomic<int>*>(reinterpret_cast<char*>(elements) - ALIGNMENT);
+    }
+
+    /**
+     * @brief Pasa de un bloque compartido a uno propio
+     *
+     * @param keep Copiar el contenido (false si se va a sobrescribir completo)
+     */
+    void detach(bool keep);
+
+    /**
+     * @brief Ajusta las dimensiones reutilizando el bloque si es posible
+     *
+     * Solo reserva un bloque nuevo si cambia el número de elementos. El
+     * contenido queda sin especificar.
+     */
+    void reshapeUninitialized(int r, int c);
+
+    /**
+     * @brief Escribe en esta matriz el valor de una expresión, en un solo recorrido
+     *
+     * Es seguro aunque la expresión contenga a esta misma matriz, ya que
+     * cada elemento solo depende de los elementos en la misma posición.
+     */
+    template <class E>
+    void assignExpr(const E& expr) {
+        make_unique();
+        for (int i = 0; i < rows; ++i) {
+            T* out = elements + static_cast<std::size_t>(i) * ld;
+            for (int j = 0; j < cols; ++j) {
+                out[j] = expr.coeff(i, j);
+            }
+        }
+    }
 
 public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Etiqueta para construir una matriz sin inicializar sus elementos
+     *
+     * Evita el llenado con ceros cuando el bloque se va a sobrescribir
+     * completo inmediatamente (por ejemplo, como destino de multiply_into).
+     */
+    struct Uninitialized {};
+
+    /// Valor de la etiqueta Uninitialized
+    static const Uninitialized UNINITIALIZED;
+
+    /**
+     * @brief Alineación en bytes del bloque de datos de cada matriz
+     *
+     * Coincide con el tamaño de una línea de caché y con el ancho de un
+     * registro AVX-512, de modo que los kernels vectorizados puedan usar
+     * cargas alineadas sobre la primera fila.
+     */
+    static const std::size_t ALIGNMENT = mathlib::MATRIX_ALIGNMENT;
+
     /**
      * @brief Constructor que crea una matriz de dimensiones específicas
      * 
@@ -52,7 +159,283 @@ public:
      * Matrix m(3, 4); // Crea matriz 3x4 llena de ceros
      * @endcode
      */
-    Matrix(int r, int c);
+    BasicMatrix(int r, int c);
+
+    /**
+     * @brief Constructor que reserva una matriz sin inicializar sus elementos
+     * 
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @throws std::invalid_argument Si las dimensiones no son positivas
+     * 
+     * @warning Los valores iniciales son indeterminados; deben escribirse
+     * todos antes de leerlos.
+     * 
+     * @code
+     * Matrix out(512, 512, Matrix::UNINITIALIZED);
+     * A.multiply_into(B, out);
+     * @endcode
+     */
+    BasicMatrix(int r, int c, Uninitialized);
+
+    /**
+     * @brief Constructor que reserva los datos con un asignador concreto
+     * 
+     * Inicializa todos los elementos a 0.0.
+     * 
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @param alloc Asignador del bloque; debe vivir más que la matriz
+     * @throws std::invalid_argument Si las dimensiones no son positivas
+     * 
+     * @code
+     * mathlib::PoolAllocator pool;
+     * Matrix m(4, 4, pool);
+     * @endcode
+     */
+    BasicMatrix(int r, int c, mathlib::MatrixAllocator& alloc);
+
+    /**
+     * @brief Constructor sin inicializar con un asignador concreto
+     * 
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @param alloc Asignador del bloque; debe vivir más que la matriz
+     * @throws std::invalid_argument Si las dimensiones no son positivas
+     */
+    BasicMatrix(int r, int c, Uninitialized, mathlib::MatrixAllocator& alloc);
+
+    /**
+     * @brief Constructor de copia en O(1): comparte el bloque de datos
+     *
+     * Si other se reservó con un asignador distinto del asignador actual
+     * del hilo, la copia es profunda con el asignador actual.
+     *
+     * @param other Matriz a copiar
+     */
+    BasicMatrix(const BasicMatrix& other);
+
+    /**
+     * @brief Asignación por copia en O(1): comparte el bloque de other
+     *
+     * Si other usa otro asignador, la matriz conserva el suyo y copia los
+     * elementos, reutilizando el bloque actual si es propio y tiene el
+     * mismo número de elementos.
+     *
+     * @param other Matriz a copiar
+     * @return Referencia a esta matriz
+     */
+    BasicMatrix& operator=(const BasicMatrix& other);
+
+    /**
+     * @brief Copia profunda en un bloque propio, reservado con el asignador actual
+     *
+     * @code
+     * Matrix privada = compartida.clone();  // no comparte nada con compartida
+     * @endcode
+     */
+    BasicMatrix clone() const;
+
+    /**
+     * @brief Indica si otra matriz comparte el bloque de datos con esta
+     *
+     * @return false para una matriz vacía o con bloque propio
+     */
+    bool is_shared() const {
+        return elements != NULL && references().load(std::memory_order_acquire) > 1;
+    }
+
+    /**
+     * @brief Pasa a un bloque propio si el actual está compartido con una copia
+     *
+     * Es el único punto de desacople: lo llaman todos los métodos que
+     * modifican la matriz salvo operator(). Los punteros, filas y vistas
+     * obtenidos antes dejan de apuntar a los datos de esta matriz.
+     *
+     * @code
+     * Matrix B = A;         // comparte el bloque con A
+     * B.make_unique();      // bloque propio: A no cambia
+     * for (int i = 0; i < n; ++i) B(i, i) = 0.0;
+     * @endcode
+     */
+    void make_unique() {
+        if (is_shared()) {
+            detach(true);
+        }
+    }
+
+    /**
+     * @brief Constructor de movimiento (toma el bloque de datos sin copiarlo)
+     *
+     * La matriz de origen queda vacía (0 x 0) y solo puede destruirse o
+     * recibir una asignación.
+     *
+     * @param other Matriz de origen
+     */
+    BasicMatrix(BasicMatrix&& other) noexcept;
+
+    /**
+     * @brief Asignación por movimiento (intercambia los bloques de datos)
+     *
+     * @param other Matriz de origen; queda vacía (0 x 0)
+     * @return Referencia a esta matriz
+     */
+    BasicMatrix& operator=(BasicMatrix&& other) noexcept;
+
+    /**
+     * @brief Construye una matriz convirtiendo los elementos de otra de distinto tipo
+     *
+     * Cada elemento se convierte con static_cast<T>. Es explícito para que
+     * las conversiones con pérdida (double a float, por ejemplo) se vean
+     * en el código.
+     *
+     * @param other Matriz de origen
+     *
+     * @code
+     * BasicMatrix<float> Af(A); // A es una Matrix (double)
+     * @endcode
+     */
+    template <class U>
+    explicit BasicMatrix(const BasicMatrix<U>& other)
+        : elements(NULL), rows(0), cols(0), ld(0), allocator(&mathlib::current_allocator()) {
+        reshapeUninitialized(other.num_rows(), other.num_cols());
+        for (int i = 0; i < rows; ++i) {
+            const U* in = other.data() + static_cast<std::size_t>(i) * other.stride();
+            T* out = elements + static_cast<std::size_t>(i) * ld;
+            for (int j = 0; j < cols; ++j) {
+                out[j] = static_cast<T>(in[j]);
+            }
+        }
+    }
+
+    /**
+     * @brief Copia de la matriz con los elementos convertidos a otro tipo
+     *
+     * @return Nueva matriz BasicMatrix<U> con las mismas dimensiones
+     *
+     * @code
+     * BasicMatrix<float> Af = A.cast<float>();
+     * @endcode
+     */
+    template <class U>
+    BasicMatrix<U> cast() const { return BasicMatrix<U>(*this); }
+
+    /**
+     * @brief Construye una matriz evaluando una expresión diferida
+     *
+     * Reserva el resultado una sola vez y lo calcula en un único bucle
+     * fusionado. La expresión debe tener el tipo de elemento T; para
+     * convertir entre tipos se usa cast<U>().
+     *
+     * @param expr Expresión a evaluar (A + B, 2.0 * A - B, ...)
+     *
+     * @code
+     * Matrix D = A + B + 2.0 * C; // una reserva, una pasada
+     * @endcode
+     */
+    template <class E>
+    BasicMatrix(const MatrixExpr<E>& expr)
+        : elements(NULL), rows(0), cols(0), ld(0), allocator(&mathlib::current_allocator()) {
+        static_assert(std::is_same<typename E::value_type, T>::value,
+                      "BasicMatrix - La expresión debe tener el mismo tipo de elemento (use cast<U>())");
+        reshapeUninitialized(expr.self().num_rows(), expr.self().num_cols());
+        assignExpr(expr.self());
+    }
+
+    /**
+     * @brief Asigna el valor de una expresión diferida
+     *
+     * Si las dimensiones no cambian se reutiliza el bloque actual.
+     *
+     * @param expr Expresión a evaluar
+     * @return Referencia a esta matriz
+     */
+    template <class E>
+    BasicMatrix& operator=(const MatrixExpr<E>& expr) {
+        static_assert(std::is_same<typename E::value_type, T>::value,
+                      "BasicMatrix - La expresión debe tener el mismo tipo de elemento (use cast<U>())");
+        const E& e = expr.self();
+        if (e.num_rows() != rows || e.num_cols() != cols) {
+            reshapeUninitialized(e.num_rows(), e.num_cols());
+        }
+        assignExpr(e);
+        return *this;
+    }
+
+    /**
+     * @brief Acceso a un elemento sin comprobación de límites
+     *
+     * Usado por las plantillas de expresión.
+     *
+     * @param r Índice de fila (0-based, debe ser válido)
+     * @param c Índice de columna (0-based, debe ser válido)
+     * @return Valor en la posición (r, c)
+     */
+    T coeff(int r, int c) const { return elements[static_cast<std::size_t>(r) * ld + c]; }
+
+    /**
+     * @brief Destructor - Libera el bloque de datos alineado
+     */
+    ~BasicMatrix();
+
+    /**
+     * @brief Número de filas de la matriz
+     * @return Cantidad de filas
+     */
+    int num_rows() const { return rows; }
+
+    /**
+     * @brief Número de columnas de la matriz
+     * @return Cantidad de columnas
+     */
+    int num_cols() const { return cols; }
+
+    /**
+     * @brief Asignador con el que se reservó el bloque de datos
+     * @return Referencia al asignador
+     */
+    mathlib::MatrixAllocator& get_allocator() const { return *allocator; }
+
+    /**
+     * @brief Separación entre filas consecutivas dentro del bloque de datos
+     *
+     * El elemento (r, c) se encuentra en data()[r * stride() + c]. Para una
+     * matriz propietaria el valor coincide con num_cols(); se expone por
+     * separado para que los kernels y bibliotecas externas (BLAS, parámetro
+     * lda) no dependan de esa suposición.
+     *
+     * @return Separación entre filas, en elementos
+     */
+    int stride() const { return ld; }
+
+    /**
+     * @brief Acceso directo al bloque contiguo de datos
+     *
+     * El puntero está alineado a ALIGNMENT bytes y contiene
+     * num_rows() * stride() elementos en orden por filas. Permite pasar
+     * la matriz a kernels vectorizados o a BLAS sin copias. Si el bloque
+     * está compartido con una copia, antes pasa a uno propio
+     * (make_unique()); una copia posterior de la matriz invalida el puntero
+     * para escribir.
+     *
+     * @return Puntero al primer elemento
+     *
+     * @code
+     * cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+     *             1.0, A.data(), A.stride(), B.data(), B.stride(),
+     *             0.0, C.data(), C.stride());
+     * @endcode
+     */
+    T* data() {
+        make_unique();
+        return elements;
+    }
+
+    /**
+     * @brief Acceso directo de solo lectura al bloque contiguo de datos
+     * @return Puntero constante al primer elemento
+     */
+    const T* data() const { return elements; }
 
     /**
      * @brief Obtiene el valor en una posición específica de la matriz
@@ -62,14 +445,14 @@ public:
      * 
      * @param r Índice de fila (0-based)
      * @param c Índice de columna (0-based)
-     * @return Valor double en la posición (r, c)
+     * @return Valor en la posición (r, c)
      * @throws std::out_of_range Si los índices están fuera de rango
      * 
      * @code
      * double valor = m.get(1, 2); // Obtiene valor en fila 1, columna 2
      * @endcode
      */
-    double get(int r, int c) const;
+    T get(int r, int c) const;
 
     /**
      * @brief Establece un valor en una posición específica de la matriz
@@ -79,14 +462,152 @@ public:
      * 
      * @param r Índice de fila (0-based)
      * @param c Índice de columna (0-based)
-     * @param value Valor double a almacenar
+     * @param value Valor a almacenar
      * @throws std::out_of_range Si los índices están fuera de rango
      * 
      * @code
      * m.set(0, 0, 5.5); // Establece 5.5 en la posición (0,0)
      * @endcode
      */
-    void set(int r, int c, double value);
+    void set(int r, int c, T value);
+
+    /**
+     * @brief Acceso a un elemento sin comprobación de límites en release
+     * 
+     * Pensado para bucles críticos: los índices solo se verifican con
+     * assert en compilaciones sin NDEBUG y no se comprueba si el bloque
+     * está compartido. Si la matriz se ha copiado, hay que llamar antes a
+     * make_unique(); si no, la escritura se vería también en la copia. Para
+     * el acceso validado con excepción se usan get() y set().
+     * 
+     * @param r Índice de fila (0-based)
+     * @param c Índice de columna (0-based)
+     * @return Referencia al elemento (r, c)
+     * 
+     * @code
+     * for (int i = 0; i < n; ++i) m(i, i) = 1.0;
+     * @endcode
+     */
+    T& operator()(int r, int c) {
+        assert(r >= 0 && r < rows && c >= 0 && c < cols && "Matrix::operator() - Índice fuera de rango");
+        return elements[static_cast<std::size_t>(r) * ld + c];
+    }
+
+    /**
+     * @brief Acceso de solo lectura sin comprobación de límites en release
+     */
+    const T& operator()(int r, int c) const {
+        assert(r >= 0 && r < rows && c >= 0 && c < cols && "Matrix::operator() - Índice fuera de rango");
+        return elements[static_cast<std::size_t>(r) * ld + c];
+    }
+
+    /**
+     * @brief Vista contigua de una fila (num_cols() elementos)
+     * 
+     * El índice de fila se comprueba una vez; el acceso a los elementos
+     * de la vista no se comprueba en release. Como data(), pasa antes a un
+     * bloque propio, y una copia posterior invalida la vista para escribir.
+     * 
+     * @param r Índice de fila (0-based)
+     * @return Vista sobre la fila r
+     * @throws std::out_of_range Si r está fuera de rango
+     * 
+     * @code
+     * mathlib::Span<double> fila = m.row(0);
+     * std::copy(buffer, buffer + fila.size(), fila.begin());
+     * @endcode
+     */
+    mathlib::Span<T> row(int r) {
+        if (r < 0 || r >= rows) {
+            throw std::out_of_range("Matrix::row - Índice fuera de rango");
+        }
+        make_unique();
+        return mathlib::Span<T>(elements + static_cast<std::size_t>(r) * ld,
+                                static_cast<std::size_t>(cols));
+    }
+
+    /**
+     * @brief Vista de solo lectura de una fila
+     * @throws std::out_of_range Si r está fuera de rango
+     */
+    mathlib::Span<const T> row(int r) const {
+        if (r < 0 || r >= rows) {
+            throw std::out_of_range("Matrix::row - Índice fuera de rango");
+        }
+        return mathlib::Span<const T>(elements + static_cast<std::size_t>(r) * ld,
+                                      static_cast<std::size_t>(cols));
+    }
+
+    /**
+     * @brief Vista sin propiedad sobre la matriz completa
+     * 
+     * @return Vista modificable; deja de ser válida si la matriz se
+     *         destruye o se redimensiona
+     */
+    mathlib::BasicMatrixView<T> view() { return mathlib::BasicMatrixView<T>(*this); }
+
+    /**
+     * @brief Vista de solo lectura sobre la matriz completa
+     */
+    mathlib::BasicMatrixView<const T> view() const { return mathlib::BasicMatrixView<const T>(*this); }
+
+    /**
+     * @brief Vista sobre el sub-bloque de nr x nc elementos que empieza en (r0, c0)
+     * 
+     * El bloque comparte los datos con la matriz (separación stride()),
+     * de modo que puede usarse como operando o como destino de los
+     * kernels de MatrixView.h sin copias.
+     * 
+     * @throws std::out_of_range Si el bloque excede los límites de la matriz
+     * 
+     * @code
+     * // Escribir A × B en la esquina superior izquierda de C
+     * mathlib::multiply(A, B, C.block(0, 0, A.num_rows(), B.num_cols()));
+     * @endcode
+     */
+    mathlib::BasicMatrixView<T> block(int r0, int c0, int nr, int nc) {
+        return view().block(r0, c0, nr, nc);
+    }
+
+    /**
+     * @brief Vista de solo lectura sobre un sub-bloque
+     * @throws std::out_of_range Si el bloque excede los límites de la matriz
+     */
+    mathlib::BasicMatrixView<const T> block(int r0, int c0, int nr, int nc) const {
+        return view().block(r0, c0, nr, nc);
+    }
+
+    /**
+     * @brief Asigna el mismo valor a todos los elementos
+     * 
+     * @param value Valor a asignar
+     * @return Referencia a esta matriz
+     */
+    BasicMatrix& fill(T value);
+
+    /**
+     * @brief Copia todos los elementos desde un buffer contiguo por filas
+     * 
+     * @param src Buffer con num_rows() * num_cols() elementos en orden por filas
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si src es NULL
+     * 
+     * @code
+     * std::vector<double> datos = cargar();   // rows * cols valores
+     * m.assign(&datos[0]);
+     * @endcode
+     */
+    BasicMatrix& assign(const T* src);
+
+    /**
+     * @brief Copia todos los elementos desde un buffer con separación entre filas
+     * 
+     * @param src Buffer con num_rows() filas de num_cols() elementos
+     * @param src_stride Separación entre filas de src, en elementos (>= num_cols())
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si src es NULL o src_stride < num_cols()
+     */
+    BasicMatrix& assign(const T* src, int src_stride);
 
     /**
      * @brief Suma esta matriz con otra matriz
@@ -104,7 +625,137 @@ public:
      * Matrix C = A.add(B); // C = A + B
      * @endcode
      */
-    Matrix add(const Matrix& other) const;
+    BasicMatrix add(const BasicMatrix& other) const;
+
+    /**
+     * @brief Suma otra matriz sobre esta, sin reservar memoria
+     * 
+     * @param other Matriz con las mismas dimensiones
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     * 
+     * @code
+     * A.add_inplace(B); // A = A + B
+     * @endcode
+     */
+    BasicMatrix& add_inplace(const BasicMatrix& other);
+
+    /**
+     * @brief Equivalente a add_inplace(other)
+     */
+    BasicMatrix& operator+=(const BasicMatrix& other) { return add_inplace(other); }
+
+    /**
+     * @brief Resta otra matriz sobre esta, sin reservar memoria
+     * 
+     * @param other Matriz con las mismas dimensiones
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     */
+    BasicMatrix& subtract_inplace(const BasicMatrix& other);
+
+    /**
+     * @brief Equivalente a subtract_inplace(other)
+     */
+    BasicMatrix& operator-=(const BasicMatrix& other) { return subtract_inplace(other); }
+
+    /**
+     * @brief Suma una expresión diferida sobre esta matriz en un solo recorrido
+     * 
+     * @param expr Expresión con las mismas dimensiones
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     */
+    template <class E>
+    BasicMatrix& operator+=(const MatrixExpr<E>& expr) {
+        assignExpr(BinaryExpr<BasicMatrix, E, ExprAddOp>(*this, expr.self()));
+        return *this;
+    }
+
+    /**
+     * @brief Resta una expresión diferida sobre esta matriz en un solo recorrido
+     * 
+     * @param expr Expresión con las mismas dimensiones
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     */
+    template <class E>
+    BasicMatrix& operator-=(const MatrixExpr<E>& expr) {
+        assignExpr(BinaryExpr<BasicMatrix, E, ExprSubOp>(*this, expr.self()));
+        return *this;
+    }
+
+    /**
+     * @brief Multiplica todos los elementos por un escalar, sin reservar memoria
+     * 
+     * @param alpha Factor de escala
+     * @return Referencia a esta matriz
+     */
+    BasicMatrix& operator*=(T alpha);
+
+    /**
+     * @brief Resta a esta matriz otra matriz
+     * 
+     * Realiza la resta elemento por elemento. Ambas matrices deben
+     * tener las mismas dimensiones.
+     * 
+     * @param other Matriz a restar de esta matriz
+     * @return Nueva matriz resultante de la resta
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     * 
+     * @code
+     * Matrix C = A.subtract(B); // C = A - B
+     * @endcode
+     */
+    BasicMatrix subtract(const BasicMatrix& other) const;
+
+    /**
+     * @brief Producto elemento a elemento (Hadamard) con otra matriz
+     * 
+     * @param other Matriz con las mismas dimensiones
+     * @return Nueva matriz con C(i,j) = A(i,j) * B(i,j)
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     * 
+     * @code
+     * Matrix C = A.hadamard(B); // C = A ∘ B
+     * @endcode
+     */
+    BasicMatrix hadamard(const BasicMatrix& other) const;
+
+    /**
+     * @brief Multiplica todos los elementos por un escalar
+     * 
+     * @param alpha Factor de escala
+     * @return Nueva matriz con C(i,j) = alpha * A(i,j)
+     * 
+     * @code
+     * Matrix C = A.scale(2.0); // C = 2A
+     * @endcode
+     */
+    BasicMatrix scale(T alpha) const;
+
+    /**
+     * @brief Transpuesta de la matriz
+     * 
+     * Se calcula con mathlib::transpose() (Transpose.h), que recorre la
+     * matriz por teselas recursivas para que origen y destino se lean y
+     * escriban por líneas de caché completas.
+     * 
+     * @return Nueva matriz de cols x rows con C(j,i) = A(i,j)
+     * 
+     * @code
+     * Matrix At = A.transpose();
+     * @endcode
+     */
+    BasicMatrix transpose() const;
+
+    /**
+     * @brief Transpone en el sitio una matriz cuadrada, sin reservar memoria
+     * 
+     * @return Referencia a esta matriz
+     * @throws std::invalid_argument Si la matriz no es cuadrada
+     */
+    BasicMatrix& transpose_inplace();
 
     /**
      * @brief Multiplica esta matriz por otra matriz
@@ -113,7 +764,12 @@ public:
      * matriz proporcionada. El número de columnas de esta matriz
      * debe coincidir con el número de filas de la otra matriz.
      * 
+     * Con mathlib::PARALLEL el producto se reparte en teselas sobre el
+     * grupo de hilos global (mathlib::ThreadPool::global()); las matrices
+     * pequeñas se siguen calculando en serie.
+     * 
      * @param other Matriz a multiplicar con esta matriz
+     * @param policy Política de ejecución (por defecto en serie)
      * @return Nueva matriz resultante del producto
      * @throws std::invalid_argument Si las dimensiones son incompatibles
      * 
@@ -122,9 +778,149 @@ public:
      * @code
      * Matrix A(2,3), B(3,2);
      * Matrix C = A.multiply(B); // C = A × B (2x2)
+     * Matrix D = A.multiply(B, mathlib::PARALLEL);
      * @endcode
      */
-    Matrix multiply(const Matrix& other) const;
+    BasicMatrix multiply(const BasicMatrix& other, mathlib::ExecutionPolicy policy = mathlib::SEQUENTIAL) const;
+
+    /**
+     * @brief Multiplica esta matriz por otra con el algoritmo indicado
+     * 
+     * Con mathlib::MULTIPLY_STRASSEN se usa mathlib::gemm_strassen() con
+     * el umbral options.strassen_crossover; véase su documentación para
+     * las cotas de error. Las matrices que no superan el doble del umbral
+     * se multiplican con el algoritmo clásico.
+     * 
+     * Con options.trans_a o options.trans_b a mathlib::TRANS se calcula
+     * op(this) × op(other) leyendo los operandos transpuestos desde su
+     * almacenamiento, sin copiarlos (Strassen sí construye la copia
+     * transpuesta antes de la recursión).
+     * 
+     * @param other Matriz a multiplicar con esta matriz
+     * @param options Algoritmo, umbral, transposiciones y política de ejecución
+     * @return Nueva matriz resultante del producto
+     * @throws std::invalid_argument Si las dimensiones son incompatibles o
+     *         el umbral no es positivo
+     * 
+     * @code
+     * mathlib::MultiplyOptions rapido(mathlib::PARALLEL);
+     * rapido.algorithm = mathlib::MULTIPLY_STRASSEN;
+     * Matrix C = A.multiply(B, rapido);
+     * 
+     * mathlib::MultiplyOptions gram;
+     * gram.trans_a = mathlib::TRANS;
+     * Matrix G = X.multiply(X, gram);   // Xᵀ × X
+     * @endcode
+     */
+    BasicMatrix multiply(const BasicMatrix& other, const mathlib::MultiplyOptions& options) const;
+
+    /**
+     * @brief Calcula out = this × other reutilizando el bloque de out
+     * 
+     * Si out ya tiene rows x other.cols elementos (o el mismo número de
+     * elementos) no se reserva memoria; en otro caso se redimensiona. Los
+     * paneles empaquetados del producto por bloques van a buffers de cada
+     * hilo que solo crecen la primera vez que se ve una forma mayor, así
+     * que en serie las llamadas repetidas no reservan nada (con PARALLEL
+     * el reparto entre hilos sí crea pequeños objetos de control).
+     * El contenido previo de out se sobrescribe sin necesidad de
+     * inicializarlo. Si out es la misma matriz que uno de los operandos,
+     * el producto se calcula en un temporal.
+     * 
+     * @param other Matriz a multiplicar con esta matriz
+     * @param out Matriz destino
+     * @param policy Política de ejecución (por defecto en serie)
+     * @throws std::invalid_argument Si cols != other.rows
+     * 
+     * @code
+     * Matrix out(A.num_rows(), B.num_cols(), Matrix::UNINITIALIZED);
+     * for (int it = 0; it < 1000; ++it) {
+     *     A.multiply_into(B, out); // sin reservas tras la primera vuelta
+     * }
+     * @endcode
+     */
+    void multiply_into(const BasicMatrix& other, BasicMatrix& out,
+                       mathlib::ExecutionPolicy policy = mathlib::SEQUENTIAL) const;
+
+    /**
+     * @brief Calcula out = this × other con el algoritmo indicado
+     * 
+     * Igual que multiply_into() con política, pero admite elegir
+     * mathlib::MULTIPLY_STRASSEN y operandos transpuestos (out =
+     * op(this) × op(other)). El espacio de trabajo de la recursión se
+     * reserva una sola vez por llamada.
+     * 
+     * @param other Matriz a multiplicar con esta matriz
+     * @param out Matriz destino
+     * @param options Algoritmo, umbral, transposiciones y política de ejecución
+     * @throws std::invalid_argument Si las dimensiones de op(this) y
+     *         op(other) son incompatibles o el umbral no es positivo
+     */
+    void multiply_into(const BasicMatrix& other, BasicMatrix& out,
+                       const mathlib::MultiplyOptions& options) const;
+
+    /**
+     * @brief Producto matriz-vector this × x (GEMV)
+     * 
+     * Lee la matriz una sola vez con el kernel GEMV de la biblioteca, sin
+     * el empaquetado de GEMM. Con mathlib::PARALLEL las filas se reparten
+     * entre los hilos si la matriz es lo bastante grande.
+     * 
+     * @param x Vector de num_cols() elementos
+     * @param policy Política de ejecución (por defecto en serie)
+     * @return Vector de num_rows() elementos
+     * @throws std::invalid_argument Si x.size() != cols
+     * 
+     * @code
+     * mathlib::Vector y = A.multiply(x);
+     * @endcode
+     */
+    mathlib::BasicVector<T> multiply(const mathlib::BasicVector<T>& x,
+                                     mathlib::ExecutionPolicy policy = mathlib::SEQUENTIAL) const;
+
+    /**
+     * @brief Calcula y = this × x reutilizando el bloque de y
+     * 
+     * Para y = alpha · this × x + beta · y se usa mathlib::gemv() de
+     * Vector.h.
+     * 
+     * @throws std::invalid_argument Si x.size() != cols o y.size() != rows
+     */
+    void multiply_into(const mathlib::BasicVector<T>& x, mathlib::BasicVector<T>& y,
+                       mathlib::ExecutionPolicy policy = mathlib::SEQUENTIAL) const;
+
+    /**
+     * @brief Producto fusionado this = epilogue(alpha · op(A) × op(B) + beta · this)
+     * 
+     * Acumula el producto directamente sobre esta matriz dentro del
+     * kernel por bloques (véase mathlib::gemm()), sin temporal para
+     * A × B ni pasadas adicionales para la suma, el sesgo o la
+     * activación: sustituye a C = C.add(A.multiply(B)) sin reservar
+     * memoria. Con beta == 0 el contenido previo no se lee y la matriz se
+     * redimensiona si hace falta.
+     * 
+     * @param alpha Escala del producto
+     * @param A Operando izquierdo (options.trans_a para usar Aᵀ)
+     * @param B Operando derecho (options.trans_b para usar Bᵀ)
+     * @param beta Escala del valor actual de esta matriz
+     * @param options Transposiciones y política; el algoritmo debe ser
+     *        mathlib::MULTIPLY_CLASSIC
+     * @param epilogue Sesgo por columna (num_cols() elementos) y activación
+     * @return Esta matriz
+     * @throws std::invalid_argument Si las dimensiones son incompatibles,
+     *         si se pide Strassen o ReLU con complejos
+     * 
+     * @code
+     * C.gemm(1.0, A, B, 1.0);                         // C += A × B
+     * mathlib::GemmEpilogue<double> capa;
+     * capa.bias = b.data();
+     * capa.activation = mathlib::ACTIVATION_RELU;
+     * Y.gemm(1.0, X, W, 0.0, mathlib::MultiplyOptions(mathlib::PARALLEL), capa);
+     * @endcode
+     */
+    BasicMatrix& gemm(T alpha, const BasicMatrix& A, const BasicMatrix& B, T beta,
+                      const mathlib::MultiplyOptions& options = mathlib::MultiplyOptions(),
+                      const mathlib::GemmEpilogue<T>& epilogue = mathlib::GemmEpilogue<T>());
 
     /**
      * @brief Imprime la matriz en la salida estándar
@@ -143,4 +939,13 @@ public:
     void print() const;
 };
 
+/// Matriz de doble precisión, el tipo principal de la biblioteca
+typedef BasicMatrix<double> Matrix;
+
+// Instancias compiladas en Matrix.cpp
+extern template class BasicMatrix<float>;
+extern template class BasicMatrix<double>;
+extern template class BasicMatrix<int>;
+extern template class BasicMatrix<std::complex<double> >;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**
+ * @file MatrixExpr.h
+ * @brief Plantillas de expresión para aritmética elemento a elemento diferida
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los operadores +, - y el producto por escalar no calculan nada: devuelven
+ * un objeto ligero que describe la expresión. La expresión completa se
+ * evalúa en un único bucle cuando se asigna a una matriz, de modo que
+ *
+ * @code
+ * Matrix D = A + B + 2.0 * C;
+ * @endcode
+ *
+ * lee cada operando una sola vez y reserva memoria una sola vez, sin
+ * matrices intermedias.
+ *
+ * @warning Las expresiones guardan referencias a las matrices operando.
+ * No deben almacenarse (por ejemplo con auto) más allá de la sentencia
+ * en que se crean.
+ */
+
+#ifndef MATRIX_EXPR_H
+#define MATRIX_EXPR_H
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+template <class T>
+class BasicMatrix;
+
+/**
+ * @class MatrixExpr
+ * @brief Base CRTP de toda expresión matricial (incluida la propia Matrix)
+ *
+ * Un tipo E que derive de MatrixExpr<E> debe ofrecer el tipo value_type,
+ * num_rows(), num_cols() y coeff(r, c), este último sin comprobación de
+ * límites.
+ */
+template <class E>
+class MatrixExpr {
+public:
+    /// Acceso al tipo concreto de la expresión
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+/**
+ * @brief Forma en que un nodo guarda a sus operandos
+ *
+ * Los nodos de expresión se guardan por valor (son pequeños); las
+ * matrices, por referencia constante, para no copiar sus datos.
+ */
+template <class E>
+struct ExprOperand {
+    typedef const E type;
+};
+
+template <class T>
+struct ExprOperand<BasicMatrix<T> > {
+    typedef const BasicMatrix<T>& type;
+};
+
+/// Operación de suma elemento a elemento
+struct ExprAddOp {
+    template <class T>
+    static T apply(const T& a, const T& b) { return a + b; }
+    static const char* name() { return "operator+"; }
+};
+
+/// Operación de resta elemento a elemento
+struct ExprSubOp {
+    template <class T>
+    static T apply(const T& a, const T& b) { return a - b; }
+    static const char* name() { return "operator-"; }
+};
+
+/**
+ * @class BinaryExpr
+ * @brief Nodo que combina dos expresiones de las mismas dimensiones
+ */
+template <class L, class R, class Op>
+class BinaryExpr : public MatrixExpr<BinaryExpr<L, R, Op> > {
+private:
+    typename ExprOperand<L>::type lhs;  ///< Operando izquierdo
+    typename ExprOperand<R>::type rhs;  ///< Operando derecho
+
+public:
+    typedef typename L::value_type value_type;
+
+    static_assert(std::is_same<value_type, typename R::value_type>::value,
+                  "MatrixExpr - Los operandos deben tener el mismo tipo de elemento");
+
+    /**
+     * @brief Construye el nodo validando que las dimensiones coincidan
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     */
+    BinaryExpr(const L& l, const R& r) : lhs(l), rhs(r) {
+        if (l.num_rows() != r.num_rows() || l.num_cols() != r.num_cols()) {
+            throw std::invalid_argument(std::string("Matrix::") + Op::name() +
+                                        " - Las matrices deben tener el mismo tamaño");
+        }
+    }
+
+    int num_rows() const { return lhs.num_rows(); }
+    int num_cols() const { return lhs.num_cols(); }
+    value_type coeff(int r, int c) const {
+        return Op::template apply<value_type>(lhs.coeff(r, c), rhs.coeff(r, c));
+    }
+};
+
+/**
+ * @class ScaledExpr
+ * @brief Nodo alpha * expr
+ */
+template <class E>
+class ScaledExpr : public MatrixExpr<ScaledExpr<E> > {
+public:
+    typedef typename E::value_type value_type;
+
+private:
+    value_type alpha;                    ///< Factor de escala
+    typename ExprOperand<E>::type expr;  ///< Expresión escalada
+
+public:
+    ScaledExpr(const value_type& a, const E& e) : alpha(a), expr(e) {}
+
+    int num_rows() const { return expr.num_rows(); }
+    int num_cols() const { return expr.num_cols(); }
+    value_type coeff(int r, int c) const { return alpha * expr.coeff(r, c); }
+};
+
+/**
+ * @brief Suma diferida de dos expresiones
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class L, class R>
+BinaryExpr<L, R, ExprAddOp> operator+(const MatrixExpr<L>& a, const MatrixExpr<R>& b) {
+    return BinaryExpr<L, R, ExprAddOp>(a.self(), b.self());
+}
+
+/**
+ * @brief Resta diferida de dos expresiones
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class L, class R>
+BinaryExpr<L, R, ExprSubOp> operator-(const MatrixExpr<L>& a, const MatrixExpr<R>& b) {
+    return BinaryExpr<L, R, ExprSubOp>(a.self(), b.self());
+}
+
+/**
+ * @brief Producto diferido escalar × expresión
+ *
+ * El escalar se convierte al tipo de elemento de la expresión.
+ */
+template <class E>
+ScaledExpr<E> operator*(typename E::value_type alpha, const MatrixExpr<E>& e) {
+    return ScaledExpr<E>(alpha, e.self());
+}
+
+/**
+ * @brief Producto diferido expresión × escalar
+ */
+template <class E>
+ScaledExpr<E> operator*(const MatrixExpr<E>& e, typename E::value_type alpha) {
+    return ScaledExpr<E>(alpha, e.self());
+}
+
+/**
+ * @brief Negación diferida de una expresión
+ */
+template <class E>
+ScaledExpr<E> operator-(const MatrixExpr<E>& e) {
+    return ScaledExpr<E>(typename E::value_type(-1), e.self());
+}
+
+#endif
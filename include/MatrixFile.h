@@ -0,0 +1,234 @@
+/**
+ * @file MatrixFile.h
+ * @brief Formato binario de matrices en disco y carga mediante mmap
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Un archivo de matriz consta de una cabecera fija de 64 bytes seguida
+ * de los datos en bruto, contiguos y en orden por filas:
+ *
+ * | Desplazamiento | Tamaño | Campo                                         |
+ * |----------------|--------|-----------------------------------------------|
+ * | 0              | 8      | Firma "MLMATRIX"                              |
+ * | 8              | 2      | Versión del formato (MATRIX_FILE_VERSION)     |
+ * | 10             | 2      | Tipo de elemento (MatrixDType)                |
+ * | 12             | 1      | Orden de bytes: 1 little-endian, 2 big-endian |
+ * | 13             | 1      | Tamaño del elemento en bytes                  |
+ * | 16             | 4      | Alineación de los datos en bytes              |
+ * | 24             | 8      | Filas                                         |
+ * | 32             | 8      | Columnas                                      |
+ * | 40             | 8      | Desplazamiento de los datos                   |
+ * | 48             | 8      | Tamaño de los datos en bytes                  |
+ *
+ * Los campos numéricos se escriben en el orden de bytes indicado en el
+ * byte 12. Los datos empiezan en un desplazamiento múltiplo de
+ * MATRIX_ALIGNMENT, de modo que al mapear el archivo quedan alineados
+ * igual que el bloque de una BasicMatrix y los kernels SIMD pueden
+ * leerlos sin copias.
+ *
+ * @code
+ * mathlib::save_matrix("pesos.mlm", W);
+ * ...
+ * mathlib::MappedMatrixFile file("pesos.mlm");     // sin lectura ni copia
+ * mathlib::ConstMatrixView W = file.view<double>();
+ * mathlib::multiply(x, W, y);
+ * @endcode
+ */
+
+#ifndef MATRIX_FILE_H
+#define MATRIX_FILE_H
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "MatrixView.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/// Versión actual del formato de archivo
+static const int MATRIX_FILE_VERSION = 1;
+
+/// Tamaño de la cabecera del formato en bytes
+static const std::size_t MATRIX_FILE_HEADER_BYTES = 64;
+
+/**
+ * @enum MatrixDType
+ * @brief Tipo de elemento almacenado en un archivo de matriz
+ */
+enum MatrixDType {
+    DTYPE_FLOAT32 = 1,     ///< float (IEEE 754 binario32)
+    DTYPE_FLOAT64 = 2,     ///< double (IEEE 754 binario64)
+    DTYPE_INT32 = 3,       ///< int de 32 bits
+    DTYPE_COMPLEX128 = 4   ///< std::complex<double>
+};
+
+/// Correspondencia entre el tipo de elemento de C++ y su MatrixDType
+template <class T>
+struct DTypeOf;
+
+template <>
+struct DTypeOf<float> { static const MatrixDType value = DTYPE_FLOAT32; };
+
+template <>
+struct DTypeOf<double> { static const MatrixDType value = DTYPE_FLOAT64; };
+
+template <>
+struct DTypeOf<int> { static const MatrixDType value = DTYPE_INT32; };
+
+template <>
+struct DTypeOf<std::complex<double> > { static const MatrixDType value = DTYPE_COMPLEX128; };
+
+/**
+ * @brief Nombre legible de un tipo de elemento ("float64", ...)
+ */
+const char* dtype_name(MatrixDType dtype);
+
+/**
+ * @struct MatrixFileInfo
+ * @brief Contenido de la cabecera de un archivo de matriz
+ */
+struct MatrixFileInfo {
+    int version;                ///< Versión del formato
+    MatrixDType dtype;          ///< Tipo de elemento
+    bool little_endian;         ///< true si el archivo es little-endian
+    std::size_t element_size;   ///< Tamaño del elemento en bytes
+    std::size_t alignment;      ///< Alineación de los datos en bytes (potencia de dos)
+    int rows;                   ///< Filas
+    int cols;                   ///< Columnas
+    std::uint64_t data_offset;  ///< Desplazamiento de los datos desde el inicio
+    std::uint64_t data_bytes;   ///< Tamaño de los datos en bytes
+};
+
+/**
+ * @brief Lee y valida la cabecera de un archivo de matriz
+ *
+ * @param path Ruta del archivo
+ * @return Cabecera decodificada
+ * @throws std::runtime_error Si el archivo no se puede leer o no es válido
+ */
+MatrixFileInfo read_matrix_info(const std::string& path);
+
+/**
+ * @brief Crea un archivo de matriz con la cabecera escrita y los datos a cero
+ *
+ * Reserva el tamaño completo del archivo (de forma dispersa si el sistema
+ * de archivos lo permite) para que los datos puedan escribirse después
+ * por bloques, sin tener la matriz entera en memoria.
+ *
+ * @param path Ruta del archivo; se sobrescribe si existe
+ * @param rows Filas (>= 0)
+ * @param cols Columnas (>= 0)
+ * @param dtype Tipo de elemento
+ * @return Cabecera escrita
+ * @throws std::invalid_argument Si las dimensiones son negativas
+ * @throws std::runtime_error Si el archivo no se puede crear
+ */
+MatrixFileInfo create_matrix_file(const std::string& path, int rows, int cols, MatrixDType dtype);
+
+namespace detail {
+
+template <class T>
+void save_matrix_view(const std::string& path, BasicMatrixView<const T> m);
+
+} // namespace detail
+
+/**
+ * @brief Guarda una matriz o vista en el formato binario
+ *
+ * Escribe primero en path + ".tmp" y renombra al terminar, de modo que
+ * un lector nunca ve un archivo a medio escribir.
+ *
+ * @param path Ruta del archivo de destino
+ * @param m Matriz o vista a guardar (float, double, int o complex<double>)
+ * @throws std::runtime_error Si falla la escritura
+ */
+template <class M>
+void save_matrix(const std::string& path, const M& m) {
+    detail::save_matrix_view(path, make_const_view(m));
+}
+
+/**
+ * @brief Carga un archivo completo en una matriz propietaria
+ *
+ * A diferencia de MappedMatrixFile, copia los datos; admite archivos con
+ * el orden de bytes contrario al del equipo (se convierten al cargar).
+ *
+ * @tparam T Tipo de elemento esperado
+ * @param path Ruta del archivo
+ * @return Matriz con el contenido del archivo
+ * @throws std::runtime_error Si el archivo no se puede leer, no es válido
+ *         o guarda una matriz con 0 filas o 0 columnas (read_matrix_info()
+ *         y MappedMatrixFile sí las admiten)
+ * @throws std::invalid_argument Si el tipo de elemento no coincide con T
+ */
+template <class T>
+BasicMatrix<T> load_matrix(const std::string& path);
+
+/**
+ * @class MappedMatrixFile
+ * @brief Archivo de matriz mapeado en memoria de solo lectura
+ *
+ * El constructor mapea el archivo completo (mmap en POSIX,
+ * MapViewOfFile en Windows) y valida la cabecera; view() devuelve una
+ * vista sobre los datos sin leerlos ni copiarlos. Las páginas se cargan
+ * bajo demanda y se comparten entre procesos que mapeen el mismo archivo.
+ * Las vistas obtenidas dejan de ser válidas al destruirse el objeto.
+ */
+class MappedMatrixFile {
+public:
+    /**
+     * @brief Mapea un archivo de matriz
+     *
+     * @param path Ruta del archivo
+     * @throws std::runtime_error Si el archivo no se puede mapear, no es
+     *         válido o tiene un orden de bytes distinto al del equipo
+     */
+    explicit MappedMatrixFile(const std::string& path);
+
+    ~MappedMatrixFile();
+
+    MappedMatrixFile(MappedMatrixFile&& other) noexcept;
+    MappedMatrixFile& operator=(MappedMatrixFile&& other) noexcept;
+
+    /// Cabecera del archivo
+    const MatrixFileInfo& info() const { return header; }
+
+    int num_rows() const { return header.rows; }
+    int num_cols() const { return header.cols; }
+
+    /// Puntero al primer byte de los datos (alineado a info().alignment)
+    const void* raw_data() const { return static_cast<const char*>(base) + header.data_offset; }
+
+    /**
+     * @brief Vista de solo lectura sobre los datos mapeados
+     *
+     * @tparam T Tipo de elemento; debe coincidir con info().dtype
+     * @throws std::invalid_argument Si T no coincide con el tipo del archivo
+     */
+    template <class T>
+    BasicMatrixView<const T> view() const {
+        checkDType(DTypeOf<T>::value);
+        return BasicMatrixView<const T>(static_cast<const T*>(raw_data()), header.rows, header.cols);
+    }
+
+private:
+    MappedMatrixFile(const MappedMatrixFile&);
+    MappedMatrixFile& operator=(const MappedMatrixFile&);
+
+    void checkDType(MatrixDType expected) const;
+    void unmap();
+
+    void* base;             ///< Inicio del mapeo
+    std::size_t length;     ///< Bytes mapeados
+    MatrixFileInfo header;  ///< Cabecera decodificada
+    void* mappingHandle;    ///< Objeto de mapeo (solo Windows)
+};
+
+} // namespace mathlib
+
+#endif
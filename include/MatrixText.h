@@ -0,0 +1,134 @@
+/**
+ * @file MatrixText.h
+ * @brief Lectura y escritura rápidas de matrices en texto (CSV, TSV, espacios)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada fila de la matriz es una línea y los elementos se separan con
+ * TextFormat::delimiter. La escritura formatea bloques de filas en
+ * buffers propios (en paralelo con PARALLEL) y los envía al destino con
+ * una escritura por bloque, en lugar de pasar cada elemento por
+ * operator<<. La lectura carga el texto completo, lo divide en trozos
+ * por saltos de línea y convierte cada trozo directamente sobre las filas
+ * de la matriz resultado, también en paralelo con PARALLEL.
+ *
+ * Con precision < 0 (por defecto) los números en coma flotante se
+ * escriben con el menor número de dígitos que, leído de vuelta, da
+ * exactamente el mismo valor. Solo se admiten float, double e int.
+ *
+ * El separador decimal es siempre '.', sea cual sea la configuración
+ * regional (LC_NUMERIC) del proceso, y los números no tienen longitud
+ * máxima al leer.
+ *
+ * @code
+ * mathlib::TextFormat csv(',', mathlib::PARALLEL);
+ * mathlib::save_text("datos.csv", A, csv);
+ * Matrix B = mathlib::load_text<double>("datos.csv", csv);   // B == A
+ * mathlib::write_text(A, std::cout, mathlib::TextFormat('\t'));
+ * @endcode
+ */
+
+#ifndef MATRIX_TEXT_H
+#define MATRIX_TEXT_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include "Gemm.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @struct TextFormat
+ * @brief Formato de texto de una matriz
+ */
+struct TextFormat {
+    /**
+     * Separador entre elementos: ',' (CSV), '\t' (TSV), ';' o ' '. Al leer
+     * con ' ' cualquier secuencia de espacios y tabuladores separa dos
+     * elementos; con los demás se admiten espacios alrededor de cada uno.
+     */
+    char delimiter;
+    /// Dígitos significativos al escribir (como mucho 40); < 0 para la representación exacta más corta
+    int precision;
+    /// PARALLEL formatea y convierte los bloques en el grupo de hilos global
+    ExecutionPolicy policy;
+
+    explicit TextFormat(char delimiter = ',', ExecutionPolicy policy = SEQUENTIAL)
+        : delimiter(delimiter), precision(-1), policy(policy) {}
+};
+
+/**
+ * @brief Escribe la matriz como texto en un flujo
+ *
+ * @param m Matriz a escribir (float, double o int)
+ * @param out Flujo de destino; se escribe con out.write() por bloques
+ * @param format Separador, precisión y política
+ * @throws std::runtime_error Si el flujo falla
+ */
+template <class T>
+void write_text(const BasicMatrix<T>& m, std::ostream& out, const TextFormat& format = TextFormat());
+
+/**
+ * @brief Escribe la matriz como texto en un descriptor de archivo
+ *
+ * Útil para tuberías, sockets o la salida estándar (descriptor 1) sin
+ * pasar por los buffers de iostream.
+ *
+ * @param m Matriz a escribir (float, double o int)
+ * @param fd Descriptor abierto para escritura
+ * @param format Separador, precisión y política
+ * @throws std::runtime_error Si una escritura falla
+ */
+template <class T>
+void write_text(const BasicMatrix<T>& m, int fd, const TextFormat& format = TextFormat());
+
+/**
+ * @brief Guarda la matriz como texto en un archivo (que se crea o trunca)
+ *
+ * @throws std::runtime_error Si no se puede escribir el archivo
+ */
+template <class T>
+void save_text(const std::string& path, const BasicMatrix<T>& m, const TextFormat& format = TextFormat());
+
+/**
+ * @brief Convierte texto en memoria a una matriz
+ *
+ * Las líneas vacías se ignoran y se admiten finales de línea "\n" y
+ * "\r\n". Todas las filas deben tener el mismo número de elementos.
+ *
+ * @param data Texto (no necesita terminar en '\0')
+ * @param size Número de bytes de data
+ * @param format Separador y política (precision no se usa)
+ * @return Matriz con una fila por línea no vacía
+ * @throws std::runtime_error Si no hay datos, un elemento no es un
+ *         número válido o las filas tienen longitudes distintas (el
+ *         mensaje indica la fila)
+ */
+template <class T>
+BasicMatrix<T> parse_text(const char* data, std::size_t size, const TextFormat& format = TextFormat());
+
+/**
+ * @brief Lee una matriz en texto desde un flujo hasta su final
+ *
+ * @throws std::runtime_error En los mismos casos que parse_text()
+ */
+template <class T>
+BasicMatrix<T> read_text(std::istream& in, const TextFormat& format = TextFormat());
+
+/**
+ * @brief Lee una matriz en texto desde un archivo
+ *
+ * @throws std::runtime_error Si no se puede leer el archivo o en los
+ *         mismos casos que parse_text()
+ */
+template <class T>
+BasicMatrix<T> load_text(const std::string& path, const TextFormat& format = TextFormat());
+
+} // namespace mathlib
+
+#endif
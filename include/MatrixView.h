@@ -0,0 +1,297 @@
+/**
+ * @file MatrixView.h
+ * @brief Vistas sin propiedad sobre buffers externos y sub-bloques de matrices
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * BasicMatrixView<T> describe una matriz mediante un puntero, sus
+ * dimensiones y la separación entre filas, sin reservar ni copiar datos.
+ * Permite aplicar los kernels de la biblioteca directamente sobre
+ * memoria que ya pertenece a la aplicación (tramas de red, arrays de
+ * numpy, memoria de staging de la GPU) y sobre sub-bloques de una
+ * BasicMatrix existente.
+ *
+ * @code
+ * double* frame = recibir();                    // 64 x 64, por filas
+ * mathlib::ConstMatrixView A(frame, 64, 64);
+ * mathlib::multiply(A, W, out.block(0, 0, 64, 32));
+ * @endcode
+ *
+ * Las funciones libres de este archivo (multiply, add, subtract,
+ * hadamard, scale y copy) aceptan indistintamente vistas y matrices
+ * como operandos y como destino.
+ */
+
+#ifndef MATRIX_VIEW_H
+#define MATRIX_VIEW_H
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "Gemm.h"
+#include "MatrixExpr.h"
+#include "Span.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @class BasicMatrixView
+ * @brief Vista de r x c elementos con separación entre filas arbitraria
+ *
+ * @tparam T Tipo de elemento; const T para vistas de solo lectura
+ *
+ * Copiar una vista copia el descriptor, no los datos. La vista no
+ * controla la vida del buffer: debe seguir siendo válido mientras se use.
+ * Participa en las plantillas de expresión, de modo que
+ * Matrix D = vistaA + vistaB se evalúa en una sola pasada.
+ */
+template <class T>
+class BasicMatrixView : public MatrixExpr<BasicMatrixView<T> > {
+public:
+    /// Tipo de los elementos, sin calificador const
+    typedef typename std::remove_const<T>::type value_type;
+
+private:
+    T* ptr;    ///< Primer elemento
+    int rows;  ///< Número de filas
+    int cols;  ///< Número de columnas
+    int ld;    ///< Separación entre filas consecutivas, en elementos
+
+public:
+    /**
+     * @brief Vista sobre un buffer contiguo por filas
+     *
+     * @param data Puntero al primer elemento
+     * @param r Número de filas (>= 0)
+     * @param c Número de columnas (>= 0)
+     * @throws std::invalid_argument Si las dimensiones son negativas o data es NULL
+     */
+    BasicMatrixView(T* data, int r, int c) : ptr(data), rows(r), cols(c), ld(c) {
+        validate();
+    }
+
+    /**
+     * @brief Vista sobre un buffer con separación entre filas
+     *
+     * @param data Puntero al primer elemento
+     * @param r Número de filas (>= 0)
+     * @param c Número de columnas (>= 0)
+     * @param stride Separación entre filas, en elementos (>= c)
+     * @throws std::invalid_argument Si las dimensiones no son válidas o data es NULL
+     */
+    BasicMatrixView(T* data, int r, int c, int stride) : ptr(data), rows(r), cols(c), ld(stride) {
+        validate();
+    }
+
+    /**
+     * @brief Vista de solo lectura a partir de una vista modificable (o copia)
+     */
+    BasicMatrixView(const BasicMatrixView<value_type>& other)
+        : ptr(other.data()), rows(other.num_rows()), cols(other.num_cols()), ld(other.stride()) {}
+
+    /**
+     * @brief Vista sobre una matriz completa
+     */
+    BasicMatrixView(BasicMatrix<value_type>& m)
+        : ptr(m.data()), rows(m.num_rows()), cols(m.num_cols()), ld(m.stride()) {}
+
+    /**
+     * @brief Vista de solo lectura sobre una matriz completa
+     *
+     * Solo puede instanciarse cuando T es const.
+     */
+    BasicMatrixView(const BasicMatrix<value_type>& m)
+        : ptr(m.data()), rows(m.num_rows()), cols(m.num_cols()), ld(m.stride()) {}
+
+    int num_rows() const { return rows; }
+    int num_cols() const { return cols; }
+    int stride() const { return ld; }
+    T* data() const { return ptr; }
+
+    /// true si las filas son consecutivas en memoria (stride() == num_cols())
+    bool is_contiguous() const { return ld == cols || rows <= 1; }
+
+    /**
+     * @brief Acceso sin comprobación de límites (usado por las expresiones)
+     */
+    value_type coeff(int r, int c) const { return ptr[static_cast<std::size_t>(r) * ld + c]; }
+
+    /**
+     * @brief Acceso sin comprobación de límites en release (assert en depuración)
+     */
+    T& operator()(int r, int c) const {
+        assert(r >= 0 && r < rows && c >= 0 && c < cols && "MatrixView::operator() - Índice fuera de rango");
+        return ptr[static_cast<std::size_t>(r) * ld + c];
+    }
+
+    /**
+     * @brief Vista contigua de una fila
+     * @throws std::out_of_range Si r está fuera de rango
+     */
+    Span<T> row(int r) const {
+        if (r < 0 || r >= rows) {
+            throw std::out_of_range("MatrixView::row - Índice fuera de rango");
+        }
+        return Span<T>(ptr + static_cast<std::size_t>(r) * ld, static_cast<std::size_t>(cols));
+    }
+
+    /**
+     * @brief Sub-bloque de nr x nc elementos que empieza en (r0, c0)
+     *
+     * @throws std::out_of_range Si el bloque no cabe dentro de la vista
+     */
+    BasicMatrixView block(int r0, int c0, int nr, int nc) const {
+        if (r0 < 0 || c0 < 0 || nr < 0 || nc < 0 || r0 + nr > rows || c0 + nc > cols) {
+            throw std::out_of_range("MatrixView::block - El bloque excede los límites de la vista");
+        }
+        return BasicMatrixView(ptr + static_cast<std::size_t>(r0) * ld + c0, nr, nc, ld);
+    }
+
+private:
+    void validate() const {
+        if (rows < 0 || cols < 0) {
+            throw std::invalid_argument("MatrixView::MatrixView - Las dimensiones no pueden ser negativas");
+        }
+        if (ld < cols) {
+            throw std::invalid_argument("MatrixView::MatrixView - La separación entre filas es menor que el número de columnas");
+        }
+        if (ptr == NULL && rows > 0 && cols > 0) {
+            throw std::invalid_argument("MatrixView::MatrixView - El buffer es nulo");
+        }
+    }
+};
+
+/// Vista modificable de double
+typedef BasicMatrixView<double> MatrixView;
+
+/// Vista de solo lectura de double
+typedef BasicMatrixView<const double> ConstMatrixView;
+
+/**
+ * @brief Vista modificable de una matriz o copia de una vista
+ */
+template <class T>
+BasicMatrixView<T> make_view(BasicMatrix<T>& m) { return BasicMatrixView<T>(m); }
+
+/// @copydoc make_view
+template <class T>
+BasicMatrixView<const T> make_view(const BasicMatrix<T>& m) { return BasicMatrixView<const T>(m); }
+
+/// @copydoc make_view
+template <class T>
+BasicMatrixView<T> make_view(const BasicMatrixView<T>& v) { return v; }
+
+/**
+ * @brief Vista de solo lectura de una matriz o de una vista
+ */
+template <class T>
+BasicMatrixView<const T> make_const_view(const BasicMatrix<T>& m) { return BasicMatrixView<const T>(m); }
+
+/// @copydoc make_const_view
+template <class T>
+BasicMatrixView<const typename std::remove_const<T>::type> make_const_view(const BasicMatrixView<T>& v) {
+    return BasicMatrixView<const typename std::remove_const<T>::type>(v.data(), v.num_rows(),
+                                                                       v.num_cols(), v.stride());
+}
+
+namespace detail {
+
+// Implementaciones sobre vistas, instanciadas en MatrixView.cpp para
+// float, double, int y std::complex<double>
+
+template <class T>
+void multiply_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b,
+                    BasicMatrixView<T> out, ExecutionPolicy policy);
+
+template <class T>
+void add_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out);
+
+template <class T>
+void subtract_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out);
+
+template <class T>
+void hadamard_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out);
+
+template <class T>
+void scale_view(T alpha, BasicMatrixView<const T> a, BasicMatrixView<T> out);
+
+template <class T>
+void copy_view(BasicMatrixView<const T> src, BasicMatrixView<T> dst);
+
+} // namespace detail
+
+/**
+ * @brief out = a × b sobre vistas o matrices, sin reservar el resultado
+ *
+ * out debe tener ya las dimensiones a.rows x b.cols. Si out se solapa
+ * con a o con b, el producto se calcula en un temporal y luego se copia.
+ *
+ * @param a Operando izquierdo (vista o matriz)
+ * @param b Operando derecho (vista o matriz)
+ * @param out Destino (vista o matriz)
+ * @param policy Política de ejecución (por defecto en serie)
+ * @throws std::invalid_argument Si las dimensiones son incompatibles
+ */
+template <class A, class B, class C>
+void multiply(const A& a, const B& b, C&& out, ExecutionPolicy policy = SEQUENTIAL) {
+    detail::multiply_views(make_const_view(a), make_const_view(b), make_view(out), policy);
+}
+
+/**
+ * @brief out = a + b elemento a elemento sobre vistas o matrices
+ *
+ * out puede ser el mismo bloque que a o b (operación en el sitio), pero
+ * no debe solaparse parcialmente con ellos.
+ *
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class A, class B, class C>
+void add(const A& a, const B& b, C&& out) {
+    detail::add_views(make_const_view(a), make_const_view(b), make_view(out));
+}
+
+/**
+ * @brief out = a - b elemento a elemento sobre vistas o matrices
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class A, class B, class C>
+void subtract(const A& a, const B& b, C&& out) {
+    detail::subtract_views(make_const_view(a), make_const_view(b), make_view(out));
+}
+
+/**
+ * @brief out = a ∘ b (producto elemento a elemento) sobre vistas o matrices
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class A, class B, class C>
+void hadamard(const A& a, const B& b, C&& out) {
+    detail::hadamard_views(make_const_view(a), make_const_view(b), make_view(out));
+}
+
+/**
+ * @brief out = alpha * a sobre vistas o matrices
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class S, class A, class C>
+void scale(S alpha, const A& a, C&& out) {
+    typedef typename A::value_type T;
+    detail::scale_view(static_cast<T>(alpha), make_const_view(a), make_view(out));
+}
+
+/**
+ * @brief Copia los elementos de src en dst (mismas dimensiones)
+ * @throws std::invalid_argument Si las dimensiones no coinciden
+ */
+template <class A, class C>
+void copy(const A& src, C&& dst) {
+    detail::copy_view(make_const_view(src), make_view(dst));
+}
+
+} // namespace mathlib
+
+#endif
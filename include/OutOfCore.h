@@ -0,0 +1,88 @@
+/**
+ * @file OutOfCore.h
+ * @brief Multiplicación de matrices almacenadas en disco (fuera de memoria)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * multiply_out_of_core() calcula C = A × B cuando A, B y C están en el
+ * formato de MatrixFile.h y no caben en memoria. Las matrices se recorren
+ * por teselas cuyo tamaño se deriva de un presupuesto de memoria fijo:
+ * mientras se multiplican las teselas actuales, un hilo de E/S lee las
+ * siguientes, y cada tesela de C terminada se escribe en el archivo de
+ * salida en segundo plano mientras se calcula la siguiente.
+ *
+ * @code
+ * mathlib::OutOfCoreOptions opts;
+ * opts.memory_budget = 512u << 20;  // 512 MiB
+ * mathlib::multiply_out_of_core("A.mlm", "B.mlm", "C.mlm", opts);
+ * @endcode
+ */
+
+#ifndef OUT_OF_CORE_H
+#define OUT_OF_CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Gemm.h"
+
+namespace mathlib {
+
+/**
+ * @struct OutOfCoreOptions
+ * @brief Parámetros del motor fuera de memoria
+ */
+struct OutOfCoreOptions {
+    /// Bytes máximos para los buffers de teselas (doble buffer de A, B y C)
+    std::size_t memory_budget;
+
+    /// Política de ejecución del producto de cada tesela
+    ExecutionPolicy policy;
+
+    OutOfCoreOptions() : memory_budget(256u << 20), policy(SEQUENTIAL) {}
+};
+
+/**
+ * @struct OutOfCoreStats
+ * @brief Resumen de una ejecución de multiply_out_of_core()
+ */
+struct OutOfCoreStats {
+    int tile_rows;                ///< Filas de las teselas de A y C
+    int tile_cols;                ///< Columnas de las teselas de B y C
+    int tile_depth;               ///< Columnas de A / filas de B por tesela
+    std::size_t buffer_bytes;     ///< Memoria reservada para teselas
+    std::uint64_t bytes_read;     ///< Bytes leídos de A y B
+    std::uint64_t bytes_written;  ///< Bytes escritos en C
+};
+
+/**
+ * @brief C = A × B con los tres operandos en archivos de matriz
+ *
+ * Los tres buffers de teselas (A: tm x tk, B: tk x tn, C: tm x tn) se
+ * duplican para solapar E/S y cálculo, y hay uno más de tm x tn para el
+ * producto parcial; t = tm = tn = tk se elige para que 7·t²·sizeof(T)
+ * quepa en el presupuesto (ajustado a las dimensiones reales).
+ *
+ * Las teselas se leen con lecturas posicionales (pread/ReadFile) en
+ * lugar de mapear los operandos, de modo que la memoria residente queda
+ * acotada por el presupuesto y no por el tamaño de los archivos.
+ *
+ * @param a_path Archivo de A (m x k)
+ * @param b_path Archivo de B (k x n), mismo tipo de elemento que A
+ * @param out_path Archivo de C (m x n); se crea o se sobrescribe. No
+ *        puede ser el mismo archivo que a_path ni que b_path
+ * @param options Presupuesto de memoria y política de ejecución
+ * @return Tamaño de tesela y volumen de E/S de la ejecución
+ * @throws std::invalid_argument Si las dimensiones o los tipos no son
+ *         compatibles, out_path es uno de los operandos o el presupuesto
+ *         no admite ni una tesela de 1 x 1
+ * @throws std::runtime_error Si falla la E/S o un archivo no es válido
+ */
+OutOfCoreStats multiply_out_of_core(const std::string& a_path, const std::string& b_path,
+                                    const std::string& out_path,
+                                    const OutOfCoreOptions& options = OutOfCoreOptions());
+
+} // namespace mathlib
+
+#endif
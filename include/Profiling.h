@@ -0,0 +1,212 @@
+/**
+ * @file Profiling.h
+ * @brief Contadores de rendimiento por operación, opcionales en compilación
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Con la macro MATHLIB_PROFILING definida al compilar la biblioteca
+ * (opción de CMake MATHLIB_PROFILING=ON), cada operación pública registra
+ * número de llamadas, tiempo acumulado, FLOPs y un histograma de formas
+ * (m, n, k); las reservas de datos de Matrix registran además los bytes
+ * pedidos y el tiempo gastado dentro del asignador. Sin la macro,
+ * MATHLIB_PROFILE_SCOPE no genera código y profile_snapshot() devuelve
+ * contadores vacíos, de modo que el código que consulta las métricas
+ * compila igual en ambos casos.
+ *
+ * Los contadores son atómicos y pueden consultarse desde cualquier hilo
+ * mientras la biblioteca trabaja. Solo se cuentan las llamadas de la API
+ * pública (Matrix::multiply, SparseMatrix::multiply, las factorizaciones,
+ * ...), no los kernels internos que estas usan, para que los tiempos no
+ * se cuenten dos veces.
+ *
+ * @code
+ * mathlib::ProfileSnapshot s = mathlib::profile_snapshot();
+ * for (std::size_t i = 0; i < s.operations.size(); ++i) {
+ *     exportar(s.operations[i].name, s.operations[i].calls, s.operations[i].seconds);
+ * }
+ * @endcode
+ */
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace mathlib {
+
+/**
+ * @enum ProfileOp
+ * @brief Operaciones con contadores propios
+ */
+enum ProfileOp {
+    PROFILE_ALLOCATE,       ///< Reserva del bloque de datos de una matriz
+    PROFILE_ADD,            ///< Suma (add, add_inplace)
+    PROFILE_SUBTRACT,       ///< Resta (subtract, subtract_inplace)
+    PROFILE_HADAMARD,       ///< Producto elemento a elemento
+    PROFILE_SCALE,          ///< Escalado (scale, operator*=)
+    PROFILE_TRANSPOSE,      ///< Transposición
+    PROFILE_MULTIPLY,       ///< Producto de matrices densas
+    PROFILE_BATCHED,        ///< Producto por lotes
+    PROFILE_SPMM,           ///< Producto disperso por denso
+    PROFILE_SPMV,           ///< Producto disperso por vector
+    PROFILE_OUT_OF_CORE,    ///< Producto de matrices en disco
+    PROFILE_FACTORIZE,      ///< Factorización LU o de Cholesky
+    PROFILE_SOLVE,          ///< Resolución con una factorización
+    PROFILE_STRUCTURED,     ///< Producto de matrices simétricas, triangulares o de banda
+    PROFILE_GEMV,           ///< Producto de matriz densa por vector
+    PROFILE_OP_COUNT        ///< Número de operaciones (no es una operación)
+};
+
+/**
+ * @brief Nombre estable de una operación, para exportar métricas
+ *
+ * @return "multiply", "allocate", ...
+ */
+const char* profile_op_name(ProfileOp op);
+
+/**
+ * @struct OperationStats
+ * @brief Contadores acumulados de una operación
+ */
+struct OperationStats {
+    ProfileOp op;             ///< Operación
+    const char* name;         ///< profile_op_name(op)
+    unsigned long long calls; ///< Número de llamadas
+    double seconds;           ///< Tiempo total dentro de la operación
+    double flops;             ///< Operaciones en coma flotante (o enteras) realizadas
+    unsigned long long bytes; ///< Bytes reservados (solo PROFILE_ALLOCATE)
+};
+
+/**
+ * @struct ShapeStats
+ * @brief Llamadas de una operación con una forma concreta
+ *
+ * m, n y k son las dimensiones del producto (m x k por k x n); las
+ * operaciones de dos índices usan k = 0. Cuando se supera
+ * PROFILE_MAX_SHAPES formas distintas, el resto se acumula en una
+ * entrada con m = n = k = -1.
+ */
+struct ShapeStats {
+    ProfileOp op;             ///< Operación
+    int m;                    ///< Filas del resultado
+    int n;                    ///< Columnas del resultado
+    int k;                    ///< Dimensión compartida
+    unsigned long long calls; ///< Número de llamadas
+    double seconds;           ///< Tiempo total
+};
+
+/// Formas distintas que se registran como máximo en el histograma
+static const int PROFILE_MAX_SHAPES = 1024;
+
+/**
+ * @struct ProfileSnapshot
+ * @brief Copia de todos los contadores en un instante
+ */
+struct ProfileSnapshot {
+    bool enabled;                          ///< false si la biblioteca se compiló sin MATHLIB_PROFILING
+    std::vector<OperationStats> operations;  ///< Una entrada por ProfileOp, en orden
+    std::vector<ShapeStats> shapes;        ///< Histograma de formas, de más a menos llamadas
+};
+
+/**
+ * @brief Indica si la biblioteca se compiló con MATHLIB_PROFILING
+ */
+bool profiling_enabled();
+
+/**
+ * @brief Copia de los contadores actuales
+ *
+ * Puede llamarse en cualquier momento desde cualquier hilo; las
+ * operaciones en curso aparecen cuando terminan.
+ */
+ProfileSnapshot profile_snapshot();
+
+/**
+ * @brief Pone a cero todos los contadores y el histograma
+ */
+void profile_reset();
+
+/**
+ * @struct ProfileHooks
+ * @brief Funciones llamadas al empezar y terminar cada operación
+ *
+ * Permiten marcar las operaciones en herramientas externas: tareas de
+ * Intel ITT (VTune), marcadores de perf/LTTng, spans de trazado, etc.
+ * Se llaman desde el hilo que ejecuta la operación y deben ser seguras
+ * entre hilos. Cualquiera de los punteros puede ser nulo.
+ *
+ * @code
+ * // VTune: una tarea ITT por operación
+ * static __itt_domain* dominio = __itt_domain_create("mathlib");
+ * static void inicio(mathlib::ProfileOp op, int, int, int, void*) {
+ *     __itt_task_begin(dominio, __itt_null, __itt_null,
+ *                      __itt_string_handle_create(mathlib::profile_op_name(op)));
+ * }
+ * static void fin(mathlib::ProfileOp, void*) { __itt_task_end(dominio); }
+ * ...
+ * mathlib::set_profile_hooks(mathlib::ProfileHooks(inicio, fin, nullptr));
+ * @endcode
+ */
+struct ProfileHooks {
+    /// Inicio de la operación op con forma (m, n, k)
+    void (*begin)(ProfileOp op, int m, int n, int k, void* user);
+    /// Fin de la operación op
+    void (*end)(ProfileOp op, void* user);
+    /// Dato del usuario pasado a ambas funciones
+    void* user;
+
+    ProfileHooks() : begin(nullptr), end(nullptr), user(nullptr) {}
+    ProfileHooks(void (*b)(ProfileOp, int, int, int, void*), void (*e)(ProfileOp, void*), void* u)
+        : begin(b), end(e), user(u) {}
+};
+
+/**
+ * @brief Instala las funciones de marcado (sin efecto sin MATHLIB_PROFILING)
+ *
+ * No debe llamarse mientras haya operaciones en curso.
+ */
+void set_profile_hooks(const ProfileHooks& hooks);
+
+/**
+ * @class ProfileScope
+ * @brief Mide una operación desde su construcción hasta su destrucción
+ *
+ * No se usa directamente: MATHLIB_PROFILE_SCOPE crea uno solo cuando la
+ * biblioteca se compila con MATHLIB_PROFILING.
+ */
+class ProfileScope {
+public:
+    ProfileScope(ProfileOp op, int m, int n, int k, double flops, std::size_t bytes = 0);
+    ~ProfileScope();
+
+private:
+    ProfileScope(const ProfileScope&);
+    ProfileScope& operator=(const ProfileScope&);
+
+    ProfileOp op;
+    int m;
+    int n;
+    int k;
+    double flops;
+    std::size_t bytes;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace mathlib
+
+#if defined(MATHLIB_PROFILING)
+/// Mide el resto del ámbito actual como una llamada a op con forma (m, n, k)
+#define MATHLIB_PROFILE_SCOPE(op, m, n, k, flops) \
+    ::mathlib::ProfileScope mathlibProfileScope_((op), (m), (n), (k), (flops))
+/// Mide el resto del ámbito actual como una reserva de bytes bytes
+#define MATHLIB_PROFILE_ALLOCATION(bytes) \
+    ::mathlib::ProfileScope mathlibProfileScope_(::mathlib::PROFILE_ALLOCATE, 0, 0, 0, 0.0, (bytes))
+#else
+#define MATHLIB_PROFILE_SCOPE(op, m, n, k, flops) ((void)0)
+#define MATHLIB_PROFILE_ALLOCATION(bytes) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file Span.h
+ * @brief Vista ligera sobre un tramo contiguo de elementos
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Span<T> es un puntero más una longitud, sin propiedad de los datos.
+ * Se usa para exponer filas de una matriz a bucles críticos y kernels
+ * propios sin copias ni comprobaciones por elemento.
+ */
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cassert>
+#include <cstddef>
+
+namespace mathlib {
+
+/**
+ * @class Span
+ * @brief Tramo contiguo de size() elementos que empieza en data()
+ *
+ * El acceso con operator[] solo se comprueba con assert (compilaciones
+ * sin NDEBUG). La vista deja de ser válida si se libera o redimensiona
+ * la matriz de la que proviene.
+ *
+ * @code
+ * mathlib::Span<double> fila = m.row(2);
+ * for (std::size_t j = 0; j < fila.size(); ++j) fila[j] *= 0.5;
+ * @endcode
+ */
+template <class T>
+class Span {
+private:
+    T* ptr;             ///< Primer elemento
+    std::size_t count;  ///< Número de elementos
+
+public:
+    typedef T value_type;
+    typedef T* iterator;
+
+    Span() : ptr(NULL), count(0) {}
+    Span(T* data, std::size_t size) : ptr(data), count(size) {}
+
+    /// Un Span<T> se convierte implícitamente en Span<const T>
+    operator Span<const T>() const { return Span<const T>(ptr, count); }
+
+    T* data() const { return ptr; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    T* begin() const { return ptr; }
+    T* end() const { return ptr + count; }
+
+    /**
+     * @brief Acceso sin comprobación de límites en modo release
+     */
+    T& operator[](std::size_t i) const {
+        assert(i < count && "Span::operator[] - Índice fuera de rango");
+        return ptr[i];
+    }
+};
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * @file SparseMatrix.h
+ * @brief Matrices dispersas en formato CSR/CSC y productos con matrices densas
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * BasicSparseMatrix guarda solo los elementos distintos de cero en uno de
+ * los dos formatos comprimidos habituales:
+ *
+ * - CSR (por filas): offsets tiene rows + 1 entradas y los elementos de la
+ *   fila i ocupan [offsets[i], offsets[i + 1]) en indices (columnas) y
+ *   values.
+ * - CSC (por columnas): lo mismo intercambiando filas y columnas.
+ *
+ * Dentro de cada fila (o columna) los índices están ordenados y no se
+ * repiten. El producto por una matriz densa (SpMM) y por un vector (SpMV)
+ * solo recorre los elementos almacenados; en CSR se reparte por filas
+ * entre los hilos con PARALLEL.
+ *
+ * @code
+ * std::vector<mathlib::SparseEntry<double> > aristas;
+ * aristas.push_back(mathlib::SparseEntry<double>(0, 3, 1.0));
+ * ...
+ * mathlib::SparseMatrix G = mathlib::SparseMatrix::from_triplets(n, n, aristas);
+ * Matrix Y = G.multiply(X, mathlib::PARALLEL);   // Y = G × X
+ * @endcode
+ */
+
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include "Gemm.h"
+#include "Span.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @enum SparseLayout
+ * @brief Formato comprimido de una matriz dispersa
+ */
+enum SparseLayout {
+    SPARSE_CSR,  ///< Compressed Sparse Row: acceso rápido por filas
+    SPARSE_CSC   ///< Compressed Sparse Column: acceso rápido por columnas
+};
+
+/**
+ * @struct SparseEntry
+ * @brief Elemento (fila, columna, valor) para construir matrices dispersas
+ */
+template <class T>
+struct SparseEntry {
+    int row;   ///< Fila del elemento
+    int col;   ///< Columna del elemento
+    T value;   ///< Valor del elemento
+
+    SparseEntry() : row(0), col(0), value() {}
+    SparseEntry(int r, int c, T v) : row(r), col(c), value(v) {}
+};
+
+/**
+ * @class BasicSparseMatrix
+ * @brief Matriz dispersa en formato CSR o CSC
+ *
+ * @tparam T Tipo de los elementos; instanciada para float, double, int y
+ *         std::complex<double>. SparseMatrix es el alias de
+ *         BasicSparseMatrix<double>.
+ */
+template <class T>
+class BasicSparseMatrix {
+public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Matriz dispersa de r x c sin elementos almacenados (todo ceros)
+     *
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @param layout Formato de almacenamiento
+     * @throws std::invalid_argument Si las dimensiones no son positivas
+     */
+    BasicSparseMatrix(int r, int c, SparseLayout layout = SPARSE_CSR);
+
+    /**
+     * @brief Construye la matriz a partir de sus arreglos comprimidos
+     *
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @param layout Formato de los arreglos
+     * @param offsets Inicio de cada fila (CSR) o columna (CSC), más el final
+     * @param indices Columna (CSR) o fila (CSC) de cada elemento
+     * @param values Valor de cada elemento
+     * @throws std::invalid_argument Si los arreglos no describen una
+     *         matriz válida (tamaños, offsets no crecientes, índices fuera
+     *         de rango, desordenados o repetidos)
+     */
+    BasicSparseMatrix(int r, int c, SparseLayout layout,
+                      const std::vector<std::size_t>& offsets,
+                      const std::vector<int>& indices,
+                      const std::vector<T>& values);
+
+    /**
+     * @brief Construye una matriz a partir de una lista de elementos
+     *
+     * La lista puede estar en cualquier orden; los elementos repetidos en
+     * la misma posición se suman. Coste O(nnz + filas + columnas) con dos
+     * pasadas de ordenación por conteo.
+     *
+     * @param r Número de filas (debe ser mayor a 0)
+     * @param c Número de columnas (debe ser mayor a 0)
+     * @param entries Elementos
+     * @param layout Formato de la matriz resultante
+     * @return Matriz dispersa
+     * @throws std::invalid_argument Si las dimensiones no son positivas
+     * @throws std::out_of_range Si algún elemento cae fuera de la matriz
+     */
+    static BasicSparseMatrix from_triplets(int r, int c, const std::vector<SparseEntry<T> >& entries,
+                                           SparseLayout layout = SPARSE_CSR);
+
+    /**
+     * @brief Convierte una matriz densa descartando los elementos pequeños
+     *
+     * @param dense Matriz de origen
+     * @param threshold Se guardan solo los elementos con |a(i, j)| > threshold;
+     *        con 0 se descartan exactamente los ceros
+     * @param layout Formato de la matriz resultante
+     * @return Matriz dispersa
+     */
+    static BasicSparseMatrix from_dense(const BasicMatrix<T>& dense, double threshold = 0.0,
+                                        SparseLayout layout = SPARSE_CSR);
+
+    /// Número de filas
+    int num_rows() const { return rows; }
+
+    /// Número de columnas
+    int num_cols() const { return cols; }
+
+    /// Número de elementos almacenados
+    std::size_t nnz() const { return vals.size(); }
+
+    /// Formato de almacenamiento
+    SparseLayout layout() const { return format; }
+
+    /// Inicio de cada fila (CSR) o columna (CSC); tiene rows + 1 (o cols + 1) entradas
+    const std::vector<std::size_t>& offsets() const { return starts; }
+
+    /// Columna (CSR) o fila (CSC) de cada elemento almacenado
+    const std::vector<int>& indices() const { return idx; }
+
+    /// Valor de cada elemento almacenado
+    const std::vector<T>& values() const { return vals; }
+
+    /**
+     * @brief Valor del elemento (r, c), con búsqueda binaria
+     *
+     * @throws std::out_of_range Si la posición no existe
+     */
+    T get(int r, int c) const;
+
+    /**
+     * @brief Copia de la matriz en el otro formato (o en el mismo)
+     *
+     * Coste O(nnz + filas + columnas).
+     */
+    BasicSparseMatrix to_layout(SparseLayout target) const;
+
+    /**
+     * @brief Transpuesta sin reordenar: la CSR de A es la CSC de Aᵀ
+     *
+     * Solo copia los arreglos e intercambia dimensiones y formato.
+     */
+    BasicSparseMatrix transpose() const;
+
+    /**
+     * @brief Matriz densa equivalente
+     */
+    BasicMatrix<T> to_dense() const;
+
+    /**
+     * @brief Producto por una matriz densa, SpMM: this × dense
+     *
+     * En CSR cada fila del resultado es una combinación de filas de dense
+     * calculada con vec_axpy(); con PARALLEL las filas se reparten entre los
+     * hilos en bloques con un número parecido de elementos. En CSC el
+     * producto se calcula en serie; conviértase a CSR con to_layout() si
+     * se va a multiplicar muchas veces en paralelo.
+     *
+     * @param dense Matriz de cols x n
+     * @param policy Política de ejecución
+     * @return Matriz densa de rows x n
+     * @throws std::invalid_argument Si las dimensiones son incompatibles
+     */
+    BasicMatrix<T> multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy = SEQUENTIAL) const;
+
+    /**
+     * @brief Calcula out = this × dense reutilizando el bloque de out
+     *
+     * @param dense Matriz de cols x n
+     * @param out Destino; se redimensiona a rows x n si hace falta; no
+     *        debe ser la misma matriz que dense
+     * @param policy Política de ejecución
+     * @throws std::invalid_argument Si las dimensiones son incompatibles
+     */
+    void multiply_into(const BasicMatrix<T>& dense, BasicMatrix<T>& out,
+                       ExecutionPolicy policy = SEQUENTIAL) const;
+
+    /**
+     * @brief Producto por un vector, SpMV: y = this × x
+     *
+     * @param x Vector de cols elementos
+     * @param y Vector de rows elementos; se sobrescribe y no debe solaparse con x
+     * @param policy Política de ejecución (paralela solo en CSR)
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    void multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy = SEQUENTIAL) const;
+
+private:
+    /// Número de filas (CSR) o columnas (CSC) comprimidas
+    int outerSize() const { return format == SPARSE_CSR ? rows : cols; }
+
+    /// Tamaño de la dimensión de los índices
+    int innerSize() const { return format == SPARSE_CSR ? cols : rows; }
+
+    void validate() const;
+
+    int rows;                           ///< Número de filas
+    int cols;                           ///< Número de columnas
+    SparseLayout format;                ///< Formato de almacenamiento
+    std::vector<std::size_t> starts;    ///< Inicio de cada fila o columna
+    std::vector<int> idx;               ///< Índice interno de cada elemento
+    std::vector<T> vals;                ///< Valor de cada elemento
+};
+
+/// Matriz dispersa de doble precisión
+typedef BasicSparseMatrix<double> SparseMatrix;
+
+// Instancias compiladas en SparseMatrix.cpp
+extern template class BasicSparseMatrix<float>;
+extern template class BasicSparseMatrix<double>;
+extern template class BasicSparseMatrix<int>;
+extern template class BasicSparseMatrix<std::complex<double> >;
+
+} // namespace mathlib
+
+#endif
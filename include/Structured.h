@@ -0,0 +1,407 @@
+/**
+ * @file Structured.h
+ * @brief Matrices simétricas, triangulares y de banda con productos especializados
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Estas clases guardan solo la parte con información de una matriz con
+ * estructura conocida y calculan sus productos sin tocar el resto:
+ *
+ * - BasicSymmetricMatrix: triángulo inferior empaquetado por filas,
+ *   n·(n + 1)/2 elementos (la mitad que la matriz densa). El producto por
+ *   una matriz densa (SYMM) desempaqueta paneles de filas y usa el GEMM
+ *   de la biblioteca; el producto por un vector (SYMV) lee cada elemento
+ *   empaquetado una sola vez.
+ * - BasicTriangularMatrix: triángulo superior o inferior empaquetado por
+ *   filas. El producto (TRMM) solo multiplica la parte del triángulo, con
+ *   la mitad de operaciones que el producto denso.
+ * - BasicBandedMatrix: matriz de m x n con kl subdiagonales y ku
+ *   superdiagonales guardadas por filas, m·(kl + ku + 1) elementos. Los
+ *   productos por vector (GBMV) y por matriz densa recorren solo la banda.
+ *
+ * Todas se convierten desde y hacia BasicMatrix con from_dense() y
+ * to_dense().
+ *
+ * @code
+ * mathlib::SymmetricMatrix S = mathlib::SymmetricMatrix::from_dense(cov);
+ * Matrix Y = S.multiply(X, mathlib::PARALLEL);      // Y = S × X
+ *
+ * mathlib::BandedMatrix L(n, n, 1, 1);               // tridiagonal
+ * for (int i = 0; i < n; ++i) L.set(i, i, -2.0);
+ * ...
+ * L.multiply_vector(u, du);
+ * @endcode
+ */
+
+#ifndef STRUCTURED_H
+#define STRUCTURED_H
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include "Gemm.h"
+#include "Span.h"
+
+template <class T>
+class BasicMatrix;
+
+namespace mathlib {
+
+/**
+ * @enum Uplo
+ * @brief Triángulo de una matriz cuadrada
+ */
+enum Uplo {
+    UPPER,  ///< Diagonal y elementos por encima (j >= i)
+    LOWER   ///< Diagonal y elementos por debajo (j <= i)
+};
+
+/**
+ * @class BasicSymmetricMatrix
+ * @brief Matriz simétrica de n x n con el triángulo inferior empaquetado
+ *
+ * El elemento (i, j) con j <= i ocupa la posición i·(i + 1)/2 + j de
+ * packed(); (j, i) es el mismo elemento.
+ *
+ * @tparam T Tipo de los elementos; instanciada para float, double, int y
+ *         std::complex<double> (simétrica, no hermítica). SymmetricMatrix
+ *         es el alias de BasicSymmetricMatrix<double>.
+ */
+template <class T>
+class BasicSymmetricMatrix {
+public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Matriz simétrica de n x n inicializada con ceros
+     *
+     * @throws std::invalid_argument Si n no es positivo
+     */
+    explicit BasicSymmetricMatrix(int n);
+
+    /**
+     * @brief Toma un triángulo de una matriz densa cuadrada
+     *
+     * @param dense Matriz de origen; el otro triángulo no se lee
+     * @param uplo Triángulo que se copia
+     * @throws std::invalid_argument Si dense no es cuadrada
+     */
+    static BasicSymmetricMatrix from_dense(const BasicMatrix<T>& dense, Uplo uplo = LOWER);
+
+    /// Matriz densa equivalente (con los dos triángulos)
+    BasicMatrix<T> to_dense() const;
+
+    /// Orden de la matriz
+    int size() const { return n; }
+    int num_rows() const { return n; }
+    int num_cols() const { return n; }
+
+    /// Elementos del triángulo inferior empaquetados por filas
+    const std::vector<T>& packed() const { return vals; }
+
+    /**
+     * @brief Valor del elemento (r, c), igual al de (c, r)
+     *
+     * @throws std::out_of_range Si la posición no existe
+     */
+    T get(int r, int c) const;
+
+    /**
+     * @brief Asigna (r, c) y, por simetría, (c, r)
+     *
+     * @throws std::out_of_range Si la posición no existe
+     */
+    void set(int r, int c, T value);
+
+    /**
+     * @brief Suma elemento a elemento sobre los datos empaquetados
+     *
+     * @throws std::invalid_argument Si los órdenes no coinciden
+     */
+    BasicSymmetricMatrix add(const BasicSymmetricMatrix& other) const;
+
+    /**
+     * @brief Producto por una matriz densa, SYMM: this × dense
+     *
+     * Cada panel de filas de la matriz se desempaqueta en un búfer y se
+     * multiplica por dense con gemm(); con PARALLEL los paneles se
+     * reparten entre los hilos.
+     *
+     * @param dense Matriz de size() x k
+     * @param policy Política de ejecución
+     * @return Matriz densa de size() x k
+     * @throws std::invalid_argument Si las dimensiones son incompatibles
+     */
+    BasicMatrix<T> multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy = SEQUENTIAL) const;
+
+    /**
+     * @brief Producto por un vector, SYMV: y = this × x
+     *
+     * Cada fila empaquetada contribuye a la vez a y(i) (producto escalar) y
+     * a y(0..i - 1) (axpy), de modo que los datos se leen una sola vez.
+     * Con PARALLEL cada hilo acumula un bloque de filas en su propio vector
+     * y las sumas parciales se combinan al final.
+     *
+     * @param x Vector de size() elementos
+     * @param y Vector de size() elementos; se sobrescribe y no debe solaparse con x
+     * @param policy Política de ejecución
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    void multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy = SEQUENTIAL) const;
+
+private:
+    std::size_t offset(int r, int c) const;
+
+    int n;               ///< Orden de la matriz
+    std::vector<T> vals; ///< Triángulo inferior empaquetado por filas
+};
+
+/**
+ * @class BasicTriangularMatrix
+ * @brief Matriz triangular de n x n empaquetada por filas
+ *
+ * En LOWER la fila i guarda las columnas 0..i a partir de i·(i + 1)/2; en
+ * UPPER guarda las columnas i..n - 1 a partir de i·n - i·(i - 1)/2. Los
+ * elementos del otro triángulo son cero y no se guardan.
+ *
+ * @tparam T Tipo de los elementos; instanciada para float, double, int y
+ *         std::complex<double>. TriangularMatrix es el alias de
+ *         BasicTriangularMatrix<double>.
+ */
+template <class T>
+class BasicTriangularMatrix {
+public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Matriz triangular de n x n inicializada con ceros
+     *
+     * @throws std::invalid_argument Si n no es positivo
+     */
+    BasicTriangularMatrix(int n, Uplo uplo);
+
+    /**
+     * @brief Copia el triángulo uplo de una matriz densa cuadrada
+     *
+     * @throws std::invalid_argument Si dense no es cuadrada
+     */
+    static BasicTriangularMatrix from_dense(const BasicMatrix<T>& dense, Uplo uplo);
+
+    /// Matriz densa equivalente (con ceros en el otro triángulo)
+    BasicMatrix<T> to_dense() const;
+
+    int size() const { return n; }
+    int num_rows() const { return n; }
+    int num_cols() const { return n; }
+
+    /// Triángulo guardado
+    Uplo uplo() const { return part; }
+
+    /// Elementos del triángulo empaquetados por filas
+    const std::vector<T>& packed() const { return vals; }
+
+    /**
+     * @brief Valor del elemento (r, c); cero fuera del triángulo
+     *
+     * @throws std::out_of_range Si la posición no existe
+     */
+    T get(int r, int c) const;
+
+    /**
+     * @brief Asigna un elemento del triángulo
+     *
+     * @throws std::out_of_range Si la posición no existe o cae fuera del triángulo
+     */
+    void set(int r, int c, T value);
+
+    /**
+     * @brief Suma de dos matrices triangulares del mismo tipo
+     *
+     * @throws std::invalid_argument Si los órdenes o los triángulos no coinciden
+     */
+    BasicTriangularMatrix add(const BasicTriangularMatrix& other) const;
+
+    /**
+     * @brief Producto por una matriz densa, TRMM: this × dense
+     *
+     * Cada panel de filas se desempaqueta solo hasta (LOWER) o desde
+     * (UPPER) su bloque diagonal, así que gemm() hace en total la mitad
+     * de operaciones que el producto denso.
+     *
+     * @param dense Matriz de size() x k
+     * @param policy Política de ejecución
+     * @return Matriz densa de size() x k
+     * @throws std::invalid_argument Si las dimensiones son incompatibles
+     */
+    BasicMatrix<T> multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy = SEQUENTIAL) const;
+
+    /**
+     * @brief Producto por un vector, TRMV: y = this × x
+     *
+     * @param x Vector de size() elementos
+     * @param y Vector de size() elementos; se sobrescribe y no debe solaparse con x
+     * @param policy Política de ejecución
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    void multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy = SEQUENTIAL) const;
+
+private:
+    /// Posición del primer elemento guardado de la fila r
+    std::size_t rowStart(int r) const;
+
+    /// Primera columna guardada de la fila r
+    int firstCol(int r) const { return part == LOWER ? 0 : r; }
+
+    /// Una más que la última columna guardada de la fila r
+    int lastCol(int r) const { return part == LOWER ? r + 1 : n; }
+
+    int n;               ///< Orden de la matriz
+    Uplo part;           ///< Triángulo guardado
+    std::vector<T> vals; ///< Triángulo empaquetado por filas
+};
+
+/**
+ * @class BasicBandedMatrix
+ * @brief Matriz de banda de m x n guardada por filas
+ *
+ * Cada fila i guarda kl + ku + 1 elementos, las columnas i - kl .. i + ku;
+ * el elemento (i, j) ocupa la posición i·(kl + ku + 1) + (j - i + kl) de
+ * band(). Las posiciones que caen fuera de la matriz (al principio de las
+ * primeras filas y al final de las últimas) valen cero y no se usan.
+ *
+ * @tparam T Tipo de los elementos; instanciada para float, double, int y
+ *         std::complex<double>. BandedMatrix es el alias de
+ *         BasicBandedMatrix<double>.
+ */
+template <class T>
+class BasicBandedMatrix {
+public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Matriz de banda de r x c inicializada con ceros
+     *
+     * @param kl Número de subdiagonales
+     * @param ku Número de superdiagonales (los anchos mayores que la matriz
+     *        se reducen a r - 1 y c - 1)
+     * @throws std::invalid_argument Si las dimensiones no son positivas o
+     *         algún ancho de banda es negativo
+     */
+    BasicBandedMatrix(int r, int c, int kl, int ku);
+
+    /**
+     * @brief Copia la banda de una matriz densa
+     *
+     * Los elementos de dense fuera de la banda se descartan.
+     *
+     * @throws std::invalid_argument Si algún ancho de banda es negativo
+     */
+    static BasicBandedMatrix from_dense(const BasicMatrix<T>& dense, int kl, int ku);
+
+    /// Matriz densa equivalente (con ceros fuera de la banda)
+    BasicMatrix<T> to_dense() const;
+
+    int num_rows() const { return rows; }
+    int num_cols() const { return cols; }
+
+    /// Número de subdiagonales
+    int lower_bandwidth() const { return lower; }
+
+    /// Número de superdiagonales
+    int upper_bandwidth() const { return upper; }
+
+    /// Elementos de la banda por filas, kl + ku + 1 por fila
+    const std::vector<T>& band() const { return vals; }
+
+    /**
+     * @brief Valor del elemento (r, c); cero fuera de la banda
+     *
+     * @throws std::out_of_range Si la posición no existe
+     */
+    T get(int r, int c) const;
+
+    /**
+     * @brief Asigna un elemento de la banda
+     *
+     * @throws std::out_of_range Si la posición no existe o cae fuera de la banda
+     */
+    void set(int r, int c, T value);
+
+    /**
+     * @brief Suma de dos matrices de banda del mismo tamaño
+     *
+     * El resultado tiene los mayores anchos de banda de los dos operandos.
+     *
+     * @throws std::invalid_argument Si las dimensiones no coinciden
+     */
+    BasicBandedMatrix add(const BasicBandedMatrix& other) const;
+
+    /**
+     * @brief Producto por una matriz densa: this × dense
+     *
+     * Cada fila del resultado combina con vec_axpy() las filas de dense
+     * que indica la banda; con PARALLEL las filas se reparten entre los hilos.
+     *
+     * @param dense Matriz de num_cols() x k
+     * @param policy Política de ejecución
+     * @return Matriz densa de num_rows() x k
+     * @throws std::invalid_argument Si las dimensiones son incompatibles
+     */
+    BasicMatrix<T> multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy = SEQUENTIAL) const;
+
+    /**
+     * @brief Producto por un vector, GBMV: y = this × x
+     *
+     * @param x Vector de num_cols() elementos
+     * @param y Vector de num_rows() elementos; se sobrescribe y no debe solaparse con x
+     * @param policy Política de ejecución
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    void multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy = SEQUENTIAL) const;
+
+private:
+    /// Anchura de cada fila guardada
+    int width() const { return lower + upper + 1; }
+
+    /// Posición tal que band()[rowBase(r) + c] es el elemento (r, c)
+    std::size_t rowBase(int r) const { return static_cast<std::size_t>(r) * (lower + upper) + lower; }
+
+    /// Primera columna de la matriz dentro de la banda de la fila r
+    int firstCol(int r) const { return r - lower > 0 ? r - lower : 0; }
+
+    /// Una más que la última columna de la matriz dentro de la banda de la fila r
+    int lastCol(int r) const { return r + upper + 1 < cols ? r + upper + 1 : cols; }
+
+    int rows;            ///< Número de filas
+    int cols;            ///< Número de columnas
+    int lower;           ///< Subdiagonales
+    int upper;           ///< Superdiagonales
+    std::vector<T> vals; ///< Banda por filas
+};
+
+/// Matrices estructuradas de doble precisión
+typedef BasicSymmetricMatrix<double> SymmetricMatrix;
+typedef BasicTriangularMatrix<double> TriangularMatrix;
+typedef BasicBandedMatrix<double> BandedMatrix;
+
+// Instancias compiladas en Structured.cpp
+extern template class BasicSymmetricMatrix<float>;
+extern template class BasicSymmetricMatrix<double>;
+extern template class BasicSymmetricMatrix<int>;
+extern template class BasicSymmetricMatrix<std::complex<double> >;
+extern template class BasicTriangularMatrix<float>;
+extern template class BasicTriangularMatrix<double>;
+extern template class BasicTriangularMatrix<int>;
+extern template class BasicTriangularMatrix<std::complex<double> >;
+extern template class BasicBandedMatrix<float>;
+extern template class BasicBandedMatrix<double>;
+extern template class BasicBandedMatrix<int>;
+extern template class BasicBandedMatrix<std::complex<double> >;
+
+} // namespace mathlib
+
+#endif
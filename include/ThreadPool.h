@@ -0,0 +1,151 @@
+/**
+ * @file ThreadPool.h
+ * @brief Grupo de hilos persistente con robo de trabajo
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Este archivo declara el grupo de hilos de la biblioteca. Los hilos se
+ * crean una sola vez y se reutilizan en todas las operaciones paralelas.
+ * Cada hilo tiene su propia cola de tareas; cuando se queda sin trabajo
+ * roba tareas de las colas de los demás, lo que equilibra la carga aunque
+ * las teselas tarden tiempos distintos.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mathlib {
+
+/**
+ * @class ThreadPool
+ * @brief Grupo de hilos con una cola de tareas por hilo y robo de trabajo
+ *
+ * El hilo que llama a parallel_for() también ejecuta tareas mientras
+ * espera, de modo que las llamadas anidadas no bloquean el grupo.
+ *
+ * @code
+ * mathlib::ThreadPool pool(8, true);     // 8 hilos fijados a núcleos
+ * pool.parallel_for(100, [&](int i) { procesar(i); });
+ * @endcode
+ */
+class ThreadPool {
+public:
+    /// Tarea sin argumentos ejecutada por un hilo del grupo
+    typedef std::function<void()> Task;
+
+    /**
+     * @brief Crea el grupo y arranca sus hilos
+     *
+     * @param thread_count Número de hilos; 0 usa std::thread::hardware_concurrency()
+     * @param pin_threads Si es true, el hilo i se fija al procesador lógico i
+     *        (en sistemas que lo permiten: Linux y Windows)
+     */
+    explicit ThreadPool(int thread_count = 0, bool pin_threads = false);
+
+    /**
+     * @brief Termina las tareas pendientes y detiene los hilos
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Número de hilos del grupo
+     * @return Cantidad de hilos trabajadores
+     */
+    int size() const { return static_cast<int>(threads.size()); }
+
+    /**
+     * @brief Indica si los hilos se fijaron a procesadores concretos
+     * @return true si se solicitó la fijación al crear el grupo
+     */
+    bool pinned() const { return pinThreads; }
+
+    /**
+     * @brief Encola una tarea para ejecución asíncrona
+     *
+     * Si se llama desde un hilo del grupo la tarea va a su propia cola;
+     * en otro caso se reparte entre las colas por turnos.
+     *
+     * @param task Tarea a ejecutar
+     */
+    void submit(const Task& task);
+
+    /**
+     * @brief Ejecuta body(i) para i en [0, count) y espera a que terminen
+     *
+     * Las iteraciones se reparten entre las colas de los hilos y el hilo
+     * llamante colabora ejecutando tareas. Si alguna iteración lanza una
+     * excepción, se relanza la primera en el hilo llamante una vez
+     * terminadas todas.
+     *
+     * @param count Número de iteraciones independientes
+     * @param body Función a ejecutar por cada índice
+     */
+    void parallel_for(int count, const std::function<void(int)>& body);
+
+    /**
+     * @brief Ejecuta en el hilo llamante una tarea pendiente, si la hay
+     *
+     * Permite colaborar con el grupo mientras se espera un resultado en
+     * lugar de bloquear el hilo.
+     *
+     * @return true si se ejecutó una tarea
+     */
+    bool run_pending_task();
+
+    /**
+     * @brief Grupo compartido por toda la biblioteca
+     *
+     * Se crea en el primer uso con el número de hilos indicado por la
+     * variable de entorno MATHLIB_THREADS (o los calibrados en Tuning.h, o
+     * todos los disponibles) y con fijación si MATHLIB_PIN_THREADS=1.
+     * Después solo cuesta una lectura atómica: el cerrojo se toma al
+     * crearlo o al reemplazarlo con configure_global().
+     *
+     * @return Referencia al grupo global
+     */
+    static ThreadPool& global();
+
+    /**
+     * @brief Reemplaza el grupo global por uno nuevo
+     *
+     * El grupo anterior se destruye, así que no debe llamarse mientras
+     * otros hilos ejecutan operaciones con el grupo global ni conservan
+     * referencias obtenidas con global(): redimensionar el grupo no es
+     * seguro con trabajo concurrente.
+     *
+     * @param thread_count Número de hilos; 0 usa todos los disponibles
+     * @param pin_threads Fijar cada hilo a un procesador lógico
+     */
+    static void configure_global(int thread_count, bool pin_threads);
+
+private:
+    struct Queue;
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    void push(int queue, const Task& task);
+    bool tryRun(int self);
+    void workerLoop(int index);
+
+    std::vector<Queue*> queues;          ///< Cola de tareas de cada hilo
+    std::vector<std::thread> threads;    ///< Hilos trabajadores
+    std::mutex sleepMutex;               ///< Protege la espera de los hilos ociosos
+    std::condition_variable wake;        ///< Despierta a los hilos ociosos
+    std::atomic<int> pending;            ///< Tareas encoladas aún no tomadas
+    std::atomic<unsigned> nextQueue;     ///< Turno para repartir tareas externas
+    bool stopping;                       ///< Indica que el grupo se está destruyendo
+    bool pinThreads;                     ///< Fijación de hilos solicitada
+};
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * @file Transpose.h
+ * @brief Transposición de bloques por recursión independiente de la caché
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Transponer elemento a elemento recorre el origen por filas y el
+ * destino por columnas, de modo que cada escritura toca una línea de
+ * caché distinta. Estos kernels dividen por la mitad la dimensión mayor
+ * hasta llegar a teselas de TRANSPOSE_TILE x TRANSPOSE_TILE, que caben
+ * en L1 tanto en el origen como en el destino; así el recorrido aprovecha
+ * todos los niveles de caché sin conocer sus tamaños.
+ *
+ * Como los de Gemm.h, trabajan sobre bloques por filas descritos por un
+ * puntero y una separación entre filas, y están instanciados para float,
+ * double, int y std::complex<double>.
+ */
+
+#ifndef TRANSPOSE_H
+#define TRANSPOSE_H
+
+namespace mathlib {
+
+/// Lado de las teselas en las que termina la recursión
+static const int TRANSPOSE_TILE = 32;
+
+/**
+ * @brief Escribe en dst la transpuesta de src
+ *
+ * @param rows Filas de src (columnas de dst)
+ * @param cols Columnas de src (filas de dst)
+ * @param src Puntero a src (rows x cols) con separación lds
+ * @param lds Separación entre filas de src
+ * @param dst Puntero a dst (cols x rows) con separación ldd; no debe
+ *        solaparse con src
+ * @param ldd Separación entre filas de dst
+ */
+template <class T>
+void transpose(int rows, int cols, const T* src, int lds, T* dst, int ldd);
+
+/**
+ * @brief Transpone en el sitio un bloque cuadrado
+ *
+ * Intercambia cada elemento (i, j) con el (j, i) recorriendo las
+ * parejas de teselas simétricas respecto a la diagonal.
+ *
+ * @param n Dimensión del bloque
+ * @param a Puntero al bloque (n x n) con separación lda
+ * @param lda Separación entre filas
+ */
+template <class T>
+void transpose_inplace(int n, T* a, int lda);
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file Tuning.h
+ * @brief Parámetros de despacho calibrados por equipo (auto-ajuste)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los tamaños de bloque de GEMM, los umbrales entre el kernel de
+ * referencia, el serie y el paralelo, el punto de corte de Strassen y el
+ * número de hilos del grupo global tienen valores por defecto razonables,
+ * pero el óptimo cambia de una generación de CPU a otra. autotune() mide
+ * varias configuraciones candidatas en el equipo actual y save_tuning()
+ * guarda la ganadora en un fichero de texto pequeño por equipo, que la
+ * biblioteca carga la primera vez que consulta tuning(): el despacho usa
+ * entonces los valores del equipo sin ninguna búsqueda en tiempo de
+ * ejecución.
+ *
+ * El fichero es tuning_file_path(): la variable de entorno
+ * MATHLIB_TUNING_FILE o, si no existe,
+ * $XDG_CONFIG_HOME/mathlib/tuning-<equipo>.conf (o ~/.config/...). La
+ * herramienta mathlib_tune lo genera; con MATHLIB_TUNING=auto la
+ * calibración se hace sola en la primera ejecución si el fichero no
+ * existe, y con MATHLIB_TUNING=off se ignora y se usan los valores por
+ * defecto. Durante esa calibración automática los demás hilos que
+ * consultan tuning() esperan a que termine.
+ *
+ * @code
+ * mathlib::TuningParameters params = mathlib::autotune(&std::cerr);
+ * mathlib::save_tuning(mathlib::tuning_file_path(), params);
+ * mathlib::set_tuning(params);
+ * @endcode
+ */
+
+#ifndef TUNING_H
+#define TUNING_H
+
+#include "Gemm.h"
+#include <iosfwd>
+#include <string>
+
+namespace mathlib {
+
+/**
+ * @struct TuningBlocking
+ * @brief Tamaños de bloque de GEMM para un tipo de elemento
+ *
+ * Un valor 0 deja el tamaño calculado a partir de las cachés (véase
+ * gemm_blocking()). Los valores se redondean a múltiplos de la tesela del
+ * micro-kernel activo.
+ */
+struct TuningBlocking {
+    int mc;  ///< Filas de A por bloque
+    int kc;  ///< Profundidad del bloque
+    int nc;  ///< Columnas de B por panel
+
+    TuningBlocking() : mc(0), kc(0), nc(0) {}
+};
+
+/**
+ * @struct TuningParameters
+ * @brief Parámetros de despacho que pueden calibrarse por equipo
+ *
+ * El constructor deja los valores por defecto de la biblioteca.
+ */
+struct TuningParameters {
+    TuningBlocking blocking_f64;       ///< Bloques de GEMM en double
+    TuningBlocking blocking_f32;       ///< Bloques de GEMM en float
+    double small_gemm_volume;          ///< m·n·k por debajo del cual se usa el kernel de referencia
+    double parallel_gemm_volume;       ///< m·n·k por debajo del cual gemm_parallel no reparte
+    int tiles_per_thread;              ///< Teselas de C por hilo al repartir GEMM y GEMV
+    double parallel_gemv_elements;     ///< Elementos de A por debajo de los cuales GEMV no reparte
+    int strassen_crossover;            ///< Valor por defecto de MultiplyOptions::strassen_crossover
+    int threads;                       ///< Hilos del grupo global (0: los del equipo)
+
+    TuningParameters()
+        : small_gemm_volume(32.0 * 32.0 * 32.0),
+          parallel_gemm_volume(128.0 * 128.0 * 128.0),
+          tiles_per_thread(4),
+          parallel_gemv_elements(256.0 * 1024.0),
+          strassen_crossover(STRASSEN_DEFAULT_CROSSOVER),
+          threads(0) {}
+};
+
+/**
+ * @brief Parámetros activos
+ *
+ * La primera llamada carga tuning_file_path() si existe (según
+ * MATHLIB_TUNING); un fichero calibrado con otro nivel SIMD se ignora.
+ * La referencia sigue siendo válida tras un set_tuning() posterior, pero
+ * conserva los valores que había al obtenerla.
+ */
+const TuningParameters& tuning();
+
+/**
+ * @brief Sustituye los parámetros activos
+ *
+ * Los nuevos valores se publican de forma atómica: las operaciones que
+ * empiecen después los usan y las que ya están en curso terminan con los
+ * anteriores. Si params.threads es positivo y distinto del actual, el
+ * grupo global se vuelve a crear con ese tamaño
+ * (ThreadPool::configure_global()); eso destruye el grupo anterior, así
+ * que en ese caso no debe llamarse mientras otros hilos lo estén usando.
+ *
+ * @throws std::invalid_argument Si algún umbral es negativo, los hilos
+ *         son negativos o tiles_per_thread o strassen_crossover son < 1
+ */
+void set_tuning(const TuningParameters& params);
+
+/**
+ * @brief Fichero de calibración de este equipo
+ *
+ * @return MATHLIB_TUNING_FILE si está definida; si no,
+ *         $XDG_CONFIG_HOME/mathlib/tuning-<equipo>.conf o
+ *         $HOME/.config/mathlib/tuning-<equipo>.conf (cadena vacía si no
+ *         hay directorio personal)
+ */
+std::string tuning_file_path();
+
+/**
+ * @brief Lee un fichero de calibración
+ *
+ * Formato: una línea "clave = valor" por parámetro; las líneas vacías y
+ * las que empiezan por '#' se ignoran y las claves que faltan conservan
+ * el valor de params.
+ *
+ * La clave simd (nivel con que se calibró) se lee pero no se comprueba.
+ *
+ * @param params Recibe los valores leídos
+ * @return false si el fichero no existe
+ * @throws std::runtime_error Si una línea o una clave no es válida, un
+ *         valor no es un número finito o el de una clave entera no es un
+ *         entero representable en int
+ */
+bool load_tuning(const std::string& path, TuningParameters& params);
+
+/**
+ * @brief Escribe params en path, creando su directorio si hace falta
+ *
+ * Anota además el nivel SIMD activo, para descartar el fichero si el
+ * programa se ejecuta con otro.
+ *
+ * @throws std::runtime_error Si no se puede escribir el fichero
+ */
+void save_tuning(const std::string& path, const TuningParameters& params);
+
+/**
+ * @struct TuneOptions
+ * @brief Alcance de la calibración
+ */
+struct TuneOptions {
+    int max_size;         ///< Mayor dimensión de las matrices medidas
+    double min_time;      ///< Segundos mínimos medidos por candidato
+    bool tune_threads;    ///< Probar también varios tamaños del grupo global
+
+    TuneOptions() : max_size(512), min_time(0.05), tune_threads(true) {}
+};
+
+/**
+ * @brief Mide configuraciones candidatas y devuelve la más rápida
+ *
+ * Parte de los parámetros activos y ajusta por turnos los bloques de
+ * double y float, el umbral del kernel de referencia, el punto de corte
+ * de Strassen, los hilos y los umbrales del reparto paralelo. Tarda del
+ * orden de segundos. Cada candidato se mide con sus parámetros pasados
+ * de forma explícita y en grupos de hilos propios, sin modificar los
+ * parámetros activos ni el grupo global, así que otros hilos pueden
+ * seguir multiplicando mientras tanto (aunque las medidas lo notarán).
+ *
+ * @param log Si no es nullptr, recibe una línea por medida
+ */
+TuningParameters autotune(std::ostream* log = nullptr, const TuneOptions& options = TuneOptions());
+
+} // namespace mathlib
+
+#endif
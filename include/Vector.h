@@ -0,0 +1,182 @@
+/**
+ * @file Vector.h
+ * @brief Vector denso contiguo y producto matriz-vector (GEMV)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * BasicVector guarda n elementos en un único bloque alineado, reservado
+ * con el asignador activo igual que BasicMatrix. Las operaciones de
+ * nivel 1 (add, scale, axpy, dot) usan los kernels SIMD de Kernels.h y
+ * el producto A · x usa gemv() de Gemm.h, que lee A una sola vez en
+ * lugar de tratar x como una matriz de n x 1.
+ *
+ * @code
+ * mathlib::Vector x(n), y(m);
+ * x.fill(1.0);
+ * Matrix A(m, n);
+ * ...
+ * mathlib::Vector Ax = A.multiply(x, mathlib::PARALLEL);
+ * mathlib::gemv(2.0, A, x, 0.5, y);          // y = 2·A·x + 0.5·y
+ * @endcode
+ */
+
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include <cassert>
+#include <complex>
+#include <cstddef>
+#include "Gemm.h"
+#include "Matrix.h"
+#include "Span.h"
+
+namespace mathlib {
+
+/**
+ * @class BasicVector
+ * @brief Vector denso de n elementos contiguos
+ *
+ * El acceso con operator[] no comprueba límites (solo assert); get() y
+ * set() sí lo hacen. La copia es profunda y el movimiento no reserva.
+ *
+ * @tparam T Tipo de los elementos; instanciada para float, double, int y
+ *         std::complex<double>. Vector es el alias de BasicVector<double>.
+ */
+template <class T>
+class BasicVector {
+public:
+    /// Tipo de los elementos
+    typedef T value_type;
+
+    /**
+     * @brief Vector de n elementos inicializados con ceros
+     *
+     * @throws std::invalid_argument Si n no es positivo
+     */
+    explicit BasicVector(int n);
+
+    /**
+     * @brief Vector de n elementos sin inicializar, para usarlo como destino
+     *
+     * @throws std::invalid_argument Si n no es positivo
+     */
+    BasicVector(int n, typename BasicMatrix<T>::Uninitialized);
+
+    /**
+     * @brief Copia los elementos de un tramo contiguo
+     *
+     * @throws std::invalid_argument Si values está vacío
+     */
+    explicit BasicVector(Span<const T> values);
+
+    /**
+     * @brief Copia la columna c de una matriz
+     *
+     * @throws std::out_of_range Si c no es una columna de m
+     */
+    static BasicVector from_column(const BasicMatrix<T>& m, int c);
+
+    /// Matriz de size() x 1 con los elementos del vector
+    BasicMatrix<T> to_column() const;
+
+    /// Número de elementos
+    int size() const { return storage.num_cols(); }
+
+    T* data() { return storage.data(); }
+    const T* data() const { return storage.data(); }
+
+    /// Elementos como tramo contiguo
+    Span<T> span() { return Span<T>(data(), static_cast<std::size_t>(size())); }
+    Span<const T> span() const { return Span<const T>(data(), static_cast<std::size_t>(size())); }
+
+    /**
+     * @brief Acceso sin comprobación de límites en modo release
+     */
+    T& operator[](int i) {
+        assert(i >= 0 && i < size() && "Vector::operator[] - Índice fuera de rango");
+        return data()[i];
+    }
+    const T& operator[](int i) const {
+        assert(i >= 0 && i < size() && "Vector::operator[] - Índice fuera de rango");
+        return data()[i];
+    }
+
+    /**
+     * @throws std::out_of_range Si i no es un índice del vector
+     */
+    T get(int i) const;
+
+    /**
+     * @throws std::out_of_range Si i no es un índice del vector
+     */
+    void set(int i, T value);
+
+    /// Asigna value a todos los elementos
+    BasicVector& fill(T value);
+
+    /**
+     * @brief Suma elemento a elemento
+     *
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    BasicVector add(const BasicVector& other) const;
+
+    /**
+     * @brief Resta elemento a elemento
+     *
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    BasicVector subtract(const BasicVector& other) const;
+
+    /// Nuevo vector alpha · this
+    BasicVector scale(T alpha) const;
+
+    /**
+     * @brief this += alpha · x sin reservar memoria
+     *
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    BasicVector& axpy(T alpha, const BasicVector& x);
+
+    /**
+     * @brief Producto escalar sum(this[i] · other[i]), sin conjugar
+     *
+     * @throws std::invalid_argument Si los tamaños no coinciden
+     */
+    T dot(const BasicVector& other) const;
+
+    /// Norma euclídea (módulo de cada elemento para complejos)
+    double norm() const;
+
+private:
+    BasicMatrix<T> storage;     ///< Fila única de 1 x n con los elementos
+};
+
+/// Vector de doble precisión
+typedef BasicVector<double> Vector;
+
+/**
+ * @brief Producto matriz-vector fusionado y = alpha · op(A) · x + beta · y
+ *
+ * Con beta == 0 no se lee y (puede estar sin inicializar). Con
+ * PARALLEL se reparten las filas (o columnas con TRANS) de y entre los
+ * hilos si A es lo bastante grande.
+ *
+ * @param trans TRANS calcula con Aᵀ sin copiarla
+ * @throws std::invalid_argument Si los tamaños de x o y no
+ *         corresponden a op(A)
+ */
+template <class T>
+void gemv(T alpha, const BasicMatrix<T>& A, const BasicVector<T>& x, T beta, BasicVector<T>& y,
+          Transpose trans = NO_TRANS, ExecutionPolicy policy = SEQUENTIAL);
+
+// Instancias compiladas en Vector.cpp
+extern template class BasicVector<float>;
+extern template class BasicVector<double>;
+extern template class BasicVector<int>;
+extern template class BasicVector<std::complex<double> >;
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,339 @@
+/**
+ * @file Distributed.cpp
+ * @brief Implementación de la malla de procesos y del producto SUMMA
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los índices locales siguen la distribución cíclica por bloques de
+ * ScaLAPACK: un proceso en la posición p de P guarda los bloques p, p + P,
+ * p + 2P, ... de cada dimensión, uno tras otro.
+ *
+ * En multiply() hay dos juegos de buffers de panel. Mientras se calcula
+ * con uno, las difusiones del panel siguiente llenan el otro; entre
+ * franjas de filas del producto local se llama a MPI_Testall para que la
+ * biblioteca MPI avance esas difusiones aunque no tenga hilo de progreso
+ * propio.
+ */
+
+#include "Distributed.h"
+#include "Matrix.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace mathlib {
+
+namespace {
+
+/// Filas de C que se calculan entre dos comprobaciones de las difusiones
+const int SUMMA_STRIP_ROWS = 256;
+
+template <class T>
+struct MpiType;
+
+template <>
+struct MpiType<float> {
+    static MPI_Datatype get() { return MPI_FLOAT; }
+};
+
+template <>
+struct MpiType<double> {
+    static MPI_Datatype get() { return MPI_DOUBLE; }
+};
+
+void check(int code, const char* where) {
+    if (code != MPI_SUCCESS) {
+        char text[MPI_MAX_ERROR_STRING];
+        int length = 0;
+        MPI_Error_string(code, text, &length);
+        throw std::runtime_error(std::string(where) + " - " + std::string(text, static_cast<std::size_t>(length)));
+    }
+}
+
+/// Elementos de una dimensión de n con bloques de b que guarda el proceso p de P
+int localExtent(int n, int b, int p, int P) {
+    const int blocks = n / b;
+    int count = (blocks / P) * b;
+    const int extra = blocks % P;
+    if (p < extra) {
+        count += b;
+    } else if (p == extra) {
+        count += n % b;
+    }
+    return count;
+}
+
+/// Índice global del índice local l del proceso p de P con bloques de b
+int globalIndex(int l, int b, int p, int P) {
+    return (l / b) * P * b + p * b + l % b;
+}
+
+int checkedCount(std::size_t count, const char* where) {
+    if (count > static_cast<std::size_t>(INT_MAX)) {
+        throw std::invalid_argument(std::string(where) + " - Demasiados elementos por proceso para MPI");
+    }
+    return static_cast<int>(count);
+}
+
+/**
+ * @brief Comprueba en root una condición y la comunica a todos
+ *
+ * Así todos los procesos lanzan la misma excepción en lugar de quedarse
+ * esperando en una operación colectiva que root no va a hacer.
+ */
+void agree(bool ok, int root, MPI_Comm comm, const char* message) {
+    int flag = ok ? 1 : 0;
+    check(MPI_Bcast(&flag, 1, MPI_INT, root, comm), message);
+    if (!flag) {
+        throw std::invalid_argument(message);
+    }
+}
+
+template <class T>
+void localGemm(int m, int n, int k, const T* a, int lda, const T* b, int ldb, T* c, int ldc,
+               ExecutionPolicy policy) {
+    if (policy == PARALLEL) {
+        gemm_parallel(m, n, k, a, lda, b, ldb, c, ldc, ThreadPool::global());
+    } else {
+        gemm(m, n, k, a, lda, b, ldb, c, ldc);
+    }
+}
+
+} // namespace
+
+ProcessGrid::ProcessGrid(MPI_Comm comm, int rows, int cols) {
+    check(MPI_Comm_dup(comm, &all), "ProcessGrid::ProcessGrid");
+    int size = 0;
+    MPI_Comm_size(all, &size);
+    MPI_Comm_rank(all, &myRank);
+    if (rows == 0 && cols == 0) {
+        rows = static_cast<int>(std::sqrt(static_cast<double>(size)));
+        while (rows > 1 && size % rows != 0) {
+            --rows;
+        }
+        rows = std::max(rows, 1);
+        cols = size / rows;
+    }
+    if (rows <= 0 || cols <= 0 || rows * cols != size) {
+        MPI_Comm_free(&all);
+        throw std::invalid_argument("ProcessGrid::ProcessGrid - La malla debe tener tantas posiciones como procesos");
+    }
+    gridRows = rows;
+    gridCols = cols;
+    myRow = myRank / cols;
+    myCol = myRank % cols;
+    check(MPI_Comm_split(all, myRow, myCol, &rowComm), "ProcessGrid::ProcessGrid");
+    check(MPI_Comm_split(all, myCol, myRow, &colComm), "ProcessGrid::ProcessGrid");
+}
+
+ProcessGrid::~ProcessGrid() {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized) {
+        MPI_Comm_free(&rowComm);
+        MPI_Comm_free(&colComm);
+        MPI_Comm_free(&all);
+    }
+}
+
+template <class T>
+DistributedMatrix<T>::DistributedMatrix(const ProcessGrid& grid, int r, int c, int block_rows, int block_cols)
+    : procs(&grid), rows(r), cols(c), mb(block_rows), nb(block_cols) {
+    if (r <= 0 || c <= 0) {
+        throw std::invalid_argument("DistributedMatrix::DistributedMatrix - Las dimensiones deben ser positivas");
+    }
+    if (block_rows <= 0 || block_cols <= 0) {
+        throw std::invalid_argument("DistributedMatrix::DistributedMatrix - Los bloques deben ser positivos");
+    }
+    localRows = localExtent(rows, mb, grid.row(), grid.rows());
+    localCols = localExtent(cols, nb, grid.col(), grid.cols());
+    local.assign(static_cast<std::size_t>(localRows) * localCols, T(0));
+}
+
+template <class T>
+int DistributedMatrix<T>::global_row(int r) const {
+    return globalIndex(r, mb, procs->row(), procs->rows());
+}
+
+template <class T>
+int DistributedMatrix<T>::global_col(int c) const {
+    return globalIndex(c, nb, procs->col(), procs->cols());
+}
+
+template <class T>
+DistributedMatrix<T>& DistributedMatrix<T>::generate(const std::function<T(int, int)>& f) {
+    for (int r = 0; r < localRows; ++r) {
+        const int i = global_row(r);
+        T* row = &local[static_cast<std::size_t>(r) * localCols];
+        for (int c = 0; c < localCols; ++c) {
+            row[c] = f(i, global_col(c));
+        }
+    }
+    return *this;
+}
+
+template <class T>
+DistributedMatrix<T> DistributedMatrix<T>::scatter(const ProcessGrid& grid, const BasicMatrix<T>* global,
+                                                   int rows, int cols, int block_rows, int block_cols, int root) {
+    DistributedMatrix result(grid, rows, cols, block_rows, block_cols);
+    const bool isRoot = grid.rank() == root;
+    agree(!isRoot || (global != NULL && global->num_rows() == rows && global->num_cols() == cols), root,
+          grid.comm(), "DistributedMatrix::scatter - La matriz de origen debe medir rows x cols");
+
+    std::vector<T> packed;
+    std::vector<int> counts, offsets;
+    if (isRoot) {
+        const int procsCount = grid.rows() * grid.cols();
+        packed.reserve(static_cast<std::size_t>(rows) * cols);
+        for (int q = 0; q < procsCount; ++q) {
+            const int qr = q / grid.cols();
+            const int qc = q % grid.cols();
+            const int lr = localExtent(rows, block_rows, qr, grid.rows());
+            const int lc = localExtent(cols, block_cols, qc, grid.cols());
+            offsets.push_back(checkedCount(packed.size(), "DistributedMatrix::scatter"));
+            counts.push_back(checkedCount(static_cast<std::size_t>(lr) * lc, "DistributedMatrix::scatter"));
+            for (int r = 0; r < lr; ++r) {
+                const int i = globalIndex(r, block_rows, qr, grid.rows());
+                for (int c = 0; c < lc; ++c) {
+                    packed.push_back((*global)(i, globalIndex(c, block_cols, qc, grid.cols())));
+                }
+            }
+        }
+    }
+    check(MPI_Scatterv(isRoot ? packed.data() : NULL, isRoot ? counts.data() : NULL,
+                       isRoot ? offsets.data() : NULL, MpiType<T>::get(), result.local_data(),
+                       checkedCount(result.local.size(), "DistributedMatrix::scatter"), MpiType<T>::get(),
+                       root, grid.comm()),
+          "DistributedMatrix::scatter");
+    return result;
+}
+
+template <class T>
+void DistributedMatrix<T>::gather(BasicMatrix<T>* global, int root) const {
+    const bool isRoot = procs->rank() == root;
+    agree(!isRoot || (global != NULL && global->num_rows() == rows && global->num_cols() == cols), root,
+          procs->comm(), "DistributedMatrix::gather - La matriz de destino debe medir num_rows() x num_cols()");
+
+    std::vector<T> packed;
+    std::vector<int> counts, offsets;
+    const int procsCount = procs->rows() * procs->cols();
+    if (isRoot) {
+        int offset = 0;
+        for (int q = 0; q < procsCount; ++q) {
+            const int lr = localExtent(rows, mb, q / procs->cols(), procs->rows());
+            const int lc = localExtent(cols, nb, q % procs->cols(), procs->cols());
+            offsets.push_back(offset);
+            counts.push_back(checkedCount(static_cast<std::size_t>(lr) * lc, "DistributedMatrix::gather"));
+            offset = checkedCount(static_cast<std::size_t>(offset) + counts.back(), "DistributedMatrix::gather");
+        }
+        packed.resize(static_cast<std::size_t>(offset));
+    }
+    check(MPI_Gatherv(const_cast<T*>(local_data()), checkedCount(local.size(), "DistributedMatrix::gather"),
+                      MpiType<T>::get(), isRoot ? packed.data() : NULL, isRoot ? counts.data() : NULL,
+                      isRoot ? offsets.data() : NULL, MpiType<T>::get(), root, procs->comm()),
+          "DistributedMatrix::gather");
+    if (!isRoot) {
+        return;
+    }
+    for (int q = 0; q < procsCount; ++q) {
+        const int qr = q / procs->cols();
+        const int qc = q % procs->cols();
+        const int lr = localExtent(rows, mb, qr, procs->rows());
+        const int lc = localExtent(cols, nb, qc, procs->cols());
+        const T* src = packed.data() + offsets[q];
+        for (int r = 0; r < lr; ++r) {
+            const int i = globalIndex(r, mb, qr, procs->rows());
+            for (int c = 0; c < lc; ++c) {
+                (*global)(i, globalIndex(c, nb, qc, procs->cols())) = *src++;
+            }
+        }
+    }
+}
+
+template <class T>
+DistributedMatrix<T> DistributedMatrix<T>::multiply(const DistributedMatrix& other, ExecutionPolicy policy) const {
+    if (procs != other.procs) {
+        throw std::invalid_argument("DistributedMatrix::multiply - Las matrices deben usar la misma malla");
+    }
+    if (cols != other.rows) {
+        throw std::invalid_argument("DistributedMatrix::multiply - Dimensiones incompatibles para multiplicación");
+    }
+    if (nb != other.mb) {
+        throw std::invalid_argument(
+            "DistributedMatrix::multiply - block_cols() de A debe coincidir con block_rows() de B");
+    }
+    DistributedMatrix result(*procs, rows, other.cols, mb, other.nb);
+    const ProcessGrid& g = *procs;
+    const int m = localRows;            // filas locales de A y de C
+    const int n = other.localCols;      // columnas locales de B y de C
+    const int kb = nb;
+    const int panels = (cols + kb - 1) / kb;
+    const MPI_Datatype type = MpiType<T>::get();
+
+    std::vector<T> panelA[2], panelB[2];
+    for (int s = 0; s < 2; ++s) {
+        panelA[s].resize(std::max<std::size_t>(1, static_cast<std::size_t>(m) * kb));
+        panelB[s].resize(std::max<std::size_t>(1, static_cast<std::size_t>(kb) * n));
+    }
+    std::vector<T> scratch(std::max<std::size_t>(1, static_cast<std::size_t>(std::min(m, SUMMA_STRIP_ROWS)) * n));
+    MPI_Request requests[2][2];
+
+    // Empaqueta (en los dueños) y difunde sin bloqueo el panel p en el juego slot
+    auto post = [&](int p, int slot) {
+        const int width = std::min(kb, cols - p * kb);
+        if (g.col() == p % g.cols()) {
+            const T* src = local_data() + (p / g.cols()) * kb;
+            for (int r = 0; r < m; ++r) {
+                std::memcpy(&panelA[slot][static_cast<std::size_t>(r) * width],
+                            src + static_cast<std::size_t>(r) * localCols, width * sizeof(T));
+            }
+        }
+        if (g.row() == p % g.rows() && n > 0) {
+            std::memcpy(&panelB[slot][0], other.local_data() + static_cast<std::size_t>(p / g.rows()) * kb * n,
+                        static_cast<std::size_t>(width) * n * sizeof(T));
+        }
+        check(MPI_Ibcast(&panelA[slot][0], m * width, type, p % g.cols(), g.row_comm(), &requests[slot][0]),
+              "DistributedMatrix::multiply");
+        check(MPI_Ibcast(&panelB[slot][0], width * n, type, p % g.rows(), g.col_comm(), &requests[slot][1]),
+              "DistributedMatrix::multiply");
+    };
+
+    post(0, 0);
+    for (int p = 0; p < panels; ++p) {
+        const int slot = p & 1;
+        const bool more = p + 1 < panels;
+        if (more) {
+            post(p + 1, slot ^ 1);
+        }
+        check(MPI_Waitall(2, requests[slot], MPI_STATUSES_IGNORE), "DistributedMatrix::multiply");
+
+        const int width = std::min(kb, cols - p * kb);
+        for (int r0 = 0; r0 < m && n > 0; r0 += SUMMA_STRIP_ROWS) {
+            const int h = std::min(SUMMA_STRIP_ROWS, m - r0);
+            T* c = result.local_data() + static_cast<std::size_t>(r0) * n;
+            const T* a = &panelA[slot][static_cast<std::size_t>(r0) * width];
+            if (p == 0) {
+                localGemm(h, n, width, a, width, &panelB[slot][0], n, c, n, policy);
+            } else {
+                localGemm(h, n, width, a, width, &panelB[slot][0], n, &scratch[0], n, policy);
+                vec_add(static_cast<std::size_t>(h) * n, c, &scratch[0], c);
+            }
+            if (more) {
+                int done = 0;
+                MPI_Testall(2, requests[slot ^ 1], &done, MPI_STATUSES_IGNORE);
+            }
+        }
+    }
+    return result;
+}
+
+template class DistributedMatrix<float>;
+template class DistributedMatrix<double>;
+
+} // namespace mathlib
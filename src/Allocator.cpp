@@ -0,0 +1,225 @@
+/**
+ * @file Allocator.cpp
+ * @brief Implementación de los asignadores de datos de matrices
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ */
+
+#include "Allocator.h"
+#include <cstdlib>
+#include <new>
+
+namespace mathlib {
+
+namespace {
+
+/**
+ * @brief Redondea bytes al siguiente múltiplo de MATRIX_ALIGNMENT
+ */
+std::size_t alignUp(std::size_t bytes) {
+    return (bytes + MATRIX_ALIGNMENT - 1) / MATRIX_ALIGNMENT * MATRIX_ALIGNMENT;
+}
+
+/**
+ * @brief Asignador de montículo global
+ */
+class HeapAllocator : public MatrixAllocator {
+public:
+    void* allocate(std::size_t bytes) {
+        return aligned_allocate(bytes);
+    }
+
+    void deallocate(void* ptr, std::size_t) {
+        aligned_free(ptr);
+    }
+};
+
+/**
+ * @brief Clase de tamaño de un bloque: índice de la potencia de dos
+ *        (en bytes) que lo contiene, partiendo de MATRIX_ALIGNMENT
+ */
+int sizeClass(std::size_t bytes) {
+    int cls = 0;
+    std::size_t capacity = MATRIX_ALIGNMENT;
+    while (capacity < bytes) {
+        capacity <<= 1;
+        ++cls;
+    }
+    return cls;
+}
+
+/// Asignador activo en este hilo (NULL equivale al montículo)
+thread_local MatrixAllocator* currentAllocator = NULL;
+
+} // namespace
+
+void* aligned_allocate(std::size_t bytes) {
+    if (bytes == 0) {
+        return NULL;
+    }
+    void* ptr = NULL;
+#if defined(_WIN32)
+    ptr = _aligned_malloc(bytes, MATRIX_ALIGNMENT);
+#else
+    if (posix_memalign(&ptr, MATRIX_ALIGNMENT, bytes) != 0) {
+        ptr = NULL;
+    }
+#endif
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void aligned_free(void* ptr) {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+MatrixAllocator& heap_allocator() {
+    static HeapAllocator heap;
+    return heap;
+}
+
+// ---------------------------------------------------------------------------
+// ArenaAllocator
+// ---------------------------------------------------------------------------
+
+ArenaAllocator::ArenaAllocator(std::size_t chunk_bytes)
+    : current(0), offset(0), chunkBytes(alignUp(chunk_bytes)), used(0), reserved(0) {}
+
+ArenaAllocator::~ArenaAllocator() {
+    release();
+}
+
+void* ArenaAllocator::allocate(std::size_t size) {
+    std::size_t bytes = alignUp(size);
+
+    // Buscar, a partir del trozo actual, uno con espacio suficiente
+    while (current < chunks.size() && offset + bytes > chunks[current].size) {
+        ++current;
+        offset = 0;
+    }
+    if (current == chunks.size()) {
+        Chunk chunk;
+        chunk.size = bytes > chunkBytes ? bytes : chunkBytes;
+        chunk.base = static_cast<char*>(aligned_allocate(chunk.size));
+        chunks.push_back(chunk);
+        reserved += chunk.size;
+        offset = 0;
+    }
+
+    char* ptr = chunks[current].base + offset;
+    offset += bytes;
+    used += bytes;
+    return ptr;
+}
+
+void ArenaAllocator::deallocate(void*, std::size_t) {
+    // El espacio se recupera en bloque con reset()
+}
+
+void ArenaAllocator::reset() {
+    current = 0;
+    offset = 0;
+    used = 0;
+}
+
+void ArenaAllocator::release() {
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        aligned_free(chunks[i].base);
+    }
+    chunks.clear();
+    reserved = 0;
+    reset();
+}
+
+// ---------------------------------------------------------------------------
+// PoolAllocator
+// ---------------------------------------------------------------------------
+
+PoolAllocator::PoolAllocator(std::size_t max_cached_bytes)
+    : cached(0), maxCached(max_cached_bytes) {}
+
+PoolAllocator::~PoolAllocator() {
+    trim();
+}
+
+void* PoolAllocator::allocate(std::size_t bytes) {
+    int cls = sizeClass(bytes);
+    if (cls >= CLASS_COUNT) {
+        throw std::bad_alloc();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<void*>& list = freeLists[cls];
+        if (!list.empty()) {
+            void* ptr = list.back();
+            list.pop_back();
+            cached -= MATRIX_ALIGNMENT << cls;
+            return ptr;
+        }
+    }
+    return aligned_allocate(MATRIX_ALIGNMENT << cls);
+}
+
+void PoolAllocator::deallocate(void* ptr, std::size_t bytes) {
+    if (ptr == NULL) {
+        return;
+    }
+    int cls = sizeClass(bytes);
+    std::size_t capacity = MATRIX_ALIGNMENT << cls;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cached + capacity <= maxCached) {
+            freeLists[cls].push_back(ptr);
+            cached += capacity;
+            return;
+        }
+    }
+    aligned_free(ptr);
+}
+
+void PoolAllocator::trim() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int cls = 0; cls < CLASS_COUNT; ++cls) {
+        for (std::size_t i = 0; i < freeLists[cls].size(); ++i) {
+            aligned_free(freeLists[cls][i]);
+        }
+        freeLists[cls].clear();
+    }
+    cached = 0;
+}
+
+std::size_t PoolAllocator::bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cached;
+}
+
+// ---------------------------------------------------------------------------
+// Contexto por hilo
+// ---------------------------------------------------------------------------
+
+ArenaAllocator& thread_arena() {
+    static thread_local ArenaAllocator arena;
+    return arena;
+}
+
+MatrixAllocator& current_allocator() {
+    return currentAllocator != NULL ? *currentAllocator : heap_allocator();
+}
+
+AllocationScope::AllocationScope(MatrixAllocator& allocator)
+    : previous(currentAllocator) {
+    currentAllocator = &allocator;
+}
+
+AllocationScope::~AllocationScope() {
+    currentAllocator = previous;
+}
+
+} // namespace mathlib
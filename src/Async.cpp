@@ -0,0 +1,247 @@
+/**
+ * @file Async.cpp
+ * @brief Implementación de las operaciones asíncronas encadenables
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada futuro guarda su resultado y la lista de funciones que esperan por
+ * él. after() cuenta las entradas pendientes más una reserva propia: cada
+ * entrada descuenta una al completarse y la última en llegar encola el
+ * trabajo, así que el trabajo se encola exactamente una vez aunque las
+ * entradas terminen a la vez en hilos distintos.
+ */
+
+#include "Async.h"
+#include "Matrix.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+namespace mathlib {
+
+/**
+ * @brief Estado compartido por las copias de un MatrixFuture
+ */
+template <class T>
+struct MatrixFuture<T>::State {
+    std::mutex mutex;
+    std::condition_variable done;
+    bool ready;
+    std::shared_ptr<const BasicMatrix<T> > value;
+    std::exception_ptr error;
+    std::vector<std::function<void()> > callbacks;   ///< Pendientes hasta que ready
+
+    State() : ready(false) {}
+
+    /**
+     * @brief Publica el resultado (o la excepción) y avisa a quien espera
+     */
+    void complete(const std::shared_ptr<const BasicMatrix<T> >& result, std::exception_ptr failure) {
+        std::vector<std::function<void()> > waiting;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            value = result;
+            error = failure;
+            ready = true;
+            waiting.swap(callbacks);
+        }
+        done.notify_all();
+        for (std::size_t i = 0; i < waiting.size(); ++i) {
+            waiting[i]();
+        }
+    }
+};
+
+template <class T>
+MatrixFuture<T>::MatrixFuture(const BasicMatrix<T>& value) : state(std::make_shared<State>()) {
+    state->value = std::make_shared<const BasicMatrix<T> >(value);
+    state->ready = true;
+}
+
+template <class T>
+MatrixFuture<T>::MatrixFuture(BasicMatrix<T>&& value) : state(std::make_shared<State>()) {
+    state->value = std::make_shared<const BasicMatrix<T> >(std::move(value));
+    state->ready = true;
+}
+
+template <class T>
+MatrixFuture<T>::MatrixFuture(const std::shared_ptr<const BasicMatrix<T> >& value) {
+    if (!value) {
+        throw std::invalid_argument("MatrixFuture::MatrixFuture - Matriz nula");
+    }
+    state = std::make_shared<State>();
+    state->value = value;
+    state->ready = true;
+}
+
+template <class T>
+MatrixFuture<T> MatrixFuture<T>::after(const std::vector<MatrixFuture>& inputs, const Work& work) {
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        if (!inputs[i].valid()) {
+            throw std::invalid_argument("MatrixFuture::after - Entrada sin estado");
+        }
+    }
+    std::shared_ptr<State> s = std::make_shared<State>();
+    std::shared_ptr<std::atomic<int> > remaining =
+        std::make_shared<std::atomic<int> >(static_cast<int>(inputs.size()) + 1);
+
+    // Las copias de las entradas las mantienen vivas hasta que work termina
+    std::function<void()> run = [s, inputs, work]() {
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if (inputs[i].state->error) {
+                s->complete(std::shared_ptr<const BasicMatrix<T> >(), inputs[i].state->error);
+                return;
+            }
+        }
+        std::shared_ptr<const BasicMatrix<T> > result;
+        std::exception_ptr failure;
+        try {
+            result = std::make_shared<const BasicMatrix<T> >(work());
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        s->complete(result, failure);
+    };
+    std::function<void()> arrive = [remaining, run]() {
+        if (remaining->fetch_sub(1) == 1) {
+            ThreadPool::global().submit(run);
+        }
+    };
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i].on_ready(arrive);
+    }
+    arrive();
+    return MatrixFuture(s);
+}
+
+template <class T>
+bool MatrixFuture<T>::ready() const {
+    if (!state) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->ready;
+}
+
+template <class T>
+void MatrixFuture<T>::wait() const {
+    if (!state) {
+        throw std::runtime_error("MatrixFuture::wait - Futuro sin estado");
+    }
+    ThreadPool& pool = ThreadPool::global();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->ready) {
+        lock.unlock();
+        const bool ran = pool.run_pending_task();
+        lock.lock();
+        if (!ran) {
+            state->done.wait_for(lock, std::chrono::microseconds(200));
+        }
+    }
+}
+
+template <class T>
+const BasicMatrix<T>& MatrixFuture<T>::get() const {
+    if (!state) {
+        throw std::runtime_error("MatrixFuture::get - Futuro sin estado");
+    }
+    wait();
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+    return *state->value;
+}
+
+template <class T>
+MatrixFuture<T> MatrixFuture<T>::then(const std::function<BasicMatrix<T>(const BasicMatrix<T>&)>& fn) const {
+    const MatrixFuture self = *this;
+    return after(std::vector<MatrixFuture>(1, self), [self, fn]() { return fn(self.get()); });
+}
+
+template <class T>
+void MatrixFuture<T>::on_ready(const std::function<void()>& callback) const {
+    if (!state) {
+        throw std::runtime_error("MatrixFuture::on_ready - Futuro sin estado");
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->ready) {
+            state->callbacks.push_back(callback);
+            return;
+        }
+    }
+    callback();
+}
+
+namespace {
+
+template <class T>
+std::vector<MatrixFuture<T> > inputsOf(const MatrixFuture<T>& a, const MatrixFuture<T>& b) {
+    std::vector<MatrixFuture<T> > inputs;
+    inputs.push_back(a);
+    inputs.push_back(b);
+    return inputs;
+}
+
+} // namespace
+
+template <class T>
+MatrixFuture<T> async_run(const std::function<BasicMatrix<T>()>& work) {
+    return MatrixFuture<T>::after(std::vector<MatrixFuture<T> >(), work);
+}
+
+template <class T>
+MatrixFuture<T> async_add(const MatrixFuture<T>& a, const MatrixFuture<T>& b) {
+    return MatrixFuture<T>::after(inputsOf(a, b), [a, b]() { return a.get().add(b.get()); });
+}
+
+template <class T>
+MatrixFuture<T> async_subtract(const MatrixFuture<T>& a, const MatrixFuture<T>& b) {
+    return MatrixFuture<T>::after(inputsOf(a, b), [a, b]() { return a.get().subtract(b.get()); });
+}
+
+template <class T>
+MatrixFuture<T> async_hadamard(const MatrixFuture<T>& a, const MatrixFuture<T>& b) {
+    return MatrixFuture<T>::after(inputsOf(a, b), [a, b]() { return a.get().hadamard(b.get()); });
+}
+
+template <class T>
+MatrixFuture<T> async_scale(const MatrixFuture<T>& a, T alpha) {
+    return MatrixFuture<T>::after(std::vector<MatrixFuture<T> >(1, a), [a, alpha]() { return a.get().scale(alpha); });
+}
+
+template <class T>
+MatrixFuture<T> async_transpose(const MatrixFuture<T>& a) {
+    return MatrixFuture<T>::after(std::vector<MatrixFuture<T> >(1, a), [a]() { return a.get().transpose(); });
+}
+
+template <class T>
+MatrixFuture<T> async_multiply(const MatrixFuture<T>& a, const MatrixFuture<T>& b, const MultiplyOptions& options) {
+    return MatrixFuture<T>::after(inputsOf(a, b), [a, b, options]() { return a.get().multiply(b.get(), options); });
+}
+
+#define MATHLIB_INSTANTIATE_ASYNC(T)                                                                     \
+    template class MatrixFuture<T>;                                                                      \
+    template MatrixFuture<T> async_run<T>(const std::function<BasicMatrix<T>()>&);                       \
+    template MatrixFuture<T> async_add<T>(const MatrixFuture<T>&, const MatrixFuture<T>&);               \
+    template MatrixFuture<T> async_subtract<T>(const MatrixFuture<T>&, const MatrixFuture<T>&);          \
+    template MatrixFuture<T> async_hadamard<T>(const MatrixFuture<T>&, const MatrixFuture<T>&);          \
+    template MatrixFuture<T> async_scale<T>(const MatrixFuture<T>&, T);                                  \
+    template MatrixFuture<T> async_transpose<T>(const MatrixFuture<T>&);                                 \
+    template MatrixFuture<T> async_multiply<T>(const MatrixFuture<T>&, const MatrixFuture<T>&,           \
+                                               const MultiplyOptions&);
+
+MATHLIB_INSTANTIATE_ASYNC(float)
+MATHLIB_INSTANTIATE_ASYNC(double)
+MATHLIB_INSTANTIATE_ASYNC(int)
+MATHLIB_INSTANTIATE_ASYNC(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_ASYNC
+
+} // namespace mathlib
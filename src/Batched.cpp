@@ -0,0 +1,274 @@
+/**
+ * @file Batched.cpp
+ * @brief Implementación de la multiplicación por lotes
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * El lote se recorre en grupos de `lanes` productos (el número de
+ * carriles del kernel por lotes activo). Para matrices pequeñas cada
+ * grupo se entrelaza en un buffer de trabajo, se multiplica con una
+ * sola llamada al kernel por lotes y se desentrelaza en los destinos;
+ * para matrices mayores (batch_interleaved()) cada producto va
+ * directamente a gemm(). Con PARALLEL los grupos se reparten en trozos
+ * contiguos entre los hilos.
+ */
+
+#include "Batched.h"
+#include "Matrix.h"
+#include "KernelsInternal.h"
+#include "Profiling.h"
+#include "ThreadPool.h"
+#include "Tuning.h"
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+namespace mathlib {
+
+namespace {
+
+/// Trozos por hilo al repartir el lote, para equilibrar la carga
+const int BATCH_CHUNKS_PER_THREAD = 4;
+
+/**
+ * @brief Acceso uniforme a la matriz i de un lote dado por punteros o con separación
+ */
+template <class P>
+struct BatchOperand {
+    const P* pointers;     ///< Arreglo de punteros, o nullptr si el lote tiene separación fija
+    P base;                ///< Primera matriz del lote con separación fija
+    std::ptrdiff_t stride; ///< Elementos entre matrices consecutivas
+
+    P operator[](int i) const {
+        return pointers ? pointers[i] : base + static_cast<std::ptrdiff_t>(i) * stride;
+    }
+};
+
+template <class P>
+BatchOperand<P> fromPointers(const P* pointers) {
+    BatchOperand<P> op = {pointers, P(), 0};
+    return op;
+}
+
+template <class P>
+BatchOperand<P> fromStrided(P base, std::ptrdiff_t stride) {
+    BatchOperand<P> op = {nullptr, base, stride};
+    return op;
+}
+
+/**
+ * @brief Multiplica los productos [first, last) del lote
+ *
+ * work debe tener capacidad para un grupo entrelazado cuando interleave
+ * es true: lanes · (m·k + k·n + m·n) elementos.
+ */
+template <class T>
+void multiplyRange(const KernelTableT<T>& kernels, bool interleave,
+                   int m, int n, int k,
+                   const BatchOperand<const T*>& A, int lda,
+                   const BatchOperand<const T*>& B, int ldb,
+                   const BatchOperand<T*>& C, int ldc,
+                   int first, int last, T* work) {
+    if (!interleave) {
+        for (int b = first; b < last; ++b) {
+            gemm(m, n, k, A[b], lda, B[b], ldb, C[b], ldc);
+        }
+        return;
+    }
+
+    const int L = kernels.lanes;
+    T* pa = work;
+    T* pb = pa + static_cast<std::size_t>(L) * m * k;
+    T* pc = pb + static_cast<std::size_t>(L) * k * n;
+
+    for (int g = first; g < last; g += L) {
+        const int count = std::min(L, last - g);
+        if (count < L) {
+            // Grupo incompleto: los carriles sobrantes multiplican ceros
+            std::fill(pa, pc, T());
+        }
+        for (int l = 0; l < count; ++l) {
+            const T* a = A[g + l];
+            const T* b = B[g + l];
+            for (int i = 0; i < m; ++i) {
+                for (int p = 0; p < k; ++p) {
+                    pa[(static_cast<std::size_t>(i) * k + p) * L + l] = a[static_cast<std::size_t>(i) * lda + p];
+                }
+            }
+            for (int p = 0; p < k; ++p) {
+                for (int j = 0; j < n; ++j) {
+                    pb[(static_cast<std::size_t>(p) * n + j) * L + l] = b[static_cast<std::size_t>(p) * ldb + j];
+                }
+            }
+        }
+
+        kernels.batch(m, n, k, pa, pb, pc);
+
+        for (int l = 0; l < count; ++l) {
+            T* c = C[g + l];
+            for (int i = 0; i < m; ++i) {
+                for (int j = 0; j < n; ++j) {
+                    c[static_cast<std::size_t>(i) * ldc + j] = pc[(static_cast<std::size_t>(i) * n + j) * L + l];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Validación común y reparto del lote
+ */
+template <class T>
+void runBatch(int m, int n, int k,
+              const BatchOperand<const T*>& A, int lda,
+              const BatchOperand<const T*>& B, int ldb,
+              const BatchOperand<T*>& C, int ldc,
+              int batch_count, ExecutionPolicy policy) {
+    if (m < 0 || n < 0 || k < 0 || batch_count < 0) {
+        throw std::invalid_argument("mathlib::multiply_batched - Dimensiones negativas");
+    }
+    if (lda < std::max(1, k) || ldb < std::max(1, n) || ldc < std::max(1, n)) {
+        throw std::invalid_argument("mathlib::multiply_batched - Separación entre filas no válida");
+    }
+    MATHLIB_PROFILE_SCOPE(PROFILE_BATCHED, m, n, k, 2.0 * m * n * k * batch_count);
+    if (batch_count == 0 || m == 0 || n == 0) {
+        return;
+    }
+    if (k == 0) {
+        for (int b = 0; b < batch_count; ++b) {
+            for (int i = 0; i < m; ++i) {
+                T* row = C[b] + static_cast<std::size_t>(i) * ldc;
+                std::fill(row, row + n, T());
+            }
+        }
+        return;
+    }
+
+    const KernelTableT<T>& kernels = active_kernels<T>();
+    const int L = kernels.lanes;
+    const bool interleave = L > 1 && batch_count > 1 && batch_interleaved(m, n, k);
+    const std::size_t workElems = interleave
+        ? static_cast<std::size_t>(L) * (static_cast<std::size_t>(m) * k +
+                                         static_cast<std::size_t>(k) * n +
+                                         static_cast<std::size_t>(m) * n)
+        : 0;
+
+    ThreadPool* pool = policy == PARALLEL ? &ThreadPool::global() : nullptr;
+    const int groups = interleave ? (batch_count + L - 1) / L : batch_count;
+    const int chunks = pool ? std::min(groups, pool->size() * BATCH_CHUNKS_PER_THREAD) : 1;
+
+    if (chunks <= 1) {
+        std::vector<T> work(workElems);
+        multiplyRange(kernels, interleave, m, n, k, A, lda, B, ldb, C, ldc,
+                      0, batch_count, work.empty() ? nullptr : &work[0]);
+        return;
+    }
+
+    // Trozos de grupos completos, para que solo el último quede incompleto
+    const int groupSize = interleave ? L : 1;
+    pool->parallel_for(chunks, [&](int t) {
+        int g0 = static_cast<int>(static_cast<long long>(groups) * t / chunks);
+        int g1 = static_cast<int>(static_cast<long long>(groups) * (t + 1) / chunks);
+        int first = g0 * groupSize;
+        int last = std::min(batch_count, g1 * groupSize);
+        std::vector<T> work(workElems);
+        multiplyRange(kernels, interleave, m, n, k, A, lda, B, ldb, C, ldc,
+                      first, last, work.empty() ? nullptr : &work[0]);
+    });
+}
+
+} // namespace
+
+bool batch_interleaved(int m, int n, int k) {
+    return static_cast<double>(m) * n * k < tuning().small_gemm_volume;
+}
+
+template <class T>
+void multiply_batched(int m, int n, int k,
+                      const T* const* A, int lda,
+                      const T* const* B, int ldb,
+                      T* const* C, int ldc,
+                      int batch_count, ExecutionPolicy policy) {
+    if (batch_count > 0 && (!A || !B || !C)) {
+        throw std::invalid_argument("mathlib::multiply_batched - Arreglo de punteros nulo");
+    }
+    runBatch<T>(m, n, k, fromPointers(A), lda, fromPointers(B), ldb, fromPointers(C), ldc,
+                batch_count, policy);
+}
+
+template <class T>
+void multiply_batched_strided(int m, int n, int k,
+                              const T* A, int lda, std::ptrdiff_t stride_a,
+                              const T* B, int ldb, std::ptrdiff_t stride_b,
+                              T* C, int ldc, std::ptrdiff_t stride_c,
+                              int batch_count, ExecutionPolicy policy) {
+    // Las C deben ser disjuntas entre sí; A y B pueden repetirse (separación 0)
+    if (batch_count > 1 && stride_c < static_cast<std::ptrdiff_t>(m > 0 ? (m - 1) * ldc + n : 0)) {
+        throw std::invalid_argument("mathlib::multiply_batched_strided - Los resultados del lote se solapan");
+    }
+    runBatch<T>(m, n, k, fromStrided(A, stride_a), lda, fromStrided(B, stride_b), ldb,
+                fromStrided(C, stride_c), ldc, batch_count, policy);
+}
+
+template <class T>
+void multiply_batched(const std::vector<BasicMatrix<T> >& A,
+                      const std::vector<BasicMatrix<T> >& B,
+                      std::vector<BasicMatrix<T> >& C,
+                      ExecutionPolicy policy) {
+    if (A.size() != B.size()) {
+        throw std::invalid_argument("mathlib::multiply_batched - Los lotes A y B tienen tamaños distintos");
+    }
+    const int count = static_cast<int>(A.size());
+    if (count == 0) {
+        C.clear();
+        return;
+    }
+    const int m = A[0].num_rows();
+    const int k = A[0].num_cols();
+    const int n = B[0].num_cols();
+    for (int b = 0; b < count; ++b) {
+        if (A[b].num_rows() != m || A[b].num_cols() != k ||
+            B[b].num_rows() != k || B[b].num_cols() != n) {
+            throw std::invalid_argument("mathlib::multiply_batched - Todas las matrices del lote deben tener las mismas dimensiones");
+        }
+    }
+
+    if (C.size() > A.size()) {
+        C.erase(C.begin() + count, C.end());
+    }
+    std::vector<const T*> pa(count), pb(count);
+    std::vector<T*> pc(count);
+    for (int b = 0; b < count; ++b) {
+        if (b == static_cast<int>(C.size())) {
+            C.push_back(BasicMatrix<T>(m, n, BasicMatrix<T>::UNINITIALIZED));
+        } else if (C[b].num_rows() != m || C[b].num_cols() != n) {
+            C[b] = BasicMatrix<T>(m, n, BasicMatrix<T>::UNINITIALIZED);
+        }
+        pa[b] = A[b].data();
+        pb[b] = B[b].data();
+        pc[b] = C[b].data();
+    }
+    runBatch<T>(m, n, k, fromPointers(&pa[0]), std::max(1, k), fromPointers(&pb[0]), std::max(1, n),
+                fromPointers(&pc[0]), std::max(1, n), count, policy);
+}
+
+#define MATHLIB_INSTANTIATE_BATCHED(T)                                                             \
+    template void multiply_batched<T>(int, int, int, const T* const*, int, const T* const*, int,   \
+                                      T* const*, int, int, ExecutionPolicy);                       \
+    template void multiply_batched_strided<T>(int, int, int, const T*, int, std::ptrdiff_t,        \
+                                              const T*, int, std::ptrdiff_t,                       \
+                                              T*, int, std::ptrdiff_t, int, ExecutionPolicy);      \
+    template void multiply_batched<T>(const std::vector<BasicMatrix<T> >&,                         \
+                                      const std::vector<BasicMatrix<T> >&,                         \
+                                      std::vector<BasicMatrix<T> >&, ExecutionPolicy);
+
+MATHLIB_INSTANTIATE_BATCHED(float)
+MATHLIB_INSTANTIATE_BATCHED(double)
+MATHLIB_INSTANTIATE_BATCHED(int)
+MATHLIB_INSTANTIATE_BATCHED(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_BATCHED
+
+} // namespace mathlib
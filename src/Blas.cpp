@@ -0,0 +1,237 @@
+/**
+ * @file Blas.cpp
+ * @brief Puente hacia el proveedor CBLAS/LAPACK elegido al compilar
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * CBLAS admite directamente el almacenamiento por filas (CblasRowMajor),
+ * así que GEMM y GEMV se pasan tal cual. LAPACK solo trabaja por
+ * columnas: una matriz por filas es su traspuesta por columnas, de modo
+ * que potrf sobre el triángulo superior por columnas factoriza el
+ * inferior por filas sin mover nada, y getrf (que pivota filas) necesita
+ * trasponer la matriz en su sitio antes y después.
+ *
+ * Las rutinas de LAPACK se declaran a mano con la convención de Fortran
+ * (argumentos por puntero, guion bajo final y longitud oculta de los
+ * argumentos de carácter), porque no todos los proveedores instalan
+ * lapacke.h.
+ */
+
+#include "BlasBackend.h"
+#include "Transpose.h"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+#if defined(MATHLIB_BLAS)
+
+#if defined(MATHLIB_BLAS_MKL)
+#include <mkl_cblas.h>
+#else
+#include <cblas.h>
+#endif
+
+#if defined(MATHLIB_LAPACK)
+extern "C" {
+void sgetrf_(const int* m, const int* n, float* a, const int* lda, int* ipiv, int* info);
+void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+void spotrf_(const char* uplo, const int* n, float* a, const int* lda, int* info, std::size_t uploLength);
+void dpotrf_(const char* uplo, const int* n, double* a, const int* lda, int* info, std::size_t uploLength);
+}
+#endif
+
+namespace mathlib {
+
+namespace {
+
+/// Proveedor no desactivado con MATHLIB_BLAS=native
+bool blasEnabled() {
+    static const bool enabled = [] {
+        const char* requested = std::getenv("MATHLIB_BLAS");
+        return !(requested != NULL && std::strcmp(requested, "native") == 0);
+    }();
+    return enabled;
+}
+
+CBLAS_TRANSPOSE blasOp(Transpose trans) {
+    return trans == TRANS ? CblasTrans : CblasNoTrans;
+}
+
+bool useGemm(int m, int n, int k) {
+    return blasEnabled() && static_cast<double>(m) * n * k >= BLAS_MIN_VOLUME;
+}
+
+bool useGemv(int m, int n) {
+    return blasEnabled() && static_cast<double>(m) * n >= BLAS_MIN_GEMV_ELEMENTS;
+}
+
+#if defined(MATHLIB_LAPACK)
+bool useLapack(int n) {
+    return blasEnabled() && n >= BLAS_MIN_FACTOR;
+}
+
+/**
+ * @brief getrf sobre una matriz por filas, trasponiéndola en su sitio
+ *
+ * Las posiciones de ipiv (base 1) son los intercambios sucesivos de
+ * filas; aplicados a la identidad dan la permutación de la LU propia.
+ */
+template <class T, class Getrf>
+int rowMajorGetrf(int n, T* a, int lda, int* perm, int& swaps, Getrf getrf) {
+    if (!useLapack(n)) {
+        return -1;
+    }
+    transpose_inplace(n, a, lda);
+    std::vector<int> ipiv(n);
+    int info = 0;
+    getrf(&n, &n, a, &lda, &ipiv[0], &info);
+    transpose_inplace(n, a, lda);
+
+    swaps = 0;
+    for (int i = 0; i < n; ++i) {
+        perm[i] = i;
+    }
+    for (int i = 0; i < n; ++i) {
+        const int p = ipiv[i] - 1;
+        if (p != i) {
+            std::swap(perm[i], perm[p]);
+            ++swaps;
+        }
+    }
+    return info;
+}
+
+/// potrf del triángulo superior por columnas, que es el inferior por filas
+template <class T, class Potrf>
+int rowMajorPotrf(int n, T* a, int lda, Potrf potrf) {
+    if (!useLapack(n)) {
+        return -1;
+    }
+    const char uplo = 'U';
+    int info = 0;
+    potrf(&uplo, &n, a, &lda, &info, 1);
+    return info;
+}
+#endif
+
+} // namespace
+
+bool blas_available() {
+    return blasEnabled();
+}
+
+bool lapack_available() {
+#if defined(MATHLIB_LAPACK)
+    return blasEnabled();
+#else
+    return false;
+#endif
+}
+
+const char* blas_backend() {
+    if (!blasEnabled()) {
+        return "native";
+    }
+#if defined(MATHLIB_BLAS_MKL)
+    return "mkl";
+#elif defined(OPENBLAS_VERSION)
+    return "openblas";
+#else
+    return "cblas";
+#endif
+}
+
+bool blas_gemm(Transpose transA, Transpose transB, int m, int n, int k,
+               float alpha, const float* A, int lda, const float* B, int ldb,
+               float beta, float* C, int ldc) {
+    if (!useGemm(m, n, k)) {
+        return false;
+    }
+    cblas_sgemm(CblasRowMajor, blasOp(transA), blasOp(transB), m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+    return true;
+}
+
+bool blas_gemm(Transpose transA, Transpose transB, int m, int n, int k,
+               double alpha, const double* A, int lda, const double* B, int ldb,
+               double beta, double* C, int ldc) {
+    if (!useGemm(m, n, k)) {
+        return false;
+    }
+    cblas_dgemm(CblasRowMajor, blasOp(transA), blasOp(transB), m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+    return true;
+}
+
+bool blas_gemv(Transpose trans, int m, int n, float alpha, const float* A, int lda,
+               const float* x, float beta, float* y) {
+    if (!useGemv(m, n)) {
+        return false;
+    }
+    cblas_sgemv(CblasRowMajor, blasOp(trans), m, n, alpha, A, lda, x, 1, beta, y, 1);
+    return true;
+}
+
+bool blas_gemv(Transpose trans, int m, int n, double alpha, const double* A, int lda,
+               const double* x, double beta, double* y) {
+    if (!useGemv(m, n)) {
+        return false;
+    }
+    cblas_dgemv(CblasRowMajor, blasOp(trans), m, n, alpha, A, lda, x, 1, beta, y, 1);
+    return true;
+}
+
+#if defined(MATHLIB_LAPACK)
+
+int lapack_getrf(int n, float* a, int lda, int* perm, int& swaps) {
+    return rowMajorGetrf(n, a, lda, perm, swaps, sgetrf_);
+}
+
+int lapack_getrf(int n, double* a, int lda, int* perm, int& swaps) {
+    return rowMajorGetrf(n, a, lda, perm, swaps, dgetrf_);
+}
+
+int lapack_potrf(int n, float* a, int lda) {
+    return rowMajorPotrf(n, a, lda, spotrf_);
+}
+
+int lapack_potrf(int n, double* a, int lda) {
+    return rowMajorPotrf(n, a, lda, dpotrf_);
+}
+
+#else
+
+int lapack_getrf(int, float*, int, int*, int&) { return -1; }
+int lapack_getrf(int, double*, int, int*, int&) { return -1; }
+int lapack_potrf(int, float*, int) { return -1; }
+int lapack_potrf(int, double*, int) { return -1; }
+
+#endif
+
+} // namespace mathlib
+
+#else
+
+namespace mathlib {
+
+bool blas_available() { return false; }
+bool lapack_available() { return false; }
+const char* blas_backend() { return "native"; }
+
+bool blas_gemm(Transpose, Transpose, int, int, int, float, const float*, int, const float*, int,
+               float, float*, int) { return false; }
+bool blas_gemm(Transpose, Transpose, int, int, int, double, const double*, int, const double*, int,
+               double, double*, int) { return false; }
+bool blas_gemv(Transpose, int, int, float, const float*, int, const float*, float, float*) { return false; }
+bool blas_gemv(Transpose, int, int, double, const double*, int, const double*, double, double*) { return false; }
+int lapack_getrf(int, float*, int, int*, int&) { return -1; }
+int lapack_getrf(int, double*, int, int*, int&) { return -1; }
+int lapack_potrf(int, float*, int) { return -1; }
+int lapack_potrf(int, double*, int) { return -1; }
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file BlasBackend.h
+ * @brief Llamadas al proveedor CBLAS/LAPACK (uso interno)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Blas.cpp implementa las sobrecargas de float y double sobre CBLAS y
+ * LAPACK cuando se compila con MATHLIB_BLAS. Cada función devuelve true
+ * si el proveedor ha hecho el cálculo y false si el llamante debe usar
+ * su kernel propio: sin proveedor, con MATHLIB_BLAS=native, por debajo
+ * de los umbrales de Blas.h o para tipos sin rutina BLAS (las plantillas
+ * genéricas de este archivo).
+ */
+
+#ifndef BLAS_BACKEND_H
+#define BLAS_BACKEND_H
+
+#include "Blas.h"
+#include "Gemm.h"
+
+namespace mathlib {
+
+/// C = alpha · op(A) × op(B) + beta · C con el proveedor (m·n·k >= BLAS_MIN_VOLUME)
+bool blas_gemm(Transpose transA, Transpose transB, int m, int n, int k,
+               float alpha, const float* A, int lda, const float* B, int ldb,
+               float beta, float* C, int ldc);
+bool blas_gemm(Transpose transA, Transpose transB, int m, int n, int k,
+               double alpha, const double* A, int lda, const double* B, int ldb,
+               double beta, double* C, int ldc);
+
+template <class T>
+bool blas_gemm(Transpose, Transpose, int, int, int, T, const T*, int, const T*, int, T, T*, int) {
+    return false;
+}
+
+/// y = alpha · op(A) · x + beta · y con el proveedor (m·n >= BLAS_MIN_GEMV_ELEMENTS)
+bool blas_gemv(Transpose trans, int m, int n, float alpha, const float* A, int lda,
+               const float* x, float beta, float* y);
+bool blas_gemv(Transpose trans, int m, int n, double alpha, const double* A, int lda,
+               const double* x, double beta, double* y);
+
+template <class T>
+bool blas_gemv(Transpose, int, int, T, const T*, int, const T*, T, T*) {
+    return false;
+}
+
+/**
+ * @brief P·A = L·U con ?getrf sobre la matriz n x n por filas (n >= BLAS_MIN_FACTOR)
+ *
+ * Deja L (sin la diagonal unidad) y U juntas en a, como la LU propia.
+ *
+ * @param perm Recibe P (n elementos): la fila i de P·A es la fila perm[i] de A
+ * @param swaps Recibe el número de intercambios de filas
+ * @return -1 si no se ha usado LAPACK, 0 si la factorización terminó y
+ *         un valor positivo si A es singular (el info de LAPACK)
+ */
+int lapack_getrf(int n, float* a, int lda, int* perm, int& swaps);
+int lapack_getrf(int n, double* a, int lda, int* perm, int& swaps);
+
+/**
+ * @brief A = L·Lᵀ con ?potrf; L queda en el triángulo inferior (n >= BLAS_MIN_FACTOR)
+ *
+ * Solo se lee y se escribe el triángulo inferior.
+ *
+ * @return -1 si no se ha usado LAPACK, 0 si la factorización terminó y
+ *         un valor positivo si A no es definida positiva
+ */
+int lapack_potrf(int n, float* a, int lda);
+int lapack_potrf(int n, double* a, int lda);
+
+} // namespace mathlib
+
+#endif
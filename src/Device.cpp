@@ -0,0 +1,211 @@
+/**
+ * @file Device.cpp
+ * @brief Implementación de DeviceMatrix y de la selección host/dispositivo
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada DeviceMatrix comparte un Storage con dos copias opcionales: la del
+ * host (una BasicMatrix) y la del dispositivo (un bloque contiguo por
+ * filas). Al menos una es válida siempre; la otra se crea bajo demanda con
+ * el mutex del Storage tomado, de modo que varios hilos pueden leer la
+ * misma matriz sin transferirla dos veces. Como los datos nunca se
+ * modifican tras crearse, ambas copias siguen siendo válidas una vez
+ * hechas.
+ */
+
+#include "Device.h"
+#include "DeviceBackend.h"
+#include "Matrix.h"
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace mathlib {
+
+namespace {
+
+/// Dispositivo presente y no desactivado con MATHLIB_DEVICE=cpu
+bool deviceEnabled() {
+    static const bool enabled = [] {
+        const char* requested = std::getenv("MATHLIB_DEVICE");
+        return device_present() && !(requested != NULL && std::strcmp(requested, "cpu") == 0);
+    }();
+    return enabled;
+}
+
+} // namespace
+
+bool device_available() {
+    return deviceEnabled();
+}
+
+const char* device_backend() {
+    return deviceEnabled() ? device_backend_name() : "cpu";
+}
+
+/**
+ * @brief Copias de una matriz en el host y en el dispositivo
+ */
+template <class T>
+struct DeviceMatrix<T>::Storage {
+    int rows;
+    int cols;
+    std::mutex mutex;
+    std::unique_ptr<BasicMatrix<T> > host;
+    T* device;
+
+    Storage(int r, int c) : rows(r), cols(c), device(NULL) {}
+    ~Storage() { device_release(device); }
+
+    std::size_t bytes() const { return static_cast<std::size_t>(rows) * cols * sizeof(T); }
+
+    /// Reserva la copia del dispositivo sin rellenarla (para resultados)
+    T* allocateDevice() {
+        device = static_cast<T*>(device_allocate(bytes()));
+        return device;
+    }
+
+    /// Copia del dispositivo, subiéndola si aún no existe
+    const T* deviceData() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (device == NULL) {
+            T* buffer = static_cast<T*>(device_allocate(bytes()));
+            try {
+                device_upload(buffer, host->data(), static_cast<std::size_t>(host->stride()) * sizeof(T),
+                              static_cast<std::size_t>(cols) * sizeof(T), static_cast<std::size_t>(rows));
+            } catch (...) {
+                device_release(buffer);
+                throw;
+            }
+            device = buffer;
+        }
+        return device;
+    }
+
+    /// Copia del host, descargándola si aún no existe
+    const BasicMatrix<T>& hostData() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!host) {
+            std::unique_ptr<BasicMatrix<T> > copy(new BasicMatrix<T>(rows, cols, BasicMatrix<T>::UNINITIALIZED));
+            device_download(copy->data(), static_cast<std::size_t>(copy->stride()) * sizeof(T), device,
+                            static_cast<std::size_t>(cols) * sizeof(T), static_cast<std::size_t>(rows));
+            host = std::move(copy);
+        }
+        return *host;
+    }
+
+    bool onDevice() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return device != NULL;
+    }
+
+    bool onHost() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<bool>(host);
+    }
+};
+
+template <class T>
+DeviceMatrix<T>::DeviceMatrix(const BasicMatrix<T>& host)
+    : storage(std::make_shared<Storage>(host.num_rows(), host.num_cols())) {
+    storage->host.reset(new BasicMatrix<T>(host));
+}
+
+template <class T>
+int DeviceMatrix<T>::num_rows() const {
+    return storage->rows;
+}
+
+template <class T>
+int DeviceMatrix<T>::num_cols() const {
+    return storage->cols;
+}
+
+template <class T>
+bool DeviceMatrix<T>::on_device() const {
+    return storage->onDevice();
+}
+
+template <class T>
+bool DeviceMatrix<T>::on_host() const {
+    return storage->onHost();
+}
+
+template <class T>
+void DeviceMatrix<T>::upload() const {
+    if (deviceEnabled()) {
+        storage->deviceData();
+    }
+}
+
+template <class T>
+DeviceMatrix<T> DeviceMatrix<T>::multiply(const DeviceMatrix& other) const {
+    const int m = storage->rows;
+    const int k = storage->cols;
+    const int n = other.storage->cols;
+    if (k != other.storage->rows) {
+        throw std::invalid_argument("DeviceMatrix::multiply - Dimensiones incompatibles para multiplicación");
+    }
+    const bool resident = on_device() || other.on_device();
+    if (deviceEnabled() && (resident || static_cast<double>(m) * n * k >= DEVICE_MIN_VOLUME)) {
+        const T* a = storage->deviceData();
+        const T* b = other.storage->deviceData();
+        std::shared_ptr<Storage> out = std::make_shared<Storage>(m, n);
+        device_gemm(m, n, k, a, b, out->allocateDevice());
+        return DeviceMatrix(out);
+    }
+    std::shared_ptr<Storage> out = std::make_shared<Storage>(m, n);
+    out->host.reset(new BasicMatrix<T>(host().multiply(other.host(), MultiplyOptions(PARALLEL))));
+    return DeviceMatrix(out);
+}
+
+template <class T>
+DeviceMatrix<T> DeviceMatrix<T>::combine(const DeviceMatrix& other, T beta, const char* where) const {
+    const int rows = storage->rows;
+    const int cols = storage->cols;
+    if (rows != other.storage->rows || cols != other.storage->cols) {
+        throw std::invalid_argument(std::string(where) + " - Las matrices deben tener el mismo tamaño");
+    }
+    std::shared_ptr<Storage> out = std::make_shared<Storage>(rows, cols);
+    if (deviceEnabled() && (on_device() || other.on_device())) {
+        const T* a = storage->deviceData();
+        const T* b = other.storage->deviceData();
+        device_geam(rows, cols, a, beta, b, out->allocateDevice());
+    } else if (beta == T(1)) {
+        out->host.reset(new BasicMatrix<T>(host().add(other.host())));
+    } else {
+        out->host.reset(new BasicMatrix<T>(host().subtract(other.host())));
+    }
+    return DeviceMatrix(out);
+}
+
+template <class T>
+DeviceMatrix<T> DeviceMatrix<T>::add(const DeviceMatrix& other) const {
+    return combine(other, T(1), "DeviceMatrix::add");
+}
+
+template <class T>
+DeviceMatrix<T> DeviceMatrix<T>::subtract(const DeviceMatrix& other) const {
+    return combine(other, T(-1), "DeviceMatrix::subtract");
+}
+
+template <class T>
+T DeviceMatrix<T>::get(int r, int c) const {
+    if (r < 0 || r >= storage->rows || c < 0 || c >= storage->cols) {
+        throw std::out_of_range("DeviceMatrix::get - Índice fuera de rango");
+    }
+    return host()(r, c);
+}
+
+template <class T>
+const BasicMatrix<T>& DeviceMatrix<T>::host() const {
+    return storage->hostData();
+}
+
+template class DeviceMatrix<float>;
+template class DeviceMatrix<double>;
+
+} // namespace mathlib
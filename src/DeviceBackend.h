@@ -0,0 +1,59 @@
+/**
+ * @file DeviceBackend.h
+ * @brief Primitivas del backend de GPU (uso interno)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * DeviceGpu.cpp implementa estas funciones con CUDA (cuBLAS) o HIP
+ * (hipBLAS) según MATHLIB_CUDA / MATHLIB_HIP; sin ninguno de los dos,
+ * device_present() devuelve false y el resto no se llama nunca. Las
+ * matrices se guardan en el dispositivo por filas y sin relleno (la
+ * separación entre filas es igual al número de columnas).
+ *
+ * Todas las funciones lanzan std::runtime_error si el dispositivo
+ * devuelve un error.
+ */
+
+#ifndef DEVICE_BACKEND_H
+#define DEVICE_BACKEND_H
+
+#include <cstddef>
+
+namespace mathlib {
+
+/// Hay backend compilado y al menos un dispositivo
+bool device_present();
+
+/// Nombre del backend compilado ("cuda", "hip" o "cpu")
+const char* device_backend_name();
+
+/// Reserva bytes en el dispositivo
+void* device_allocate(std::size_t bytes);
+
+/// Libera una reserva de device_allocate() (ignora NULL)
+void device_release(void* ptr);
+
+/**
+ * @brief Copia rows filas de width bytes del host (separadas src_pitch)
+ *        al dispositivo (contiguas)
+ */
+void device_upload(void* dst, const void* src, std::size_t src_pitch, std::size_t width, std::size_t rows);
+
+/**
+ * @brief Copia rows filas contiguas de width bytes del dispositivo al
+ *        host (separadas dst_pitch)
+ */
+void device_download(void* dst, std::size_t dst_pitch, const void* src, std::size_t width, std::size_t rows);
+
+/// C = A × B con A de m x k, B de k x n y C de m x n, en el dispositivo
+void device_gemm(int m, int n, int k, const float* a, const float* b, float* c);
+void device_gemm(int m, int n, int k, const double* a, const double* b, double* c);
+
+/// C = A + beta · B con matrices de rows x cols, en el dispositivo
+void device_geam(int rows, int cols, const float* a, float beta, const float* b, float* c);
+void device_geam(int rows, int cols, const double* a, double beta, const double* b, double* c);
+
+} // namespace mathlib
+
+#endif
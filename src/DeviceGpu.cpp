@@ -0,0 +1,193 @@
+/**
+ * @file DeviceGpu.cpp
+ * @brief Backend de GPU sobre CUDA/cuBLAS o HIP/hipBLAS
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Solo usa la API de host de cada plataforma (reservas, copias y BLAS),
+ * así que se compila con el compilador de C++ normal y no necesita nvcc
+ * ni hipcc. cuBLAS y hipBLAS trabajan por columnas: una matriz por filas
+ * de m x n es su traspuesta por columnas, de modo que C = A × B se calcula
+ * como Cᵀ = Bᵀ × Aᵀ intercambiando los operandos.
+ *
+ * El manejador de BLAS se crea en el primer uso y se comparte; un mutex
+ * serializa las llamadas, que ya se ejecutan en orden en el flujo por
+ * defecto del dispositivo.
+ */
+
+#include "DeviceBackend.h"
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#if defined(MATHLIB_CUDA) || defined(MATHLIB_HIP)
+
+#if defined(MATHLIB_CUDA)
+#include <cublas_v2.h>
+#include <cuda_runtime.h>
+
+typedef cudaError_t gpuError_t;
+typedef cublasHandle_t gpuBlasHandle_t;
+typedef cublasStatus_t gpuBlasStatus_t;
+#define gpuSuccess cudaSuccess
+#define gpuGetErrorString cudaGetErrorString
+#define gpuGetDeviceCount cudaGetDeviceCount
+#define gpuMalloc cudaMalloc
+#define gpuFree cudaFree
+#define gpuMemcpy2D cudaMemcpy2D
+#define gpuMemcpyHostToDevice cudaMemcpyHostToDevice
+#define gpuMemcpyDeviceToHost cudaMemcpyDeviceToHost
+#define gpuBlasCreate cublasCreate
+#define gpuBlasSgemm cublasSgemm
+#define gpuBlasDgemm cublasDgemm
+#define gpuBlasSgeam cublasSgeam
+#define gpuBlasDgeam cublasDgeam
+#define GPU_BLAS_SUCCESS CUBLAS_STATUS_SUCCESS
+#define GPU_BLAS_OP_N CUBLAS_OP_N
+#define MATHLIB_GPU_NAME "cuda"
+#else
+#include <hip/hip_runtime.h>
+#include <hipblas/hipblas.h>
+
+typedef hipError_t gpuError_t;
+typedef hipblasHandle_t gpuBlasHandle_t;
+typedef hipblasStatus_t gpuBlasStatus_t;
+#define gpuSuccess hipSuccess
+#define gpuGetErrorString hipGetErrorString
+#define gpuGetDeviceCount hipGetDeviceCount
+#define gpuMalloc hipMalloc
+#define gpuFree hipFree
+#define gpuMemcpy2D hipMemcpy2D
+#define gpuMemcpyHostToDevice hipMemcpyHostToDevice
+#define gpuMemcpyDeviceToHost hipMemcpyDeviceToHost
+#define gpuBlasCreate hipblasCreate
+#define gpuBlasSgemm hipblasSgemm
+#define gpuBlasDgemm hipblasDgemm
+#define gpuBlasSgeam hipblasSgeam
+#define gpuBlasDgeam hipblasDgeam
+#define GPU_BLAS_SUCCESS HIPBLAS_STATUS_SUCCESS
+#define GPU_BLAS_OP_N HIPBLAS_OP_N
+#define MATHLIB_GPU_NAME "hip"
+#endif
+
+namespace mathlib {
+
+namespace {
+
+void check(gpuError_t status, const char* where) {
+    if (status != gpuSuccess) {
+        throw std::runtime_error(std::string(where) + " - " + gpuGetErrorString(status));
+    }
+}
+
+void checkBlas(gpuBlasStatus_t status, const char* where) {
+    if (status != GPU_BLAS_SUCCESS) {
+        throw std::runtime_error(std::string(where) + " - Error de BLAS " + std::to_string(static_cast<int>(status)));
+    }
+}
+
+std::mutex& blasMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Manejador compartido; se llama con blasMutex() tomado
+gpuBlasHandle_t blasHandle() {
+    static gpuBlasHandle_t handle = NULL;
+    if (handle == NULL) {
+        checkBlas(gpuBlasCreate(&handle), "mathlib::device_gemm");
+    }
+    return handle;
+}
+
+} // namespace
+
+bool device_present() {
+    static const bool present = [] {
+        int count = 0;
+        return gpuGetDeviceCount(&count) == gpuSuccess && count > 0;
+    }();
+    return present;
+}
+
+const char* device_backend_name() {
+    return MATHLIB_GPU_NAME;
+}
+
+void* device_allocate(std::size_t bytes) {
+    void* ptr = NULL;
+    check(gpuMalloc(&ptr, bytes), "mathlib::device_allocate");
+    return ptr;
+}
+
+void device_release(void* ptr) {
+    if (ptr != NULL) {
+        gpuFree(ptr);
+    }
+}
+
+void device_upload(void* dst, const void* src, std::size_t src_pitch, std::size_t width, std::size_t rows) {
+    check(gpuMemcpy2D(dst, width, src, src_pitch, width, rows, gpuMemcpyHostToDevice), "mathlib::device_upload");
+}
+
+void device_download(void* dst, std::size_t dst_pitch, const void* src, std::size_t width, std::size_t rows) {
+    check(gpuMemcpy2D(dst, dst_pitch, src, width, width, rows, gpuMemcpyDeviceToHost), "mathlib::device_download");
+}
+
+void device_gemm(int m, int n, int k, const float* a, const float* b, float* c) {
+    const float one = 1.0f, zero = 0.0f;
+    std::lock_guard<std::mutex> lock(blasMutex());
+    checkBlas(gpuBlasSgemm(blasHandle(), GPU_BLAS_OP_N, GPU_BLAS_OP_N, n, m, k, &one, b, n, a, k, &zero, c, n),
+              "mathlib::device_gemm");
+}
+
+void device_gemm(int m, int n, int k, const double* a, const double* b, double* c) {
+    const double one = 1.0, zero = 0.0;
+    std::lock_guard<std::mutex> lock(blasMutex());
+    checkBlas(gpuBlasDgemm(blasHandle(), GPU_BLAS_OP_N, GPU_BLAS_OP_N, n, m, k, &one, b, n, a, k, &zero, c, n),
+              "mathlib::device_gemm");
+}
+
+void device_geam(int rows, int cols, const float* a, float beta, const float* b, float* c) {
+    const float one = 1.0f;
+    std::lock_guard<std::mutex> lock(blasMutex());
+    checkBlas(gpuBlasSgeam(blasHandle(), GPU_BLAS_OP_N, GPU_BLAS_OP_N, cols, rows, &one, a, cols, &beta, b, cols, c, cols),
+              "mathlib::device_geam");
+}
+
+void device_geam(int rows, int cols, const double* a, double beta, const double* b, double* c) {
+    const double one = 1.0;
+    std::lock_guard<std::mutex> lock(blasMutex());
+    checkBlas(gpuBlasDgeam(blasHandle(), GPU_BLAS_OP_N, GPU_BLAS_OP_N, cols, rows, &one, a, cols, &beta, b, cols, c, cols),
+              "mathlib::device_geam");
+}
+
+} // namespace mathlib
+
+#else
+
+namespace mathlib {
+
+namespace {
+
+[[noreturn]] void noBackend(const char* where) {
+    throw std::runtime_error(std::string(where) + " - Biblioteca compilada sin backend de GPU");
+}
+
+} // namespace
+
+bool device_present() { return false; }
+const char* device_backend_name() { return "cpu"; }
+void* device_allocate(std::size_t) { noBackend("mathlib::device_allocate"); }
+void device_release(void*) {}
+void device_upload(void*, const void*, std::size_t, std::size_t, std::size_t) { noBackend("mathlib::device_upload"); }
+void device_download(void*, std::size_t, const void*, std::size_t, std::size_t) { noBackend("mathlib::device_download"); }
+void device_gemm(int, int, int, const float*, const float*, float*) { noBackend("mathlib::device_gemm"); }
+void device_gemm(int, int, int, const double*, const double*, double*) { noBackend("mathlib::device_gemm"); }
+void device_geam(int, int, const float*, float, const float*, float*) { noBackend("mathlib::device_geam"); }
+void device_geam(int, int, const double*, double, const double*, double*) { noBackend("mathlib::device_geam"); }
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,442 @@
+/**
+ * @file Factorization.cpp
+ * @brief Implementación de las factorizaciones LU y de Cholesky por bloques
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Versiones «right-looking» de getrf y potrf de LAPACK adaptadas al
+ * almacenamiento por filas: los paneles se factorizan con bucles que
+ * recorren filas contiguas (vec_axpy) y la actualización del resto de la
+ * matriz se hace con gemm() en franjas de TRAILING_COLUMNS columnas, de
+ * modo que el temporal del producto no crece con n².
+ */
+
+#include "Factorization.h"
+#include "BlasBackend.h"
+#include "Gemm.h"
+#include "Kernels.h"
+#include "KernelsInternal.h"
+#include "Profiling.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace mathlib {
+
+namespace {
+
+/// Columnas de cada franja de la actualización con GEMM
+const int TRAILING_COLUMNS = 256;
+
+template <class T>
+void multiplyBlock(Transpose transB, int m, int n, int k, const T* A, int lda, const T* B, int ldb,
+                   T* C, int ldc, ExecutionPolicy policy) {
+    if (policy == PARALLEL) {
+        gemm_parallel(NO_TRANS, transB, m, n, k, A, lda, B, ldb, C, ldc, ThreadPool::global());
+    } else {
+        gemm(NO_TRANS, transB, m, n, k, A, lda, B, ldb, C, ldc);
+    }
+}
+
+/**
+ * @brief C -= A × op(B) por franjas de columnas, con temp de m x TRAILING_COLUMNS
+ */
+template <class T>
+void subtractProduct(int m, int n, int k, const T* A, int lda, const T* B, int ldb,
+                     T* C, int ldc, T* temp, ExecutionPolicy policy, Transpose transB = NO_TRANS) {
+    if (m <= 0 || n <= 0 || k <= 0) {
+        return;
+    }
+    for (int c0 = 0; c0 < n; c0 += TRAILING_COLUMNS) {
+        const int w = std::min(TRAILING_COLUMNS, n - c0);
+        const T* Bc = transB == TRANS ? B + static_cast<std::size_t>(c0) * ldb : B + c0;
+        multiplyBlock(transB, m, w, k, A, lda, Bc, ldb, temp, w, policy);
+        apply_elementwise<T>(vec_sub, m, w, C + c0, ldc, temp, w, C + c0, ldc);
+    }
+}
+
+/// Pone a cero los elementos por encima de la diagonal
+template <class T>
+void clearUpperTriangle(int n, T* a, int lda) {
+    for (int i = 0; i < n; ++i) {
+        T* row = a + static_cast<std::size_t>(i) * lda;
+        std::fill(row + i + 1, row + n, T());
+    }
+}
+
+template <class T>
+T dot(int n, const T* a, const T* b) {
+    T acc = T();
+    for (int i = 0; i < n; ++i) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+/**
+ * @brief Resuelve L·X = B por bloques, con L triangular inferior
+ *
+ * Cada bloque de filas resta primero con GEMM la contribución de los
+ * bloques ya resueltos y después se resuelve fila a fila.
+ */
+template <class T>
+void lowerSolve(int n, int nrhs, const T* L, int ldl, bool unitDiagonal,
+                T* B, int ldb, T* temp, ExecutionPolicy policy) {
+    for (int i0 = 0; i0 < n; i0 += FACTOR_BLOCK) {
+        const int ib = std::min(FACTOR_BLOCK, n - i0);
+        T* Bi = B + static_cast<std::size_t>(i0) * ldb;
+        subtractProduct(ib, nrhs, i0, L + static_cast<std::size_t>(i0) * ldl, ldl,
+                        B, ldb, Bi, ldb, temp, policy);
+        for (int i = i0; i < i0 + ib; ++i) {
+            const T* Li = L + static_cast<std::size_t>(i) * ldl;
+            T* row = B + static_cast<std::size_t>(i) * ldb;
+            for (int p = i0; p < i; ++p) {
+                vec_axpy(static_cast<std::size_t>(nrhs), -Li[p], B + static_cast<std::size_t>(p) * ldb, row);
+            }
+            if (!unitDiagonal) {
+                vec_scale(static_cast<std::size_t>(nrhs), T(1) / Li[i], row, row);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Resuelve U·X = B por bloques, con U triangular superior
+ */
+template <class T>
+void upperSolve(int n, int nrhs, const T* U, int ldu, T* B, int ldb, T* temp, ExecutionPolicy policy) {
+    for (int i1 = n; i1 > 0; i1 -= FACTOR_BLOCK) {
+        const int i0 = std::max(0, i1 - FACTOR_BLOCK);
+        const int ib = i1 - i0;
+        T* Bi = B + static_cast<std::size_t>(i0) * ldb;
+        subtractProduct(ib, nrhs, n - i1, U + static_cast<std::size_t>(i0) * ldu + i1, ldu,
+                        B + static_cast<std::size_t>(i1) * ldb, ldb, Bi, ldb, temp, policy);
+        for (int i = i1 - 1; i >= i0; --i) {
+            const T* Ui = U + static_cast<std::size_t>(i) * ldu;
+            T* row = B + static_cast<std::size_t>(i) * ldb;
+            for (int p = i + 1; p < i1; ++p) {
+                vec_axpy(static_cast<std::size_t>(nrhs), -Ui[p], B + static_cast<std::size_t>(p) * ldb, row);
+            }
+            vec_scale(static_cast<std::size_t>(nrhs), T(1) / Ui[i], row, row);
+        }
+    }
+}
+
+/**
+ * @brief Resuelve Lᵀ·X = B con L triangular inferior, recorriendo filas de L
+ *
+ * La fila i de L es la columna i de Lᵀ: al despejar X_i se resta
+ * L(i, p)·X_i de cada B_p con p < i.
+ */
+template <class T>
+void lowerTransposeSolve(int n, int nrhs, const T* L, int ldl, T* B, int ldb) {
+    for (int i = n - 1; i >= 0; --i) {
+        const T* Li = L + static_cast<std::size_t>(i) * ldl;
+        T* row = B + static_cast<std::size_t>(i) * ldb;
+        vec_scale(static_cast<std::size_t>(nrhs), T(1) / Li[i], row, row);
+        if (nrhs == 1 && ldb == 1) {
+            vec_axpy(static_cast<std::size_t>(i), -row[0], Li, B);
+            continue;
+        }
+        for (int p = 0; p < i; ++p) {
+            vec_axpy(static_cast<std::size_t>(nrhs), -Li[p], row, B + static_cast<std::size_t>(p) * ldb);
+        }
+    }
+}
+
+void checkRhs(int n, int rows, const char* message) {
+    if (rows != n) {
+        throw std::invalid_argument(message);
+    }
+}
+
+template <class T>
+BasicMatrix<T> identity(int n) {
+    BasicMatrix<T> I(n, n);
+    for (int i = 0; i < n; ++i) {
+        I(i, i) = T(1);
+    }
+    return I;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// LU
+// ---------------------------------------------------------------------------
+
+template <class T>
+BasicLUFactorization<T>::BasicLUFactorization(const BasicMatrix<T>& A, ExecutionPolicy policy)
+    : factors(A), perm(), swaps(0) {
+    if (A.num_rows() != A.num_cols()) {
+        throw std::invalid_argument("LUFactorization::LUFactorization - La matriz debe ser cuadrada");
+    }
+    const int n = A.num_rows();
+    MATHLIB_PROFILE_SCOPE(PROFILE_FACTORIZE, n, n, n, 2.0 / 3.0 * n * n * n);
+    const int lda = factors.stride();
+    T* a = factors.data();
+    perm.resize(n);
+    for (int i = 0; i < n; ++i) {
+        perm[i] = i;
+    }
+
+    const int status = lapack_getrf(n, a, lda, &perm[0], swaps);
+    if (status > 0) {
+        throw std::runtime_error("LUFactorization::LUFactorization - La matriz es singular");
+    }
+    if (status == 0) {
+        return;
+    }
+    std::vector<T> temp(static_cast<std::size_t>(n) * TRAILING_COLUMNS);
+
+    for (int j0 = 0; j0 < n; j0 += FACTOR_BLOCK) {
+        const int jb = std::min(FACTOR_BLOCK, n - j0);
+        const int jEnd = j0 + jb;
+
+        // Panel: columnas [j0, jEnd) con pivoteo parcial; se intercambian filas completas
+        for (int c = j0; c < jEnd; ++c) {
+            int piv = c;
+            double best = std::abs(a[static_cast<std::size_t>(c) * lda + c]);
+            for (int r = c + 1; r < n; ++r) {
+                double v = std::abs(a[static_cast<std::size_t>(r) * lda + c]);
+                if (v > best) {
+                    best = v;
+                    piv = r;
+                }
+            }
+            if (best == 0.0) {
+                throw std::runtime_error("LUFactorization::LUFactorization - La matriz es singular");
+            }
+            T* rowC = a + static_cast<std::size_t>(c) * lda;
+            if (piv != c) {
+                std::swap_ranges(rowC, rowC + n, a + static_cast<std::size_t>(piv) * lda);
+                std::swap(perm[c], perm[piv]);
+                ++swaps;
+            }
+            const T inv = T(1) / rowC[c];
+            for (int r = c + 1; r < n; ++r) {
+                T* rowR = a + static_cast<std::size_t>(r) * lda;
+                rowR[c] *= inv;
+                vec_axpy(static_cast<std::size_t>(jEnd - c - 1), -rowR[c], rowC + c + 1, rowR + c + 1);
+            }
+        }
+
+        if (jEnd == n) {
+            break;
+        }
+
+        // U12 = L11⁻¹ · A12
+        for (int i = j0 + 1; i < jEnd; ++i) {
+            T* rowI = a + static_cast<std::size_t>(i) * lda;
+            for (int p = j0; p < i; ++p) {
+                vec_axpy(static_cast<std::size_t>(n - jEnd), -rowI[p],
+                         a + static_cast<std::size_t>(p) * lda + jEnd, rowI + jEnd);
+            }
+        }
+
+        // A22 -= L21 · U12
+        subtractProduct(n - jEnd, n - jEnd, jb,
+                        a + static_cast<std::size_t>(jEnd) * lda + j0, lda,
+                        a + static_cast<std::size_t>(j0) * lda + jEnd, lda,
+                        a + static_cast<std::size_t>(jEnd) * lda + jEnd, lda,
+                        &temp[0], policy);
+    }
+}
+
+template <class T>
+T BasicLUFactorization<T>::determinant() const {
+    T det = swaps % 2 == 0 ? T(1) : T(-1);
+    for (int i = 0; i < size(); ++i) {
+        det *= factors(i, i);
+    }
+    return det;
+}
+
+template <class T>
+BasicMatrix<T> BasicLUFactorization<T>::solve(const BasicMatrix<T>& B) const {
+    BasicMatrix<T> X(B);
+    solve_in_place(X);
+    return X;
+}
+
+template <class T>
+void BasicLUFactorization<T>::solve_in_place(BasicMatrix<T>& B) const {
+    const int n = size();
+    checkRhs(n, B.num_rows(), "LUFactorization::solve - El lado derecho debe tener n filas");
+    const int nrhs = B.num_cols();
+    MATHLIB_PROFILE_SCOPE(PROFILE_SOLVE, n, nrhs, n, 2.0 * n * n * nrhs);
+
+    // B <- P·B
+    BasicMatrix<T> permuted(n, nrhs, BasicMatrix<T>::UNINITIALIZED);
+    for (int i = 0; i < n; ++i) {
+        std::copy(B.data() + static_cast<std::size_t>(perm[i]) * B.stride(),
+                  B.data() + static_cast<std::size_t>(perm[i]) * B.stride() + nrhs,
+                  permuted.data() + static_cast<std::size_t>(i) * permuted.stride());
+    }
+
+    std::vector<T> temp(static_cast<std::size_t>(FACTOR_BLOCK) * std::min(nrhs, TRAILING_COLUMNS));
+    lowerSolve(n, nrhs, factors.data(), factors.stride(), true,
+               permuted.data(), permuted.stride(), &temp[0], SEQUENTIAL);
+    upperSolve(n, nrhs, factors.data(), factors.stride(),
+               permuted.data(), permuted.stride(), &temp[0], SEQUENTIAL);
+    B = std::move(permuted);
+}
+
+template <class T>
+void BasicLUFactorization<T>::solve_in_place(Span<T> b) const {
+    const int n = size();
+    checkRhs(n, static_cast<int>(b.size()), "LUFactorization::solve - El vector debe tener n elementos");
+    MATHLIB_PROFILE_SCOPE(PROFILE_SOLVE, n, 1, n, 2.0 * n * n);
+    std::vector<T> x(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = b[perm[i]];
+    }
+    const T* a = factors.data();
+    const int lda = factors.stride();
+    for (int i = 1; i < n; ++i) {
+        x[i] -= dot(i, a + static_cast<std::size_t>(i) * lda, &x[0]);
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        const T* rowI = a + static_cast<std::size_t>(i) * lda;
+        x[i] = (x[i] - dot(n - i - 1, rowI + i + 1, &x[i + 1])) / rowI[i];
+    }
+    std::copy(x.begin(), x.end(), b.begin());
+}
+
+template <class T>
+BasicMatrix<T> BasicLUFactorization<T>::inverse() const {
+    BasicMatrix<T> X = identity<T>(size());
+    solve_in_place(X);
+    return X;
+}
+
+// ---------------------------------------------------------------------------
+// Cholesky
+// ---------------------------------------------------------------------------
+
+template <class T>
+BasicCholeskyFactorization<T>::BasicCholeskyFactorization(const BasicMatrix<T>& A, ExecutionPolicy policy)
+    : factor(A) {
+    if (A.num_rows() != A.num_cols()) {
+        throw std::invalid_argument("CholeskyFactorization::CholeskyFactorization - La matriz debe ser cuadrada");
+    }
+    const int n = A.num_rows();
+    MATHLIB_PROFILE_SCOPE(PROFILE_FACTORIZE, n, n, n, 1.0 / 3.0 * n * n * n);
+    const int lda = factor.stride();
+    T* a = factor.data();
+
+    const int status = lapack_potrf(n, a, lda);
+    if (status > 0) {
+        throw std::runtime_error("CholeskyFactorization::CholeskyFactorization - La matriz no es definida positiva");
+    }
+    if (status == 0) {
+        clearUpperTriangle(n, a, lda);
+        return;
+    }
+    std::vector<T> temp(static_cast<std::size_t>(n) * TRAILING_COLUMNS);
+
+    for (int j0 = 0; j0 < n; j0 += FACTOR_BLOCK) {
+        const int jb = std::min(FACTOR_BLOCK, n - j0);
+        const int jEnd = j0 + jb;
+
+        // Bloque diagonal, sin bloques
+        for (int c = j0; c < jEnd; ++c) {
+            T* rowC = a + static_cast<std::size_t>(c) * lda;
+            T d = rowC[c] - dot(c - j0, rowC + j0, rowC + j0);
+            if (!(d > T(0))) {
+                throw std::runtime_error("CholeskyFactorization::CholeskyFactorization - La matriz no es definida positiva");
+            }
+            const T l = std::sqrt(d);
+            rowC[c] = l;
+            for (int r = c + 1; r < jEnd; ++r) {
+                T* rowR = a + static_cast<std::size_t>(r) * lda;
+                rowR[c] = (rowR[c] - dot(c - j0, rowR + j0, rowC + j0)) / l;
+            }
+        }
+
+        if (jEnd == n) {
+            break;
+        }
+
+        // L21 = A21 · L11⁻ᵀ, fila a fila
+        for (int r = jEnd; r < n; ++r) {
+            T* rowR = a + static_cast<std::size_t>(r) * lda;
+            for (int c = j0; c < jEnd; ++c) {
+                const T* rowC = a + static_cast<std::size_t>(c) * lda;
+                rowR[c] = (rowR[c] - dot(c - j0, rowR + j0, rowC + j0)) / rowC[c];
+            }
+        }
+
+        // A22 -= L21 · L21ᵀ: solo las franjas del triángulo inferior; las
+        // filas c0.. de L21 se pasan a GEMM como columnas de L21ᵀ
+        const int m = n - jEnd;
+        for (int c0 = 0; c0 < m; c0 += TRAILING_COLUMNS) {
+            const int w = std::min(TRAILING_COLUMNS, m - c0);
+            const T* l21 = a + static_cast<std::size_t>(jEnd + c0) * lda + j0;
+            subtractProduct(m - c0, w, jb, l21, lda, l21, lda,
+                            a + static_cast<std::size_t>(jEnd + c0) * lda + jEnd + c0, lda,
+                            &temp[0], policy, TRANS);
+        }
+    }
+
+    // El triángulo superior contiene restos de A y de las actualizaciones
+    clearUpperTriangle(n, a, lda);
+}
+
+template <class T>
+T BasicCholeskyFactorization<T>::determinant() const {
+    T det = T(1);
+    for (int i = 0; i < size(); ++i) {
+        det *= factor(i, i) * factor(i, i);
+    }
+    return det;
+}
+
+template <class T>
+BasicMatrix<T> BasicCholeskyFactorization<T>::solve(const BasicMatrix<T>& B) const {
+    BasicMatrix<T> X(B);
+    solve_in_place(X);
+    return X;
+}
+
+template <class T>
+void BasicCholeskyFactorization<T>::solve_in_place(BasicMatrix<T>& B) const {
+    const int n = size();
+    checkRhs(n, B.num_rows(), "CholeskyFactorization::solve - El lado derecho debe tener n filas");
+    const int nrhs = B.num_cols();
+    MATHLIB_PROFILE_SCOPE(PROFILE_SOLVE, n, nrhs, n, 2.0 * n * n * nrhs);
+    std::vector<T> temp(static_cast<std::size_t>(FACTOR_BLOCK) * std::min(nrhs, TRAILING_COLUMNS));
+    lowerSolve(n, nrhs, factor.data(), factor.stride(), false, B.data(), B.stride(), &temp[0], SEQUENTIAL);
+    lowerTransposeSolve(n, nrhs, factor.data(), factor.stride(), B.data(), B.stride());
+}
+
+template <class T>
+void BasicCholeskyFactorization<T>::solve_in_place(Span<T> b) const {
+    const int n = size();
+    checkRhs(n, static_cast<int>(b.size()), "CholeskyFactorization::solve - El vector debe tener n elementos");
+    MATHLIB_PROFILE_SCOPE(PROFILE_SOLVE, n, 1, n, 2.0 * n * n);
+    const T* a = factor.data();
+    const int lda = factor.stride();
+    T* x = b.data();
+    for (int i = 0; i < n; ++i) {
+        const T* rowI = a + static_cast<std::size_t>(i) * lda;
+        x[i] = (x[i] - dot(i, rowI, x)) / rowI[i];
+    }
+    lowerTransposeSolve(n, 1, a, lda, x, 1);
+}
+
+template <class T>
+BasicMatrix<T> BasicCholeskyFactorization<T>::inverse() const {
+    BasicMatrix<T> X = identity<T>(size());
+    solve_in_place(X);
+    return X;
+}
+
+template class BasicLUFactorization<float>;
+template class BasicLUFactorization<double>;
+template class BasicCholeskyFactorization<float>;
+template class BasicCholeskyFactorization<double>;
+
+} // namespace mathlib
@@ -0,0 +1,856 @@
+/**
+ * @file Gemm.cpp
+ * @brief Implementación del motor de multiplicación por bloques
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Contiene el kernel de referencia, el empaquetado de paneles de A y B,
+ * el micro-kernel de registros y la detección de tamaños de caché usada
+ * para elegir los tamaños de bloque en tiempo de ejecución.
+ */
+
+#include "Gemm.h"
+#include "GemmInternal.h"
+#include "Allocator.h"
+#include "BlasBackend.h"
+#include "KernelsInternal.h"
+#include "ThreadPool.h"
+#include "Tuning.h"
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <complex>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+// Los umbrales entre el kernel de referencia, el serie y el paralelo y
+// las teselas por hilo son parámetros calibrables (véase Tuning.h)
+
+/// Columnas de y que se actualizan a la vez en GEMV transpuesto (caben en L1)
+const int GEMV_COLUMN_BLOCK = 1024;
+
+/**
+ * @brief Tamaños de caché de datos L1, L2 y L3 en bytes
+ */
+struct CacheSizes {
+    long l1;
+    long l2;
+    long l3;
+};
+
+/**
+ * @brief Consulta al sistema operativo los tamaños de caché
+ *
+ * @return Tamaños detectados; los niveles desconocidos quedan a 0
+ */
+CacheSizes queryCacheSizes() {
+    CacheSizes sizes = {0, 0, 0};
+#if defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformation(NULL, &length);
+    if (length > 0) {
+        std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(
+            length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+        if (GetLogicalProcessorInformation(&info[0], &length)) {
+            for (std::size_t i = 0; i < info.size(); ++i) {
+                if (info[i].Relationship != RelationCache) continue;
+                const CACHE_DESCRIPTOR& cache = info[i].Cache;
+                if (cache.Type != CacheData && cache.Type != CacheUnified) continue;
+                long bytes = static_cast<long>(cache.Size);
+                if (cache.Level == 1) sizes.l1 = std::max(sizes.l1, bytes);
+                if (cache.Level == 2) sizes.l2 = std::max(sizes.l2, bytes);
+                if (cache.Level == 3) sizes.l3 = std::max(sizes.l3, bytes);
+            }
+        }
+    }
+#else
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+    sizes.l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    sizes.l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    sizes.l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#endif
+    if (sizes.l1 <= 0) sizes.l1 = 32L * 1024;
+    if (sizes.l2 <= 0) sizes.l2 = 256L * 1024;
+    if (sizes.l3 <= 0) sizes.l3 = 2L * 1024 * 1024;
+    return sizes;
+}
+
+/**
+ * @brief Ajusta value a un múltiplo de step dentro de [lo, hi]
+ */
+int clampMultiple(long value, int step, int lo, int hi) {
+    long v = std::max<long>(lo, std::min<long>(hi, value));
+    v = (v / step) * step;
+    return static_cast<int>(std::max<long>(step, v));
+}
+
+/**
+ * @brief Deriva los tamaños de bloque de los tamaños de caché
+ *
+ * Un micro-panel de B (kc x nr) ocupa la mitad de L1, el bloque de A
+ * (mc x kc) la mitad de L2 y el panel de B (kc x nc) la mitad de L3; la
+ * otra mitad de cada nivel queda para C y para el flujo de A. elem es el
+ * tamaño en bytes del tipo de elemento.
+ */
+GemmBlocking computeBlocking(const CacheSizes& caches, int mr, int nr, long elem) {
+
+    GemmBlocking blocking;
+    blocking.mr = mr;
+    blocking.nr = nr;
+    blocking.kc = clampMultiple(caches.l1 / 2 / (nr * elem), 8, 64, 512);
+    blocking.mc = clampMultiple(caches.l2 / 2 / (blocking.kc * elem), mr, mr * 4, 1024);
+    blocking.nc = clampMultiple(caches.l3 / 2 / (blocking.kc * elem), nr, nr * 8, 4096);
+    return blocking;
+}
+
+/// Sustituye los bloques calibrados distintos de 0, redondeados a la tesela
+void applyTunedBlocking(const TuningBlocking& tuned, GemmBlocking& blocking) {
+    if (tuned.kc > 0) blocking.kc = clampMultiple(tuned.kc, 8, 8, 4096);
+    if (tuned.mc > 0) blocking.mc = clampMultiple(tuned.mc, blocking.mr, blocking.mr, 8192);
+    if (tuned.nc > 0) blocking.nc = clampMultiple(tuned.nc, blocking.nr, blocking.nr, 16384);
+}
+
+/// Bloques calibrados para T; int y std::complex<double> usan siempre los derivados
+template <class T>
+TuningBlocking tunedBlocking(const TuningParameters&) {
+    return TuningBlocking();
+}
+
+template <>
+TuningBlocking tunedBlocking<double>(const TuningParameters& params) {
+    return params.blocking_f64;
+}
+
+template <>
+TuningBlocking tunedBlocking<float>(const TuningParameters& params) {
+    return params.blocking_f32;
+}
+
+/**
+ * @brief Posición del elemento (r, c) de op(X) dentro del bloque de X
+ *
+ * Con TRANS el elemento (r, c) de Xᵀ es el (c, r) de X.
+ */
+inline std::size_t opIndex(Transpose trans, int r, int c, int ld) {
+    return trans == TRANS ? static_cast<std::size_t>(c) * ld + r
+                          : static_cast<std::size_t>(r) * ld + c;
+}
+
+/**
+ * @brief Empaqueta un bloque mb x kb de op(A) en micro-paneles de mr filas
+ *
+ * Cada micro-panel se almacena por columnas (mr valores consecutivos por
+ * cada índice p) y las filas sobrantes del último panel se rellenan con
+ * ceros para que el micro-kernel no necesite casos especiales. Con
+ * TRANS los mr valores de cada p son contiguos en A, así que Aᵀ se
+ * empaqueta incluso más rápido que A.
+ */
+template <class T>
+void packA(Transpose trans, int mb, int kb, const T* A, int lda, int mr, T* packed) {
+    for (int i = 0; i < mb; i += mr) {
+        int rowsLeft = std::min(mr, mb - i);
+        for (int p = 0; p < kb; ++p) {
+            if (trans == TRANS) {
+                const T* col = A + static_cast<std::size_t>(p) * lda + i;
+                for (int r = 0; r < rowsLeft; ++r) {
+                    packed[r] = col[r];
+                }
+            } else {
+                for (int r = 0; r < rowsLeft; ++r) {
+                    packed[r] = A[static_cast<std::size_t>(i + r) * lda + p];
+                }
+            }
+            for (int r = rowsLeft; r < mr; ++r) {
+                packed[r] = T();
+            }
+            packed += mr;
+        }
+    }
+}
+
+/**
+ * @brief Empaqueta un bloque kb x nb de op(B) en micro-paneles de nr columnas
+ *
+ * Cada micro-panel se almacena por filas (nr valores consecutivos por
+ * cada índice p) con las columnas sobrantes rellenas con ceros. Con
+ * TRANS se leen nr filas de B a la vez, cada una de forma secuencial.
+ */
+template <class T>
+void packB(Transpose trans, int kb, int nb, const T* B, int ldb, int nr, T* packed) {
+    for (int j = 0; j < nb; j += nr) {
+        int colsLeft = std::min(nr, nb - j);
+        for (int p = 0; p < kb; ++p) {
+            if (trans == TRANS) {
+                const T* col = B + static_cast<std::size_t>(j) * ldb + p;
+                for (int c = 0; c < colsLeft; ++c) {
+                    packed[c] = col[static_cast<std::size_t>(c) * ldb];
+                }
+            } else {
+                const T* row = B + static_cast<std::size_t>(p) * ldb + j;
+                for (int c = 0; c < colsLeft; ++c) {
+                    packed[c] = row[c];
+                }
+            }
+            for (int c = colsLeft; c < nr; ++c) {
+                packed[c] = T();
+            }
+            packed += nr;
+        }
+    }
+}
+
+/**
+ * @brief Calcula una tesela de C, completa o parcial, con el micro-kernel activo
+ *
+ * Las teselas completas se escriben directamente en C. En los bordes
+ * (mr < tesela o nr < tesela) el micro-kernel escribe en un buffer local
+ * y solo se copian a C las posiciones válidas.
+ */
+template <class T>
+void computeTile(const KernelTableT<T>& kt, int kb, const T* a, const T* b,
+                 T* C, int ldc, int mr, int nr, bool accumulate) {
+    if (mr == kt.mr && nr == kt.nr) {
+        kt.micro(kb, a, b, C, ldc, accumulate);
+        return;
+    }
+
+    T tile[GEMM_MR_MAX * GEMM_NR_MAX];
+    kt.micro(kb, a, b, tile, kt.nr, false);
+    for (int r = 0; r < mr; ++r) {
+        T* out = C + static_cast<std::size_t>(r) * ldc;
+        const T* in = tile + r * kt.nr;
+        if (accumulate) {
+            for (int c = 0; c < nr; ++c) out[c] += in[c];
+        } else {
+            for (int c = 0; c < nr; ++c) out[c] = in[c];
+        }
+    }
+}
+
+/**
+ * @brief Tamaños de caché del equipo, consultados una sola vez
+ */
+const CacheSizes& cacheSizes() {
+    static const CacheSizes sizes = queryCacheSizes();
+    return sizes;
+}
+
+/// y = beta · y sobre n elementos, sin leer y si beta == 0
+template <class T>
+void scaleVector(const KernelTableT<T>& kt, int n, T beta, T* y) {
+    if (beta == T()) {
+        std::fill(y, y + n, T());
+    } else if (beta != T(1)) {
+        kt.scale(static_cast<std::size_t>(n), beta, y, y);
+    }
+}
+
+/**
+ * @brief Elementos [j0, j1) de y = alpha · Aᵀ · x + beta · y, con A de m filas
+ *
+ * Recorre las filas de A restringidas a un bloque de columnas cada vez,
+ * para que ese tramo de y permanezca en L1 mientras se acumula.
+ */
+template <class T>
+void gemvTransposed(const KernelTableT<T>& kt, int m, int j0, int j1, T alpha,
+                    const T* A, int lda, const T* x, T beta, T* y) {
+    scaleVector(kt, j1 - j0, beta, y + j0);
+    for (int jb = j0; jb < j1; jb += GEMV_COLUMN_BLOCK) {
+        const std::size_t width = static_cast<std::size_t>(std::min(GEMV_COLUMN_BLOCK, j1 - jb));
+        for (int i = 0; i < m; ++i) {
+            kt.axpy(width, alpha * x[i], A + static_cast<std::size_t>(i) * lda + jb, y + jb);
+        }
+    }
+}
+
+/// y = alpha · op(A) · x + beta · y en serie o repartido en pool
+template <class T>
+void runGemv(const TuningParameters& params, Transpose trans, int m, int n, T alpha, const T* A, int lda,
+             const T* x, T beta, T* y, ThreadPool* pool) {
+    if (pool != nullptr) {
+        gemv_parallel(params, trans, m, n, alpha, A, lda, x, beta, y, *pool);
+    } else {
+        gemv(trans, m, n, alpha, A, lda, x, beta, y);
+    }
+}
+
+/**
+ * @brief Calcula con GEMV los productos en que op(B) es una columna u op(A) una fila
+ *
+ * El empaquetado de GEMM rellena la columna (o la fila) hasta la tesela
+ * del micro-kernel y desperdicia casi todo el cálculo; GEMV lee A una vez.
+ * Los vectores con separación distinta de 1 se copian a un búfer contiguo.
+ *
+ * @return false si el producto no tiene esa forma
+ */
+template <class T>
+bool gemmAsGemv(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k, T alpha,
+                const T* A, int lda, const T* B, int ldb, T beta, T* C, int ldc, ThreadPool* pool) {
+    if (n != 1 && m != 1) {
+        return false;
+    }
+    std::vector<T> xCopy;
+    if (n == 1) {
+        // x es la columna de op(B): contigua si B es 1 x k (TRANS) o si ldb es 1
+        const T* x = B;
+        if (transB == NO_TRANS && ldb != 1 && k > 1) {
+            xCopy.resize(k);
+            for (int p = 0; p < k; ++p) xCopy[p] = B[static_cast<std::size_t>(p) * ldb];
+            x = &xCopy[0];
+        }
+        std::vector<T> yCopy;
+        T* y = C;
+        if (ldc != 1 && m > 1) {
+            yCopy.resize(m);
+            y = &yCopy[0];
+            if (beta != T()) {
+                for (int i = 0; i < m; ++i) y[i] = C[static_cast<std::size_t>(i) * ldc];
+            }
+        }
+        if (transA == NO_TRANS) {
+            runGemv(params, NO_TRANS, m, k, alpha, A, lda, x, beta, y, pool);
+        } else {
+            runGemv(params, TRANS, k, m, alpha, A, lda, x, beta, y, pool);
+        }
+        if (y != C) {
+            for (int i = 0; i < m; ++i) C[static_cast<std::size_t>(i) * ldc] = y[i];
+        }
+        return true;
+    }
+
+    // La fila de C es op(B)ᵀ por la fila de op(A)
+    const T* x = A;
+    if (transA == TRANS && lda != 1 && k > 1) {
+        xCopy.resize(k);
+        for (int p = 0; p < k; ++p) xCopy[p] = A[static_cast<std::size_t>(p) * lda];
+        x = &xCopy[0];
+    }
+    if (transB == NO_TRANS) {
+        runGemv(params, TRANS, k, n, alpha, B, ldb, x, beta, C, pool);
+    } else {
+        runGemv(params, NO_TRANS, n, k, alpha, B, ldb, x, beta, C, pool);
+    }
+    return true;
+}
+
+/// max(v, 0)
+template <class T>
+T relu(T v) {
+    return v < T() ? T() : v;
+}
+
+/// Nunca se aplica: checkEpilogue() rechaza ReLU con complejos
+std::complex<double> relu(const std::complex<double>& v) {
+    return v;
+}
+
+template <class T>
+void checkEpilogue(const GemmEpilogue<T>&) {}
+
+void checkEpilogue(const GemmEpilogue<std::complex<double> >& epilogue) {
+    if (epilogue.activation == ACTIVATION_RELU) {
+        throw std::invalid_argument("mathlib::gemm - ACTIVATION_RELU no está definida para complejos");
+    }
+}
+
+template <class T>
+bool hasEpilogue(const GemmEpilogue<T>& epilogue) {
+    return epilogue.bias != nullptr || epilogue.activation != ACTIVATION_NONE;
+}
+
+/**
+ * @brief Aplica el epílogo a un bloque mb x nb de C
+ *
+ * @param bias Sesgo de la primera columna del bloque, o nullptr
+ */
+template <class T>
+void applyEpilogue(Activation activation, const T* bias, T* C, int ldc, int mb, int nb) {
+    for (int r = 0; r < mb; ++r) {
+        T* row = C + static_cast<std::size_t>(r) * ldc;
+        if (bias != nullptr) {
+            for (int c = 0; c < nb; ++c) row[c] += bias[c];
+        }
+        if (activation == ACTIVATION_RELU) {
+            for (int c = 0; c < nb; ++c) row[c] = relu(row[c]);
+        }
+    }
+}
+
+template <class T>
+void applyEpilogue(const GemmEpilogue<T>& epilogue, T* C, int ldc, int mb, int nb) {
+    if (hasEpilogue(epilogue)) {
+        applyEpilogue(epilogue.activation, epilogue.bias, C, ldc, mb, nb);
+    }
+}
+
+/// C = alpha · op(A) × op(B) + beta · C con el triple bucle, sin leer C si beta == 0
+template <class T>
+void gemmReferenceScaled(Transpose transA, Transpose transB, int m, int n, int k, T alpha,
+                         const T* A, int lda, const T* B, int ldb, T beta, T* C, int ldc) {
+    for (int i = 0; i < m; ++i) {
+        T* row = C + static_cast<std::size_t>(i) * ldc;
+        for (int j = 0; j < n; ++j) {
+            T sum = T();
+            for (int p = 0; p < k; ++p) {
+                sum += A[opIndex(transA, i, p, lda)] * B[opIndex(transB, p, j, ldb)];
+            }
+            row[j] = beta == T() ? alpha * sum : alpha * sum + beta * row[j];
+        }
+    }
+}
+
+/**
+ * @brief Buffer de empaquetado de un hilo, reutilizado entre productos
+ *
+ * Alineado a MATRIX_ALIGNMENT y sin inicializar; solo crece, así que tras
+ * el primer producto de cada forma el empaquetado no reserva memoria. Un
+ * hilo nunca empaqueta dos productos a la vez: las teselas de
+ * gemm_parallel() y las hojas de Strassen se calculan una tras otra en
+ * cada hilo.
+ */
+class PackBuffer {
+public:
+    PackBuffer() : block(NULL), capacity(0) {}
+    ~PackBuffer() { aligned_free(block); }
+
+    /// Espacio para count elementos de T; el contenido anterior se pierde
+    template <class T>
+    T* get(std::size_t count) {
+        const std::size_t bytes = count * sizeof(T);
+        if (bytes > capacity) {
+            aligned_free(block);
+            block = NULL;
+            capacity = 0;
+            block = aligned_allocate(bytes);
+            capacity = bytes;
+        }
+        return static_cast<T*>(block);
+    }
+
+private:
+    PackBuffer(const PackBuffer&);
+    PackBuffer& operator=(const PackBuffer&);
+
+    void* block;           ///< Bloque alineado, o NULL
+    std::size_t capacity;  ///< Bytes del bloque
+};
+
+/// Buffers de los paneles empaquetados de A y de B del hilo actual
+PackBuffer& packBufferA() {
+    static thread_local PackBuffer buffer;
+    return buffer;
+}
+
+PackBuffer& packBufferB() {
+    static thread_local PackBuffer buffer;
+    return buffer;
+}
+
+/**
+ * @brief Núcleo del producto por bloques con escalas y epílogo fusionados
+ *
+ * alpha se aplica al bloque de A ya empaquetado (mb·kb elementos, frente
+ * a mb·nb·kb operaciones). Cada tesela de C se escala por beta justo
+ * antes de recibir su primer bloque de la dimensión compartida y pasa por
+ * el epílogo justo después del último, mientras sigue en L1.
+ */
+template <class T>
+void gemmBlockedFused(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k, T alpha,
+                      const T* A, int lda, const T* B, int ldb, T beta, T* C, int ldc,
+                      const GemmEpilogue<T>& epilogue) {
+    const KernelTableT<T>& kt = active_kernels<T>();
+    const GemmBlocking blk = gemm_blocking<T>(params);
+    const int MR = kt.mr;
+    const int NR = kt.nr;
+    const bool scaleC = beta != T() && beta != T(1);
+    const bool finish = hasEpilogue(epilogue);
+
+    // Buffers de empaquetado con capacidad para el bloque más grande
+    int mcMax = std::min(blk.mc, (m + MR - 1) / MR * MR);
+    int ncMax = std::min(blk.nc, (n + NR - 1) / NR * NR);
+    int kcMax = std::min(blk.kc, k);
+    T* packedA = packBufferA().get<T>(static_cast<std::size_t>(mcMax) * kcMax);
+    T* packedB = packBufferB().get<T>(static_cast<std::size_t>(kcMax) * ncMax);
+
+    for (int jc = 0; jc < n; jc += blk.nc) {
+        int nb = std::min(blk.nc, n - jc);
+        for (int pc = 0; pc < k; pc += blk.kc) {
+            int kb = std::min(blk.kc, k - pc);
+            bool first = pc == 0;
+            bool last = pc + kb == k;
+            bool accumulate = !first || beta != T();
+            packB(transB, kb, nb, B + opIndex(transB, pc, jc, ldb), ldb, NR, packedB);
+
+            for (int ic = 0; ic < m; ic += blk.mc) {
+                int mb = std::min(blk.mc, m - ic);
+                packA(transA, mb, kb, A + opIndex(transA, ic, pc, lda), lda, MR, packedA);
+                if (alpha != T(1)) {
+                    std::size_t packedCount = static_cast<std::size_t>((mb + MR - 1) / MR * MR) * kb;
+                    kt.scale(packedCount, alpha, packedA, packedA);
+                }
+
+                for (int jr = 0; jr < nb; jr += NR) {
+                    int nr = std::min(NR, nb - jr);
+                    const T* bPanel = packedB + static_cast<std::size_t>(jr) * kb;
+                    for (int ir = 0; ir < mb; ir += MR) {
+                        int mr = std::min(MR, mb - ir);
+                        const T* aPanel = packedA + static_cast<std::size_t>(ir) * kb;
+                        T* cTile = C + static_cast<std::size_t>(ic + ir) * ldc + jc + jr;
+                        if (first && scaleC) {
+                            for (int r = 0; r < mr; ++r) {
+                                kt.scale(static_cast<std::size_t>(nr), beta, cTile + static_cast<std::size_t>(r) * ldc,
+                                         cTile + static_cast<std::size_t>(r) * ldc);
+                            }
+                        }
+                        computeTile(kt, kb, aPanel, bPanel, cTile, ldc, mr, nr, accumulate);
+                        if (last && finish) {
+                            applyEpilogue(epilogue.activation, epilogue.bias == nullptr ? nullptr : epilogue.bias + jc + jr,
+                                          cTile, ldc, mr, nr);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+template <class T>
+GemmBlocking gemm_blocking() {
+    return gemm_blocking<T>(tuning());
+}
+
+template <class T>
+GemmBlocking gemm_blocking(const TuningParameters& params) {
+    const KernelTableT<T>& kt = active_kernels<T>();
+    GemmBlocking blocking = computeBlocking(cacheSizes(), kt.mr, kt.nr, static_cast<long>(sizeof(T)));
+    applyTunedBlocking(tunedBlocking<T>(params), blocking);
+    return blocking;
+}
+
+template <class T>
+void gemm_reference(Transpose transA, Transpose transB, int m, int n, int k,
+                    const T* A, int lda,
+                    const T* B, int ldb,
+                    T* C, int ldc) {
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            T sum = T();
+            for (int p = 0; p < k; ++p) {
+                sum += A[opIndex(transA, i, p, lda)] * B[opIndex(transB, p, j, ldb)];
+            }
+            C[static_cast<std::size_t>(i) * ldc + j] = sum;
+        }
+    }
+}
+
+template <class T>
+void gemm_reference(int m, int n, int k,
+                    const T* A, int lda,
+                    const T* B, int ldb,
+                    T* C, int ldc) {
+    for (int i = 0; i < m; ++i) {
+        const T* a = A + static_cast<std::size_t>(i) * lda;
+        for (int j = 0; j < n; ++j) {
+            T sum = T();
+            for (int p = 0; p < k; ++p) {
+                sum += a[p] * B[static_cast<std::size_t>(p) * ldb + j];
+            }
+            C[static_cast<std::size_t>(i) * ldc + j] = sum;
+        }
+    }
+}
+
+template <class T>
+void gemm_blocked(Transpose transA, Transpose transB, int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc) {
+    gemmBlockedFused(tuning(), transA, transB, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc, GemmEpilogue<T>());
+}
+
+template <class T>
+void gemm_blocked(const TuningParameters& params, int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc) {
+    gemmBlockedFused(params, NO_TRANS, NO_TRANS, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc, GemmEpilogue<T>());
+}
+
+template <class T>
+void gemm_blocked(int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc) {
+    gemm_blocked(NO_TRANS, NO_TRANS, m, n, k, A, lda, B, ldb, C, ldc);
+}
+
+template <class T>
+void gemm(Transpose transA, Transpose transB, int m, int n, int k,
+          const T* A, int lda,
+          const T* B, int ldb,
+          T* C, int ldc) {
+    gemm(transA, transB, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc);
+}
+
+template <class T>
+void gemm(int m, int n, int k,
+          const T* A, int lda,
+          const T* B, int ldb,
+          T* C, int ldc) {
+    gemm(NO_TRANS, NO_TRANS, m, n, k, A, lda, B, ldb, C, ldc);
+}
+
+template <class T>
+void gemm(Transpose transA, Transpose transB, int m, int n, int k,
+          T alpha, const T* A, int lda,
+          const T* B, int ldb,
+          T beta, T* C, int ldc,
+          const GemmEpilogue<T>& epilogue) {
+    gemm(tuning(), transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, epilogue);
+}
+
+template <class T>
+void gemm(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k,
+          T alpha, const T* A, int lda,
+          const T* B, int ldb,
+          T beta, T* C, int ldc,
+          const GemmEpilogue<T>& epilogue) {
+    checkEpilogue(epilogue);
+    if (blas_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc)) {
+        applyEpilogue(epilogue, C, ldc, m, n);
+        return;
+    }
+    if (gemmAsGemv(params, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc,
+                   static_cast<ThreadPool*>(nullptr))) {
+        applyEpilogue(epilogue, C, ldc, m, n);
+        return;
+    }
+    double volume = static_cast<double>(m) * n * k;
+    if (volume < params.small_gemm_volume) {
+        if (alpha != T(1) || beta != T()) {
+            gemmReferenceScaled(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        } else if (transA == NO_TRANS && transB == NO_TRANS) {
+            gemm_reference(m, n, k, A, lda, B, ldb, C, ldc);
+        } else {
+            gemm_reference(transA, transB, m, n, k, A, lda, B, ldb, C, ldc);
+        }
+        applyEpilogue(epilogue, C, ldc, m, n);
+    } else {
+        gemmBlockedFused(params, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, epilogue);
+    }
+}
+
+template <class T>
+void gemm_parallel(Transpose transA, Transpose transB, int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   ThreadPool& pool) {
+    gemm_parallel(transA, transB, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc, pool);
+}
+
+template <class T>
+void gemm_parallel(int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   ThreadPool& pool) {
+    gemm_parallel(NO_TRANS, NO_TRANS, m, n, k, A, lda, B, ldb, C, ldc, pool);
+}
+
+template <class T>
+void gemm_parallel(Transpose transA, Transpose transB, int m, int n, int k,
+                   T alpha, const T* A, int lda,
+                   const T* B, int ldb,
+                   T beta, T* C, int ldc,
+                   ThreadPool& pool,
+                   const GemmEpilogue<T>& epilogue) {
+    gemm_parallel(tuning(), transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, pool, epilogue);
+}
+
+template <class T>
+void gemm_parallel(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k,
+                   T alpha, const T* A, int lda,
+                   const T* B, int ldb,
+                   T beta, T* C, int ldc,
+                   ThreadPool& pool,
+                   const GemmEpilogue<T>& epilogue) {
+    checkEpilogue(epilogue);
+    if (blas_gemm(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc)) {
+        applyEpilogue(epilogue, C, ldc, m, n);
+        return;
+    }
+    if (gemmAsGemv(params, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, &pool)) {
+        applyEpilogue(epilogue, C, ldc, m, n);
+        return;
+    }
+    double volume = static_cast<double>(m) * n * k;
+    if (pool.size() <= 1 || volume < params.parallel_gemm_volume) {
+        gemm(params, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, epilogue);
+        return;
+    }
+    // Partir de bloques mc x nc y dividir a la mitad la dimensión mayor
+    // hasta tener suficientes teselas para todos los hilos
+    const GemmBlocking blk = gemm_blocking<T>(params);
+    int tileM = std::min(blk.mc, (m + blk.mr - 1) / blk.mr * blk.mr);
+    int tileN = std::min(blk.nc, (n + blk.nr - 1) / blk.nr * blk.nr);
+    const int target = pool.size() * params.tiles_per_thread;
+    for (;;) {
+        int tiles = ((m + tileM - 1) / tileM) * ((n + tileN - 1) / tileN);
+        if (tiles >= target) break;
+        bool splitN = tileN / blk.nr >= tileM / blk.mr;
+        if (splitN && tileN >= 2 * blk.nr * 4) {
+            tileN = (tileN / 2 + blk.nr - 1) / blk.nr * blk.nr;
+        } else if (tileM >= 2 * blk.mr * 4) {
+            tileM = (tileM / 2 + blk.mr - 1) / blk.mr * blk.mr;
+        } else if (tileN >= 2 * blk.nr * 4) {
+            tileN = (tileN / 2 + blk.nr - 1) / blk.nr * blk.nr;
+        } else {
+            break;
+        }
+    }
+
+    const int tilesM = (m + tileM - 1) / tileM;
+    const int tilesN = (n + tileN - 1) / tileN;
+    pool.parallel_for(tilesM * tilesN, [=, &params](int t) {
+        int i0 = (t / tilesN) * tileM;
+        int j0 = (t % tilesN) * tileN;
+        int mb = std::min(tileM, m - i0);
+        int nb = std::min(tileN, n - j0);
+        GemmEpilogue<T> tileEpilogue(epilogue);
+        if (epilogue.bias != nullptr) {
+            tileEpilogue.bias = epilogue.bias + j0;
+        }
+        gemmBlockedFused(params, transA, transB, mb, nb, k, alpha,
+                         A + opIndex(transA, i0, 0, lda), lda,
+                         B + opIndex(transB, 0, j0, ldb), ldb,
+                         beta, C + static_cast<std::size_t>(i0) * ldc + j0, ldc, tileEpilogue);
+    });
+}
+
+template <class T>
+void gemv(Transpose trans, int m, int n, T alpha,
+          const T* A, int lda,
+          const T* x, T beta, T* y) {
+    if (blas_gemv(trans, m, n, alpha, A, lda, x, beta, y)) {
+        return;
+    }
+    const KernelTableT<T>& kt = active_kernels<T>();
+    if (trans == NO_TRANS) {
+        kt.gemv(m, n, alpha, A, lda, x, beta, y);
+    } else {
+        gemvTransposed(kt, m, 0, n, alpha, A, lda, x, beta, y);
+    }
+}
+
+template <class T>
+void gemv_parallel(Transpose trans, int m, int n, T alpha,
+                   const T* A, int lda,
+                   const T* x, T beta, T* y,
+                   ThreadPool& pool) {
+    gemv_parallel(tuning(), trans, m, n, alpha, A, lda, x, beta, y, pool);
+}
+
+template <class T>
+void gemv_parallel(const TuningParameters& params, Transpose trans, int m, int n, T alpha,
+                   const T* A, int lda,
+                   const T* x, T beta, T* y,
+                   ThreadPool& pool) {
+    if (blas_gemv(trans, m, n, alpha, A, lda, x, beta, y)) {
+        return;
+    }
+    const double elements = static_cast<double>(m) * n;
+    if (pool.size() <= 1 || elements < params.parallel_gemv_elements) {
+        gemv(trans, m, n, alpha, A, lda, x, beta, y);
+        return;
+    }
+
+    // Bloques de filas (NO_TRANS) o de columnas (TRANS) de y, alineados a
+    // las cuatro filas del kernel o a 16 elementos para no compartir líneas de caché
+    const KernelTableT<T>& kt = active_kernels<T>();
+    const int outer = trans == NO_TRANS ? m : n;
+    const int align = trans == NO_TRANS ? 4 : 16;
+    const double minChunk = std::max(1.0, params.parallel_gemv_elements / 4);
+    int chunks = static_cast<int>(std::min<double>(pool.size() * params.tiles_per_thread,
+                                                   elements / minChunk));
+    chunks = std::max(1, std::min(chunks, outer / align));
+    pool.parallel_for(chunks, [&](int t) {
+        int first = static_cast<int>(static_cast<long long>(outer) * t / chunks) / align * align;
+        int last = t + 1 == chunks ? outer
+                                   : static_cast<int>(static_cast<long long>(outer) * (t + 1) / chunks) / align * align;
+        if (first >= last) {
+            return;
+        }
+        if (trans == NO_TRANS) {
+            kt.gemv(last - first, n, alpha, A + static_cast<std::size_t>(first) * lda, lda, x, beta, y + first);
+        } else {
+            gemvTransposed(kt, m, first, last, alpha, A, lda, x, beta, y);
+        }
+    });
+}
+
+#define MATHLIB_INSTANTIATE_GEMM(T)                                                \
+    template GemmBlocking gemm_blocking<T>();                                      \
+    template void gemm_reference<T>(int, int, int, const T*, int,                  \
+                                    const T*, int, T*, int);                       \
+    template void gemm_blocked<T>(int, int, int, const T*, int,                    \
+                                  const T*, int, T*, int);                         \
+    template void gemm<T>(int, int, int, const T*, int, const T*, int, T*, int);   \
+    template void gemm_parallel<T>(int, int, int, const T*, int,                   \
+                                   const T*, int, T*, int, ThreadPool&);           \
+    template void gemm_reference<T>(Transpose, Transpose, int, int, int,           \
+                                    const T*, int, const T*, int, T*, int);        \
+    template void gemm_blocked<T>(Transpose, Transpose, int, int, int,             \
+                                  const T*, int, const T*, int, T*, int);          \
+    template void gemm<T>(Transpose, Transpose, int, int, int,                     \
+                          const T*, int, const T*, int, T*, int);                  \
+    template void gemm_parallel<T>(Transpose, Transpose, int, int, int,            \
+                                   const T*, int, const T*, int, T*, int,          \
+                                   ThreadPool&);                                   \
+    template void gemm<T>(Transpose, Transpose, int, int, int, T, const T*, int,   \
+                          const T*, int, T, T*, int, const GemmEpilogue<T>&);      \
+    template void gemm_parallel<T>(Transpose, Transpose, int, int, int, T,         \
+                                   const T*, int, const T*, int, T, T*, int,       \
+                                   ThreadPool&, const GemmEpilogue<T>&);           \
+    template void gemv<T>(Transpose, int, int, T, const T*, int,                   \
+                          const T*, T, T*);                                        \
+    template void gemv_parallel<T>(Transpose, int, int, T, const T*, int,          \
+                                   const T*, T, T*, ThreadPool&);                  \
+    template GemmBlocking gemm_blocking<T>(const TuningParameters&);               \
+    template void gemm_blocked<T>(const TuningParameters&, int, int, int,          \
+                                  const T*, int, const T*, int, T*, int);          \
+    template void gemm<T>(const TuningParameters&, Transpose, Transpose,           \
+                          int, int, int, T, const T*, int, const T*, int,          \
+                          T, T*, int, const GemmEpilogue<T>&);                     \
+    template void gemm_parallel<T>(const TuningParameters&, Transpose, Transpose,  \
+                                   int, int, int, T, const T*, int, const T*, int, \
+                                   T, T*, int, ThreadPool&,                        \
+                                   const GemmEpilogue<T>&);                        \
+    template void gemv_parallel<T>(const TuningParameters&, Transpose, int, int,   \
+                                   T, const T*, int, const T*, T, T*, ThreadPool&);
+
+MATHLIB_INSTANTIATE_GEMM(float)
+MATHLIB_INSTANTIATE_GEMM(double)
+MATHLIB_INSTANTIATE_GEMM(int)
+MATHLIB_INSTANTIATE_GEMM(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_GEMM
+
+} // namespace mathlib
@@ -0,0 +1,70 @@
+/**
+ * @file GemmInternal.h
+ * @brief GEMM y GEMV con parámetros de despacho explícitos (uso interno)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Las funciones públicas de Gemm.h y gemm_strassen() leen tuning(); estas
+ * sobrecargas reciben los parámetros como primer argumento y no consultan
+ * el estado global, ni siquiera desde los hilos del grupo. La calibración
+ * (Tuning.cpp) las usa para medir cada candidato sin tocar los parámetros
+ * activos ni el grupo global mientras otros hilos multiplican.
+ */
+
+#ifndef GEMM_INTERNAL_H
+#define GEMM_INTERNAL_H
+
+#include "Gemm.h"
+#include "Tuning.h"
+
+namespace mathlib {
+
+class ThreadPool;
+
+/// Bloques de GEMM de T con los tamaños calibrados de params
+template <class T>
+GemmBlocking gemm_blocking(const TuningParameters& params);
+
+/// gemm_blocked() con los bloques de params
+template <class T>
+void gemm_blocked(const TuningParameters& params, int m, int n, int k,
+                  const T* A, int lda,
+                  const T* B, int ldb,
+                  T* C, int ldc);
+
+/// C = alpha · op(A) × op(B) + beta · C en serie con los umbrales de params
+template <class T>
+void gemm(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k,
+          T alpha, const T* A, int lda,
+          const T* B, int ldb,
+          T beta, T* C, int ldc,
+          const GemmEpilogue<T>& epilogue = GemmEpilogue<T>());
+
+/// gemm() repartido en pool con los umbrales y las teselas por hilo de params
+template <class T>
+void gemm_parallel(const TuningParameters& params, Transpose transA, Transpose transB, int m, int n, int k,
+                   T alpha, const T* A, int lda,
+                   const T* B, int ldb,
+                   T beta, T* C, int ldc,
+                   ThreadPool& pool,
+                   const GemmEpilogue<T>& epilogue = GemmEpilogue<T>());
+
+/// y = alpha · op(A) · x + beta · y repartido en pool con los umbrales de params
+template <class T>
+void gemv_parallel(const TuningParameters& params, Transpose trans, int m, int n, T alpha,
+                   const T* A, int lda,
+                   const T* x, T beta, T* y,
+                   ThreadPool& pool);
+
+/// gemm_strassen() en serie, con las hojas calculadas por gemm(params, ...)
+template <class T>
+void gemm_strassen(const TuningParameters& params, int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   int crossover, T* workspace);
+
+} // namespace mathlib
+
+#endif
@@ -0,0 +1,398 @@
+/**
+ * @file Kernels.cpp
+ * @brief Detección de CPU, despacho de kernels y variante escalar
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * La detección se ejecuta una sola vez, la primera vez que se solicita una
+ * tabla activa; el mismo nivel se aplica a las tablas float y double. A
+ * partir de ahí cada operación solo paga una lectura atómica del puntero
+ * a la tabla y una llamada indirecta.
+ */
+
+#include "KernelsInternal.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(MATHLIB_ARCH_X86)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Variante escalar (genérica para cualquier tipo de elemento)
+// ---------------------------------------------------------------------------
+
+template <class T>
+void scalarAdd(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] + b[i];
+}
+
+template <class T>
+void scalarSub(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] - b[i];
+}
+
+template <class T>
+void scalarMul(std::size_t n, const T* a, const T* b, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] * b[i];
+}
+
+template <class T>
+void scalarScale(std::size_t n, T alpha, const T* a, T* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = alpha * a[i];
+}
+
+template <class T>
+void scalarAxpy(std::size_t n, T alpha, const T* x, T* y) {
+    for (std::size_t i = 0; i < n; ++i) y[i] += alpha * x[i];
+}
+
+/// Dimensiones de tesela del micro-kernel escalar
+const int SCALAR_MR = 4;
+const int SCALAR_NR = 8;
+
+template <class T>
+void scalarMicro(int kb, const T* a, const T* b,
+                 T* C, int ldc, bool accumulate) {
+    T acc[SCALAR_MR][SCALAR_NR];
+    for (int r = 0; r < SCALAR_MR; ++r) {
+        for (int c = 0; c < SCALAR_NR; ++c) {
+            acc[r][c] = T();
+        }
+    }
+
+    for (int p = 0; p < kb; ++p) {
+        for (int r = 0; r < SCALAR_MR; ++r) {
+            T av = a[r];
+            for (int c = 0; c < SCALAR_NR; ++c) {
+                acc[r][c] += av * b[c];
+            }
+        }
+        a += SCALAR_MR;
+        b += SCALAR_NR;
+    }
+
+    for (int r = 0; r < SCALAR_MR; ++r) {
+        T* out = C + static_cast<std::size_t>(r) * ldc;
+        if (accumulate) {
+            for (int c = 0; c < SCALAR_NR; ++c) out[c] += acc[r][c];
+        } else {
+            for (int c = 0; c < SCALAR_NR; ++c) out[c] = acc[r][c];
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Detección de capacidades
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Comprueba si la CPU y el sistema operativo admiten un nivel
+ *
+ * En x86 se exige además el soporte del sistema operativo para guardar
+ * los registros extendidos (XSAVE/XCR0), que __builtin_cpu_supports ya
+ * verifica en GCC y Clang.
+ */
+bool cpuSupports(SimdLevel level) {
+    switch (level) {
+    case SIMD_SCALAR:
+        return true;
+#if defined(MATHLIB_ARCH_X86)
+#if defined(__GNUC__) || defined(__clang__)
+    case SIMD_SSE2:
+        return __builtin_cpu_supports("sse2");
+    case SIMD_AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#elif defined(_MSC_VER)
+    case SIMD_SSE2:
+    case SIMD_AVX2:
+    case SIMD_AVX512: {
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        if (level == SIMD_SSE2) return sse2;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        if (!osxsave || maxLeaf < 7) return false;
+        unsigned long long xcr0 = _xgetbv(0);
+        __cpuidex(info, 7, 0);
+        if (level == SIMD_AVX2) {
+            return (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0 && fma;
+        }
+        return (xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)) != 0;
+    }
+#endif
+#endif
+#if defined(MATHLIB_ARCH_ARM64)
+    case SIMD_NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Devuelve la tabla double compilada para un nivel, o NULL si no existe
+ */
+const KernelTableT<double>* tableFor64(SimdLevel level) {
+    switch (level) {
+    case SIMD_SCALAR:
+        return &scalar_kernels<double>();
+#if defined(MATHLIB_ARCH_X86)
+    case SIMD_SSE2:
+        return &sse2_kernels_f64();
+    case SIMD_AVX2:
+        return &avx2_kernels_f64();
+    case SIMD_AVX512:
+        return &avx512_kernels_f64();
+#endif
+#if defined(MATHLIB_ARCH_ARM64)
+    case SIMD_NEON:
+        return &neon_kernels_f64();
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Devuelve la tabla float compilada para un nivel, o NULL si no existe
+ */
+const KernelTableT<float>* tableFor32(SimdLevel level) {
+    switch (level) {
+    case SIMD_SCALAR:
+        return &scalar_kernels<float>();
+#if defined(MATHLIB_ARCH_X86)
+    case SIMD_SSE2:
+        return &sse2_kernels_f32();
+    case SIMD_AVX2:
+        return &avx2_kernels_f32();
+    case SIMD_AVX512:
+        return &avx512_kernels_f32();
+#endif
+#if defined(MATHLIB_ARCH_ARM64)
+    case SIMD_NEON:
+        return &neon_kernels_f32();
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Interpreta el valor de MATHLIB_SIMD
+ *
+ * @param value Texto de la variable de entorno
+ * @param level Nivel resultante si el texto es válido
+ * @return true si el texto corresponde a un nivel conocido
+ */
+bool parseLevel(const char* value, SimdLevel& level) {
+    static const SimdLevel all[] = { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512, SIMD_NEON };
+    for (std::size_t i = 0; i < sizeof(all) / sizeof(all[0]); ++i) {
+        if (std::strcmp(value, simd_level_name(all[i])) == 0) {
+            level = all[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Elige el mejor nivel admitido, respetando MATHLIB_SIMD si existe
+ */
+SimdLevel selectLevel() {
+    const char* requested = std::getenv("MATHLIB_SIMD");
+    SimdLevel forced;
+    if (requested != NULL && parseLevel(requested, forced) && simd_supported(forced)) {
+        return forced;
+    }
+
+    static const SimdLevel preference[] = { SIMD_AVX512, SIMD_AVX2, SIMD_NEON, SIMD_SSE2 };
+    for (std::size_t i = 0; i < sizeof(preference) / sizeof(preference[0]); ++i) {
+        if (simd_supported(preference[i])) {
+            return preference[i];
+        }
+    }
+    return SIMD_SCALAR;
+}
+
+/**
+ * @brief Punteros atómicos a las tablas activas, inicializados una sola vez
+ */
+struct ActiveTables {
+    std::atomic<const KernelTableT<double>*> f64;
+    std::atomic<const KernelTableT<float>*> f32;
+
+    explicit ActiveTables(SimdLevel level)
+        : f64(tableFor64(level)), f32(tableFor32(level)) {}
+};
+
+ActiveTables& activeSlot() {
+    static ActiveTables slot(selectLevel());
+    return slot;
+}
+
+/// Kernel por lotes escalar: un único carril, es decir, un producto directo
+template <class T>
+void scalarBatch(int m, int n, int k, const T* a, const T* b, T* c) {
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            T acc = T();
+            for (int p = 0; p < k; ++p) {
+                acc += a[static_cast<std::size_t>(i) * k + p] * b[static_cast<std::size_t>(p) * n + j];
+            }
+            c[static_cast<std::size_t>(i) * n + j] = acc;
+        }
+    }
+}
+
+/// GEMV escalar: cuatro filas a la vez para reutilizar cada carga de x
+template <class T>
+void scalarGemv(int m, int n, T alpha, const T* a, int lda, const T* x, T beta, T* y) {
+    int i = 0;
+    for (; i + 4 <= m; i += 4) {
+        const T* a0 = a + static_cast<std::size_t>(i) * lda;
+        const T* a1 = a0 + lda;
+        const T* a2 = a1 + lda;
+        const T* a3 = a2 + lda;
+        T s0 = T(), s1 = T(), s2 = T(), s3 = T();
+        for (int j = 0; j < n; ++j) {
+            s0 += a0[j] * x[j];
+            s1 += a1[j] * x[j];
+            s2 += a2[j] * x[j];
+            s3 += a3[j] * x[j];
+        }
+        gemv_store(y + i, s0, alpha, beta);
+        gemv_store(y + i + 1, s1, alpha, beta);
+        gemv_store(y + i + 2, s2, alpha, beta);
+        gemv_store(y + i + 3, s3, alpha, beta);
+    }
+    for (; i < m; ++i) {
+        const T* ai = a + static_cast<std::size_t>(i) * lda;
+        T s = T();
+        for (int j = 0; j < n; ++j) {
+            s += ai[j] * x[j];
+        }
+        gemv_store(y + i, s, alpha, beta);
+    }
+}
+
+} // namespace
+
+template <class T>
+const KernelTableT<T>& scalar_kernels() {
+    static const KernelTableT<T> table = {
+        SIMD_SCALAR, scalarAdd<T>, scalarSub<T>, scalarMul<T>, scalarScale<T>, scalarAxpy<T>,
+        scalarMicro<T>, SCALAR_MR, SCALAR_NR, scalarBatch<T>, 1, scalarGemv<T>
+    };
+    return table;
+}
+
+template const KernelTableT<float>& scalar_kernels<float>();
+template const KernelTableT<double>& scalar_kernels<double>();
+template const KernelTableT<int>& scalar_kernels<int>();
+template const KernelTableT<std::complex<double> >& scalar_kernels<std::complex<double> >();
+
+template <>
+const KernelTableT<double>& active_kernels<double>() {
+    return *activeSlot().f64.load(std::memory_order_acquire);
+}
+
+template <>
+const KernelTableT<float>& active_kernels<float>() {
+    return *activeSlot().f32.load(std::memory_order_acquire);
+}
+
+SimdLevel simd_level() {
+    return active_kernels<double>().level;
+}
+
+const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+    case SIMD_SCALAR: return "scalar";
+    case SIMD_SSE2:   return "sse2";
+    case SIMD_AVX2:   return "avx2";
+    case SIMD_AVX512: return "avx512";
+    case SIMD_NEON:   return "neon";
+    }
+    return "unknown";
+}
+
+bool simd_supported(SimdLevel level) {
+    return tableFor64(level) != NULL && tableFor32(level) != NULL && cpuSupports(level);
+}
+
+bool set_simd_level(SimdLevel level) {
+    if (!simd_supported(level)) {
+        return false;
+    }
+    activeSlot().f64.store(tableFor64(level), std::memory_order_release);
+    activeSlot().f32.store(tableFor32(level), std::memory_order_release);
+    return true;
+}
+
+void vec_add(std::size_t n, const double* a, const double* b, double* out) {
+    active_kernels<double>().add(n, a, b, out);
+}
+
+void vec_sub(std::size_t n, const double* a, const double* b, double* out) {
+    active_kernels<double>().sub(n, a, b, out);
+}
+
+void vec_mul(std::size_t n, const double* a, const double* b, double* out) {
+    active_kernels<double>().mul(n, a, b, out);
+}
+
+void vec_scale(std::size_t n, double alpha, const double* a, double* out) {
+    active_kernels<double>().scale(n, alpha, a, out);
+}
+
+void vec_axpy(std::size_t n, double alpha, const double* x, double* y) {
+    active_kernels<double>().axpy(n, alpha, x, y);
+}
+
+double vec_dot(std::size_t n, const double* a, const double* b) {
+    double result;
+    active_kernels<double>().gemv(1, static_cast<int>(n), 1.0, a, static_cast<int>(n), b, 0.0, &result);
+    return result;
+}
+
+void vec_add(std::size_t n, const float* a, const float* b, float* out) {
+    active_kernels<float>().add(n, a, b, out);
+}
+
+void vec_sub(std::size_t n, const float* a, const float* b, float* out) {
+    active_kernels<float>().sub(n, a, b, out);
+}
+
+void vec_mul(std::size_t n, const float* a, const float* b, float* out) {
+    active_kernels<float>().mul(n, a, b, out);
+}
+
+void vec_scale(std::size_t n, float alpha, const float* a, float* out) {
+    active_kernels<float>().scale(n, alpha, a, out);
+}
+
+void vec_axpy(std::size_t n, float alpha, const float* x, float* y) {
+    active_kernels<float>().axpy(n, alpha, x, y);
+}
+
+float vec_dot(std::size_t n, const float* a, const float* b) {
+    float result;
+    active_kernels<float>().gemv(1, static_cast<int>(n), 1.0f, a, static_cast<int>(n), b, 0.0f, &result);
+    return result;
+}
+
+} // namespace mathlib
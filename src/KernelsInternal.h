@@ -0,0 +1,165 @@
+/**
+ * @file KernelsInternal.h
+ * @brief Tablas de kernels compartidas entre las variantes SIMD (uso interno)
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada variante de conjunto de instrucciones rellena una KernelTableT
+ * por tipo de elemento (float y double). La capa de despacho
+ * (Kernels.cpp) elige las tablas al arrancar y el resto de la biblioteca
+ * llama a los kernels a través de active_kernels<T>(). Los tipos sin
+ * variantes vectorizadas (int, std::complex<double>) usan siempre la
+ * tabla escalar genérica.
+ */
+
+#ifndef KERNELS_INTERNAL_H
+#define KERNELS_INTERNAL_H
+
+#include "Kernels.h"
+#include <cstddef>
+#include <complex>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MATHLIB_ARCH_X86 1
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MATHLIB_ARCH_ARM64 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MATHLIB_TARGET(isa) __attribute__((target(isa)))
+#else
+#define MATHLIB_TARGET(isa)
+#endif
+
+namespace mathlib {
+
+/// Mayor número de filas de tesela de los micro-kernels disponibles
+static const int GEMM_MR_MAX = 8;
+
+/// Mayor número de columnas de tesela de los micro-kernels disponibles
+static const int GEMM_NR_MAX = 32;
+
+/**
+ * @struct KernelTableT
+ * @brief Conjunto de kernels de un nivel SIMD para el tipo de elemento T
+ *
+ * El micro-kernel calcula una tesela completa mr x nr de C: a apunta a
+ * un micro-panel de A empaquetado (mr valores por índice p) y b a uno de
+ * B (nr valores por índice p). Si accumulate es false la tesela de C se
+ * sobrescribe; si es true se le suma el producto.
+ *
+ * El kernel por lotes multiplica `lanes` pares de matrices pequeñas a la
+ * vez con los datos entrelazados: el elemento (i, j) de las `lanes`
+ * matrices ocupa `lanes` posiciones consecutivas, de modo que cada
+ * registro SIMD lleva el mismo elemento de matrices distintas. Con a de
+ * m x k, b de k x n y c de m x n (todas entrelazadas y contiguas) calcula
+ * c = a × b en cada carril; c se sobrescribe.
+ *
+ * El kernel GEMV calcula y[i] = alpha · (fila i de a) · x + beta · y[i]
+ * para una a de m x n por filas con separación lda; con beta == 0 no se
+ * lee y (puede estar sin inicializar).
+ */
+template <class T>
+struct KernelTableT {
+    SimdLevel level;                                                  ///< Nivel SIMD de la tabla
+    void (*add)(std::size_t n, const T* a, const T* b, T* out);       ///< Suma elemento a elemento
+    void (*sub)(std::size_t n, const T* a, const T* b, T* out);       ///< Resta elemento a elemento
+    void (*mul)(std::size_t n, const T* a, const T* b, T* out);       ///< Producto elemento a elemento
+    void (*scale)(std::size_t n, T alpha, const T* a, T* out);        ///< Escalado por un escalar
+    void (*axpy)(std::size_t n, T alpha, const T* x, T* y);           ///< y += alpha * x
+    void (*micro)(int kb, const T* a, const T* b,
+                  T* C, int ldc, bool accumulate);                    ///< Micro-kernel de GEMM
+    int mr;                                                           ///< Filas de tesela del micro-kernel
+    int nr;                                                           ///< Columnas de tesela del micro-kernel
+    void (*batch)(int m, int n, int k, const T* a, const T* b, T* c); ///< Kernel por lotes entrelazados
+    int lanes;                                                        ///< Matrices por llamada al kernel por lotes
+    void (*gemv)(int m, int n, T alpha, const T* a, int lda,
+                 const T* x, T beta, T* y);                           ///< Producto matriz-vector
+};
+
+/// Tabla de kernels para double
+typedef KernelTableT<double> KernelTable;
+
+/**
+ * @brief Tabla portable para el tipo T, disponible siempre
+ *
+ * Instanciada para float, double, int y std::complex<double>.
+ */
+template <class T>
+const KernelTableT<T>& scalar_kernels();
+
+/**
+ * @brief Tabla de kernels activa para el tipo T (elegida al primer uso)
+ *
+ * Para los tipos sin variantes vectorizadas es la tabla escalar.
+ */
+template <class T>
+const KernelTableT<T>& active_kernels() {
+    return scalar_kernels<T>();
+}
+
+template <>
+const KernelTableT<double>& active_kernels<double>();
+
+template <>
+const KernelTableT<float>& active_kernels<float>();
+
+/// Escribe en y el resultado r de un producto escalar de GEMV
+template <class T>
+inline void gemv_store(T* y, T r, T alpha, T beta) {
+    *y = beta == T() ? alpha * r : alpha * r + beta * *y;
+}
+
+/// Kernel vectorizado elemento a elemento de la forma out = a (op) b
+template <class T>
+struct ElementwiseKernel {
+    typedef void (*type)(std::size_t n, const T* a, const T* b, T* out);
+};
+
+/**
+ * @brief Aplica un kernel elemento a elemento a dos bloques con separación
+ *
+ * Si los tres bloques son contiguos (separación igual al número de
+ * columnas) se procesa todo en una sola llamada; en otro caso se llama
+ * al kernel fila por fila.
+ */
+template <class T>
+void apply_elementwise(typename ElementwiseKernel<T>::type kernel, int rows, int cols,
+                       const T* a, int lda, const T* b, int ldb,
+                       T* out, int ldo) {
+    if (lda == cols && ldb == cols && ldo == cols) {
+        kernel(static_cast<std::size_t>(rows) * cols, a, b, out);
+        return;
+    }
+    for (int i = 0; i < rows; ++i) {
+        kernel(static_cast<std::size_t>(cols),
+               a + static_cast<std::size_t>(i) * lda,
+               b + static_cast<std::size_t>(i) * ldb,
+               out + static_cast<std::size_t>(i) * ldo);
+    }
+}
+
+#if defined(MATHLIB_ARCH_X86)
+/// Tablas SSE2
+const KernelTableT<double>& sse2_kernels_f64();
+const KernelTableT<float>& sse2_kernels_f32();
+/// Tablas AVX2 + FMA
+const KernelTableT<double>& avx2_kernels_f64();
+const KernelTableT<float>& avx2_kernels_f32();
+/// Tablas AVX-512F
+const KernelTableT<double>& avx512_kernels_f64();
+const KernelTableT<float>& avx512_kernels_f32();
+#endif
+
+#if defined(MATHLIB_ARCH_ARM64)
+/// Tablas NEON
+const KernelTableT<double>& neon_kernels_f64();
+const KernelTableT<float>& neon_kernels_f32();
+#endif
+
+} // namespace mathlib
+
+#endif
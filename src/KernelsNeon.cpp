@@ -0,0 +1,273 @@
+/**
+ * @file KernelsNeon.cpp
+ * @brief Kernels NEON (Advanced SIMD) para ARMv8 de 64 bits
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * NEON forma parte de la arquitectura base de AArch64, por lo que estas
+ * variantes no necesitan atributos de compilación ni comprobación de CPU.
+ * Hay una tabla para double (tesela 4x8) y otra para float (4x16).
+ */
+
+#include "KernelsInternal.h"
+
+#if defined(MATHLIB_ARCH_ARM64)
+
+#include <arm_neon.h>
+
+namespace mathlib {
+
+namespace {
+
+#define MATHLIB_NEON_BINARY(name, T, W, LOAD, STORE, intrinsic, op)              \
+    void name(std::size_t n, const T* a, const T* b, T* out) {                     \
+        std::size_t i = 0;                                                         \
+        for (; i + 2 * (W) <= n; i += 2 * (W)) {                                   \
+            STORE(out + i, intrinsic(LOAD(a + i), LOAD(b + i)));                   \
+            STORE(out + i + (W), intrinsic(LOAD(a + i + (W)), LOAD(b + i + (W)))); \
+        }                                                                          \
+        for (; i < n; ++i) out[i] = a[i] op b[i];                                  \
+    }
+
+#define MATHLIB_NEON_SCALE(name, T, V, W, DUP, LOAD, STORE, MUL)                   \
+    void name(std::size_t n, T alpha, const T* a, T* out) {                        \
+        V va = DUP(alpha);                                                         \
+        std::size_t i = 0;                                                         \
+        for (; i + (W) <= n; i += (W)) {                                           \
+            STORE(out + i, MUL(va, LOAD(a + i)));                                  \
+        }                                                                          \
+        for (; i < n; ++i) out[i] = alpha * a[i];                                  \
+    }
+
+#define MATHLIB_NEON_AXPY(name, T, V, W, DUP, LOAD, STORE, FMA)                    \
+    void name(std::size_t n, T alpha, const T* x, T* y) {                          \
+        V va = DUP(alpha);                                                         \
+        std::size_t i = 0;                                                         \
+        for (; i + (W) <= n; i += (W)) {                                           \
+            STORE(y + i, FMA(LOAD(y + i), va, LOAD(x + i)));                       \
+        }                                                                          \
+        for (; i < n; ++i) y[i] += alpha * x[i];                                   \
+    }
+
+/// Kernel por lotes con W carriles; FMA(acc, x, y) = acc + x * y
+#define MATHLIB_NEON_BATCH(name, T, V, W, DUP, LOAD, STORE, FMA)                   \
+    void name(int m, int n, int k, const T* a, const T* b, T* c) {                 \
+        const std::size_t rowA = static_cast<std::size_t>(k) * (W);                \
+        const std::size_t rowB = static_cast<std::size_t>(n) * (W);                \
+        for (int i = 0; i < m; ++i) {                                              \
+            const T* ai = a + i * rowA;                                            \
+            T* ci = c + i * rowB;                                                  \
+            int j = 0;                                                             \
+            for (; j + 4 <= n; j += 4) {                                           \
+                V c0 = DUP(0), c1 = DUP(0), c2 = DUP(0), c3 = DUP(0);              \
+                const T* bp = b + static_cast<std::size_t>(j) * (W);               \
+                for (int p = 0; p < k; ++p) {                                      \
+                    V av = LOAD(ai + static_cast<std::size_t>(p) * (W));           \
+                    c0 = FMA(c0, av, LOAD(bp));                                    \
+                    c1 = FMA(c1, av, LOAD(bp + (W)));                              \
+                    c2 = FMA(c2, av, LOAD(bp + 2 * (W)));                          \
+                    c3 = FMA(c3, av, LOAD(bp + 3 * (W)));                          \
+                    bp += rowB;                                                    \
+                }                                                                  \
+                T* out = ci + static_cast<std::size_t>(j) * (W);                   \
+                STORE(out, c0);                                                    \
+                STORE(out + (W), c1);                                              \
+                STORE(out + 2 * (W), c2);                                          \
+                STORE(out + 3 * (W), c3);                                          \
+            }                                                                      \
+            for (; j < n; ++j) {                                                   \
+                V c0 = DUP(0);                                                     \
+                const T* bp = b + static_cast<std::size_t>(j) * (W);               \
+                for (int p = 0; p < k; ++p) {                                      \
+                    V av = LOAD(ai + static_cast<std::size_t>(p) * (W));           \
+                    c0 = FMA(c0, av, LOAD(bp));                                    \
+                    bp += rowB;                                                    \
+                }                                                                  \
+                STORE(ci + static_cast<std::size_t>(j) * (W), c0);                 \
+            }                                                                      \
+        }                                                                          \
+    }
+
+/// GEMV con W elementos por vector y cuatro filas a la vez; FMA(acc, x, y) = acc + x * y
+#define MATHLIB_NEON_GEMV(name, T, V, W, DUP, LOAD, FMA, HSUM)                       \
+    void name(int m, int n, T alpha, const T* a, int lda, const T* x, T beta, T* y) { \
+        int i = 0;                                                                 \
+        for (; i + 4 <= m; i += 4) {                                               \
+            const T* a0 = a + static_cast<std::size_t>(i) * lda;                   \
+            const T* a1 = a0 + lda;                                                \
+            const T* a2 = a1 + lda;                                                \
+            const T* a3 = a2 + lda;                                                \
+            V s0 = DUP(0), s1 = DUP(0), s2 = DUP(0), s3 = DUP(0);                  \
+            int j = 0;                                                             \
+            for (; j + (W) <= n; j += (W)) {                                       \
+                V xv = LOAD(x + j);                                                \
+                s0 = FMA(s0, LOAD(a0 + j), xv);                                    \
+                s1 = FMA(s1, LOAD(a1 + j), xv);                                    \
+                s2 = FMA(s2, LOAD(a2 + j), xv);                                    \
+                s3 = FMA(s3, LOAD(a3 + j), xv);                                    \
+            }                                                                      \
+            T r0 = HSUM(s0), r1 = HSUM(s1), r2 = HSUM(s2), r3 = HSUM(s3);          \
+            for (; j < n; ++j) {                                                   \
+                r0 += a0[j] * x[j];                                                \
+                r1 += a1[j] * x[j];                                                \
+                r2 += a2[j] * x[j];                                                \
+                r3 += a3[j] * x[j];                                                \
+            }                                                                      \
+            gemv_store(y + i, r0, alpha, beta);                                    \
+            gemv_store(y + i + 1, r1, alpha, beta);                                \
+            gemv_store(y + i + 2, r2, alpha, beta);                                \
+            gemv_store(y + i + 3, r3, alpha, beta);                                \
+        }                                                                          \
+        for (; i < m; ++i) {                                                       \
+            const T* ai = a + static_cast<std::size_t>(i) * lda;                   \
+            V s0 = DUP(0), s1 = DUP(0);                                            \
+            int j = 0;                                                             \
+            for (; j + 2 * (W) <= n; j += 2 * (W)) {                               \
+                s0 = FMA(s0, LOAD(ai + j), LOAD(x + j));                           \
+                s1 = FMA(s1, LOAD(ai + j + (W)), LOAD(x + j + (W)));               \
+            }                                                                      \
+            T r = HSUM(s0) + HSUM(s1);                                             \
+            for (; j < n; ++j) r += ai[j] * x[j];                                  \
+            gemv_store(y + i, r, alpha, beta);                                     \
+        }                                                                          \
+    }
+
+MATHLIB_NEON_BINARY(neonF64Add, double, 2, vld1q_f64, vst1q_f64, vaddq_f64, +)
+MATHLIB_NEON_BINARY(neonF64Sub, double, 2, vld1q_f64, vst1q_f64, vsubq_f64, -)
+MATHLIB_NEON_BINARY(neonF64Mul, double, 2, vld1q_f64, vst1q_f64, vmulq_f64, *)
+MATHLIB_NEON_SCALE(neonF64Scale, double, float64x2_t, 2, vdupq_n_f64, vld1q_f64, vst1q_f64, vmulq_f64)
+MATHLIB_NEON_AXPY(neonF64Axpy, double, float64x2_t, 2, vdupq_n_f64, vld1q_f64, vst1q_f64, vfmaq_f64)
+MATHLIB_NEON_BATCH(neonF64Batch, double, float64x2_t, 2, vdupq_n_f64, vld1q_f64, vst1q_f64, vfmaq_f64)
+MATHLIB_NEON_GEMV(neonF64Gemv, double, float64x2_t, 2, vdupq_n_f64, vld1q_f64, vfmaq_f64, vaddvq_f64)
+
+MATHLIB_NEON_BINARY(neonF32Add, float, 4, vld1q_f32, vst1q_f32, vaddq_f32, +)
+MATHLIB_NEON_BINARY(neonF32Sub, float, 4, vld1q_f32, vst1q_f32, vsubq_f32, -)
+MATHLIB_NEON_BINARY(neonF32Mul, float, 4, vld1q_f32, vst1q_f32, vmulq_f32, *)
+MATHLIB_NEON_SCALE(neonF32Scale, float, float32x4_t, 4, vdupq_n_f32, vld1q_f32, vst1q_f32, vmulq_f32)
+MATHLIB_NEON_AXPY(neonF32Axpy, float, float32x4_t, 4, vdupq_n_f32, vld1q_f32, vst1q_f32, vfmaq_f32)
+MATHLIB_NEON_BATCH(neonF32Batch, float, float32x4_t, 4, vdupq_n_f32, vld1q_f32, vst1q_f32, vfmaq_f32)
+MATHLIB_NEON_GEMV(neonF32Gemv, float, float32x4_t, 4, vdupq_n_f32, vld1q_f32, vfmaq_f32, vaddvq_f32)
+
+const int NEON_F64_MR = 4;
+const int NEON_F64_NR = 8;
+
+void neonF64Micro(int kb, const double* a, const double* b,
+                  double* C, int ldc, bool accumulate) {
+    float64x2_t c[NEON_F64_MR][4];
+    for (int r = 0; r < NEON_F64_MR; ++r) {
+        for (int q = 0; q < 4; ++q) {
+            c[r][q] = vdupq_n_f64(0.0);
+        }
+    }
+
+    for (int p = 0; p < kb; ++p) {
+        float64x2_t b0 = vld1q_f64(b);
+        float64x2_t b1 = vld1q_f64(b + 2);
+        float64x2_t b2 = vld1q_f64(b + 4);
+        float64x2_t b3 = vld1q_f64(b + 6);
+        float64x2_t a01 = vld1q_f64(a);
+        float64x2_t a23 = vld1q_f64(a + 2);
+        c[0][0] = vfmaq_laneq_f64(c[0][0], b0, a01, 0);
+        c[0][1] = vfmaq_laneq_f64(c[0][1], b1, a01, 0);
+        c[0][2] = vfmaq_laneq_f64(c[0][2], b2, a01, 0);
+        c[0][3] = vfmaq_laneq_f64(c[0][3], b3, a01, 0);
+        c[1][0] = vfmaq_laneq_f64(c[1][0], b0, a01, 1);
+        c[1][1] = vfmaq_laneq_f64(c[1][1], b1, a01, 1);
+        c[1][2] = vfmaq_laneq_f64(c[1][2], b2, a01, 1);
+        c[1][3] = vfmaq_laneq_f64(c[1][3], b3, a01, 1);
+        c[2][0] = vfmaq_laneq_f64(c[2][0], b0, a23, 0);
+        c[2][1] = vfmaq_laneq_f64(c[2][1], b1, a23, 0);
+        c[2][2] = vfmaq_laneq_f64(c[2][2], b2, a23, 0);
+        c[2][3] = vfmaq_laneq_f64(c[2][3], b3, a23, 0);
+        c[3][0] = vfmaq_laneq_f64(c[3][0], b0, a23, 1);
+        c[3][1] = vfmaq_laneq_f64(c[3][1], b1, a23, 1);
+        c[3][2] = vfmaq_laneq_f64(c[3][2], b2, a23, 1);
+        c[3][3] = vfmaq_laneq_f64(c[3][3], b3, a23, 1);
+        a += NEON_F64_MR;
+        b += NEON_F64_NR;
+    }
+
+    for (int r = 0; r < NEON_F64_MR; ++r) {
+        double* out = C + static_cast<std::size_t>(r) * ldc;
+        for (int q = 0; q < 4; ++q) {
+            float64x2_t v = c[r][q];
+            if (accumulate) {
+                v = vaddq_f64(v, vld1q_f64(out + 2 * q));
+            }
+            vst1q_f64(out + 2 * q, v);
+        }
+    }
+}
+
+const int NEON_F32_MR = 4;
+const int NEON_F32_NR = 16;
+
+void neonF32Micro(int kb, const float* a, const float* b,
+                  float* C, int ldc, bool accumulate) {
+    float32x4_t c[NEON_F32_MR][4];
+    for (int r = 0; r < NEON_F32_MR; ++r) {
+        for (int q = 0; q < 4; ++q) {
+            c[r][q] = vdupq_n_f32(0.0f);
+        }
+    }
+
+    for (int p = 0; p < kb; ++p) {
+        float32x4_t b0 = vld1q_f32(b);
+        float32x4_t b1 = vld1q_f32(b + 4);
+        float32x4_t b2 = vld1q_f32(b + 8);
+        float32x4_t b3 = vld1q_f32(b + 12);
+        float32x4_t av = vld1q_f32(a);
+        c[0][0] = vfmaq_laneq_f32(c[0][0], b0, av, 0);
+        c[0][1] = vfmaq_laneq_f32(c[0][1], b1, av, 0);
+        c[0][2] = vfmaq_laneq_f32(c[0][2], b2, av, 0);
+        c[0][3] = vfmaq_laneq_f32(c[0][3], b3, av, 0);
+        c[1][0] = vfmaq_laneq_f32(c[1][0], b0, av, 1);
+        c[1][1] = vfmaq_laneq_f32(c[1][1], b1, av, 1);
+        c[1][2] = vfmaq_laneq_f32(c[1][2], b2, av, 1);
+        c[1][3] = vfmaq_laneq_f32(c[1][3], b3, av, 1);
+        c[2][0] = vfmaq_laneq_f32(c[2][0], b0, av, 2);
+        c[2][1] = vfmaq_laneq_f32(c[2][1], b1, av, 2);
+        c[2][2] = vfmaq_laneq_f32(c[2][2], b2, av, 2);
+        c[2][3] = vfmaq_laneq_f32(c[2][3], b3, av, 2);
+        c[3][0] = vfmaq_laneq_f32(c[3][0], b0, av, 3);
+        c[3][1] = vfmaq_laneq_f32(c[3][1], b1, av, 3);
+        c[3][2] = vfmaq_laneq_f32(c[3][2], b2, av, 3);
+        c[3][3] = vfmaq_laneq_f32(c[3][3], b3, av, 3);
+        a += NEON_F32_MR;
+        b += NEON_F32_NR;
+    }
+
+    for (int r = 0; r < NEON_F32_MR; ++r) {
+        float* out = C + static_cast<std::size_t>(r) * ldc;
+        for (int q = 0; q < 4; ++q) {
+            float32x4_t v = c[r][q];
+            if (accumulate) {
+                v = vaddq_f32(v, vld1q_f32(out + 4 * q));
+            }
+            vst1q_f32(out + 4 * q, v);
+        }
+    }
+}
+
+} // namespace
+
+const KernelTableT<double>& neon_kernels_f64() {
+    static const KernelTableT<double> table = {
+        SIMD_NEON, neonF64Add, neonF64Sub, neonF64Mul, neonF64Scale, neonF64Axpy,
+        neonF64Micro, NEON_F64_MR, NEON_F64_NR, neonF64Batch, 2, neonF64Gemv
+    };
+    return table;
+}
+
+const KernelTableT<float>& neon_kernels_f32() {
+    static const KernelTableT<float> table = {
+        SIMD_NEON, neonF32Add, neonF32Sub, neonF32Mul, neonF32Scale, neonF32Axpy,
+        neonF32Micro, NEON_F32_MR, NEON_F32_NR, neonF32Batch, 4, neonF32Gemv
+    };
+    return table;
+}
+
+} // namespace mathlib
+
+#endif
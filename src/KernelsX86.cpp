@@ -0,0 +1,628 @@
+/**
+ * @file KernelsX86.cpp
+ * @brief Kernels SSE2, AVX2+FMA y AVX-512F para procesadores x86
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada función se compila con el atributo target de su conjunto de
+ * instrucciones, de modo que el archivo no necesita opciones -m y el
+ * binario resultante sigue funcionando en CPUs sin esas extensiones:
+ * la capa de despacho solo llama a una variante tras comprobar que la
+ * CPU la admite.
+ *
+ * Cada nivel tiene variantes double y float. Los micro-kernels usan dos
+ * registros por fila de la tesela, de modo que la tesela float tiene el
+ * doble de columnas que la double con los mismos registros.
+ */
+
+#include "KernelsInternal.h"
+
+#if defined(MATHLIB_ARCH_X86)
+
+#include <immintrin.h>
+
+namespace mathlib {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Plantillas de los kernels elemento a elemento
+// ---------------------------------------------------------------------------
+
+/// out = a (op) b con dos vectores de W elementos por iteración y cola escalar
+#define MATHLIB_X86_BINARY(name, isa, T, W, LOADU, STOREU, INTR, op)                \
+    MATHLIB_TARGET(isa)                                                             \
+    void name(std::size_t n, const T* a, const T* b, T* out) {                      \
+        std::size_t i = 0;                                                          \
+        for (; i + 2 * (W) <= n; i += 2 * (W)) {                                    \
+            STOREU(out + i, INTR(LOADU(a + i), LOADU(b + i)));                      \
+            STOREU(out + i + (W), INTR(LOADU(a + i + (W)), LOADU(b + i + (W))));    \
+        }                                                                           \
+        for (; i < n; ++i) out[i] = a[i] op b[i];                                   \
+    }
+
+/// out = alpha * a
+#define MATHLIB_X86_SCALE(name, isa, T, V, W, SET1, LOADU, STOREU, MUL)             \
+    MATHLIB_TARGET(isa)                                                             \
+    void name(std::size_t n, T alpha, const T* a, T* out) {                         \
+        V va = SET1(alpha);                                                         \
+        std::size_t i = 0;                                                          \
+        for (; i + (W) <= n; i += (W)) {                                            \
+            STOREU(out + i, MUL(va, LOADU(a + i)));                                 \
+        }                                                                           \
+        for (; i < n; ++i) out[i] = alpha * a[i];                                   \
+    }
+
+/// y += alpha * x, con MADD(a, x, y) = a * x + y
+#define MATHLIB_X86_AXPY(name, isa, T, V, W, SET1, LOADU, STOREU, MADD)             \
+    MATHLIB_TARGET(isa)                                                             \
+    void name(std::size_t n, T alpha, const T* x, T* y) {                           \
+        V va = SET1(alpha);                                                         \
+        std::size_t i = 0;                                                          \
+        for (; i + (W) <= n; i += (W)) {                                            \
+            STOREU(y + i, MADD(va, LOADU(x + i), LOADU(y + i)));                    \
+        }                                                                           \
+        for (; i < n; ++i) y[i] += alpha * x[i];                                    \
+    }
+
+/**
+ * Kernel por lotes con W carriles (una matriz por carril). Cada fila de c
+ * se calcula en grupos de cuatro columnas para reutilizar la carga de a.
+ */
+#define MATHLIB_X86_BATCH(name, isa, T, V, W, ZERO, LOADU, STOREU, MADD)           \
+    MATHLIB_TARGET(isa)                                                             \
+    void name(int m, int n, int k, const T* a, const T* b, T* c) {                  \
+        const std::size_t rowA = static_cast<std::size_t>(k) * (W);                 \
+        const std::size_t rowB = static_cast<std::size_t>(n) * (W);                 \
+        for (int i = 0; i < m; ++i) {                                               \
+            const T* ai = a + i * rowA;                                             \
+            T* ci = c + i * rowB;                                                   \
+            int j = 0;                                                              \
+            for (; j + 4 <= n; j += 4) {                                            \
+                V c0 = ZERO(), c1 = ZERO(), c2 = ZERO(), c3 = ZERO();               \
+                const T* bp = b + static_cast<std::size_t>(j) * (W);                \
+                for (int p = 0; p < k; ++p) {                                       \
+                    V av = LOADU(ai + static_cast<std::size_t>(p) * (W));           \
+                    c0 = MADD(av, LOADU(bp), c0);                                   \
+                    c1 = MADD(av, LOADU(bp + (W)), c1);                             \
+                    c2 = MADD(av, LOADU(bp + 2 * (W)), c2);                         \
+                    c3 = MADD(av, LOADU(bp + 3 * (W)), c3);                         \
+                    bp += rowB;                                                     \
+                }                                                                   \
+                T* out = ci + static_cast<std::size_t>(j) * (W);                    \
+                STOREU(out, c0);                                                    \
+                STOREU(out + (W), c1);                                              \
+                STOREU(out + 2 * (W), c2);                                          \
+                STOREU(out + 3 * (W), c3);                                          \
+            }                                                                       \
+            for (; j < n; ++j) {                                                    \
+                V c0 = ZERO();                                                      \
+                const T* bp = b + static_cast<std::size_t>(j) * (W);                \
+                for (int p = 0; p < k; ++p) {                                       \
+                    V av = LOADU(ai + static_cast<std::size_t>(p) * (W));           \
+                    c0 = MADD(av, LOADU(bp), c0);                                   \
+                    bp += rowB;                                                     \
+                }                                                                   \
+                STOREU(ci + static_cast<std::size_t>(j) * (W), c0);                 \
+            }                                                                       \
+        }                                                                           \
+    }
+
+/**
+ * GEMV con W elementos por vector: cuatro filas a la vez comparten cada
+ * carga de x; las filas sobrantes usan dos acumuladores para no quedar
+ * limitadas por la latencia de la suma. HSUM reduce un vector a escalar.
+ */
+#define MATHLIB_X86_GEMV(name, isa, T, V, W, ZERO, LOADU, MADD, HSUM)            \
+    MATHLIB_TARGET(isa)                                                             \
+    void name(int m, int n, T alpha, const T* a, int lda, const T* x, T beta, T* y) { \
+        int i = 0;                                                                  \
+        for (; i + 4 <= m; i += 4) {                                                \
+            const T* a0 = a + static_cast<std::size_t>(i) * lda;                    \
+            const T* a1 = a0 + lda;                                                 \
+            const T* a2 = a1 + lda;                                                 \
+            const T* a3 = a2 + lda;                                                 \
+            V s0 = ZERO(), s1 = ZERO(), s2 = ZERO(), s3 = ZERO();                   \
+            int j = 0;                                                              \
+            for (; j + (W) <= n; j += (W)) {                                        \
+                V xv = LOADU(x + j);                                                \
+                s0 = MADD(LOADU(a0 + j), xv, s0);                                   \
+                s1 = MADD(LOADU(a1 + j), xv, s1);                                   \
+                s2 = MADD(LOADU(a2 + j), xv, s2);                                   \
+                s3 = MADD(LOADU(a3 + j), xv, s3);                                   \
+            }                                                                       \
+            T r0 = HSUM(s0), r1 = HSUM(s1), r2 = HSUM(s2), r3 = HSUM(s3);           \
+            for (; j < n; ++j) {                                                    \
+                r0 += a0[j] * x[j];                                                 \
+                r1 += a1[j] * x[j];                                                 \
+                r2 += a2[j] * x[j];                                                 \
+                r3 += a3[j] * x[j];                                                 \
+            }                                                                       \
+            gemv_store(y + i, r0, alpha, beta);                                     \
+            gemv_store(y + i + 1, r1, alpha, beta);                                 \
+            gemv_store(y + i + 2, r2, alpha, beta);                                 \
+            gemv_store(y + i + 3, r3, alpha, beta);                                 \
+        }                                                                           \
+        for (; i < m; ++i) {                                                        \
+            const T* ai = a + static_cast<std::size_t>(i) * lda;                    \
+            V s0 = ZERO(), s1 = ZERO();                                             \
+            int j = 0;                                                              \
+            for (; j + 2 * (W) <= n; j += 2 * (W)) {                                \
+                s0 = MADD(LOADU(ai + j), LOADU(x + j), s0);                         \
+                s1 = MADD(LOADU(ai + j + (W)), LOADU(x + j + (W)), s1);             \
+            }                                                                       \
+            T r = HSUM(s0) + HSUM(s1);                                              \
+            for (; j < n; ++j) r += ai[j] * x[j];                                   \
+            gemv_store(y + i, r, alpha, beta);                                      \
+        }                                                                           \
+    }
+
+#define MATHLIB_SSE2_MADD_PD(a, x, y) _mm_add_pd(_mm_mul_pd(a, x), y)
+#define MATHLIB_SSE2_MADD_PS(a, x, y) _mm_add_ps(_mm_mul_ps(a, x), y)
+
+/// Suma de los carriles de un vector (reducciones horizontales)
+MATHLIB_TARGET("sse2")
+inline double sse2HsumPd(__m128d v) {
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+MATHLIB_TARGET("sse2")
+inline float sse2HsumPs(__m128 v) {
+    __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+
+MATHLIB_TARGET("avx2,fma")
+inline double avx2HsumPd(__m256d v) {
+    return sse2HsumPd(_mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1)));
+}
+
+MATHLIB_TARGET("avx2,fma")
+inline float avx2HsumPs(__m256 v) {
+    return sse2HsumPs(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+// _mm512_reduce_add_* provoca avisos falsos de -Wmaybe-uninitialized en GCC 12;
+// se suma a través de memoria, solo una vez por fila
+MATHLIB_TARGET("avx512f")
+inline double avx512HsumPd(__m512d v) {
+    double lanes[8];
+    _mm512_storeu_pd(lanes, v);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+MATHLIB_TARGET("avx512f")
+inline float avx512HsumPs(__m512 v) {
+    float lanes[16];
+    _mm512_storeu_ps(lanes, v);
+    float sum = 0.0f;
+    for (int i = 0; i < 16; ++i) sum += lanes[i];
+    return sum;
+}
+
+// ---------------------------------------------------------------------------
+// SSE2: vectores de 128 bits, micro-kernels 4x4 (double) y 4x8 (float)
+// ---------------------------------------------------------------------------
+
+MATHLIB_X86_BINARY(sse2F64Add, "sse2", double, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_add_pd, +)
+MATHLIB_X86_BINARY(sse2F64Sub, "sse2", double, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_sub_pd, -)
+MATHLIB_X86_BINARY(sse2F64Mul, "sse2", double, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_mul_pd, *)
+MATHLIB_X86_SCALE(sse2F64Scale, "sse2", double, __m128d, 2, _mm_set1_pd, _mm_loadu_pd, _mm_storeu_pd, _mm_mul_pd)
+MATHLIB_X86_AXPY(sse2F64Axpy, "sse2", double, __m128d, 2, _mm_set1_pd, _mm_loadu_pd, _mm_storeu_pd, MATHLIB_SSE2_MADD_PD)
+MATHLIB_X86_BATCH(sse2F64Batch, "sse2", double, __m128d, 2, _mm_setzero_pd, _mm_loadu_pd, _mm_storeu_pd, MATHLIB_SSE2_MADD_PD)
+MATHLIB_X86_GEMV(sse2F64Gemv, "sse2", double, __m128d, 2, _mm_setzero_pd, _mm_loadu_pd, MATHLIB_SSE2_MADD_PD, sse2HsumPd)
+
+const int SSE2_F64_MR = 4;
+const int SSE2_F64_NR = 4;
+
+MATHLIB_TARGET("sse2")
+void sse2F64Micro(int kb, const double* a, const double* b,
+                  double* C, int ldc, bool accumulate) {
+    __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd();
+    __m128d c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+    __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd();
+    __m128d c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+
+    for (int p = 0; p < kb; ++p) {
+        __m128d b0 = _mm_loadu_pd(b);
+        __m128d b1 = _mm_loadu_pd(b + 2);
+        __m128d av;
+        av = _mm_set1_pd(a[0]);
+        c00 = _mm_add_pd(c00, _mm_mul_pd(av, b0)); c01 = _mm_add_pd(c01, _mm_mul_pd(av, b1));
+        av = _mm_set1_pd(a[1]);
+        c10 = _mm_add_pd(c10, _mm_mul_pd(av, b0)); c11 = _mm_add_pd(c11, _mm_mul_pd(av, b1));
+        av = _mm_set1_pd(a[2]);
+        c20 = _mm_add_pd(c20, _mm_mul_pd(av, b0)); c21 = _mm_add_pd(c21, _mm_mul_pd(av, b1));
+        av = _mm_set1_pd(a[3]);
+        c30 = _mm_add_pd(c30, _mm_mul_pd(av, b0)); c31 = _mm_add_pd(c31, _mm_mul_pd(av, b1));
+        a += SSE2_F64_MR;
+        b += SSE2_F64_NR;
+    }
+
+#define SSE2F64MICRO_STORE(row, v0, v1)                                        \
+    {                                                                          \
+        double* out = C + static_cast<std::size_t>(row) * ldc;                 \
+        if (accumulate) {                                                      \
+            v0 = _mm_add_pd(v0, _mm_loadu_pd(out));                            \
+            v1 = _mm_add_pd(v1, _mm_loadu_pd(out + 2));                        \
+        }                                                                      \
+        _mm_storeu_pd(out, v0);                                                \
+        _mm_storeu_pd(out + 2, v1);                                            \
+    }
+    SSE2F64MICRO_STORE(0, c00, c01)
+    SSE2F64MICRO_STORE(1, c10, c11)
+    SSE2F64MICRO_STORE(2, c20, c21)
+    SSE2F64MICRO_STORE(3, c30, c31)
+#undef SSE2F64MICRO_STORE
+}
+
+MATHLIB_X86_BINARY(sse2F32Add, "sse2", float, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, +)
+MATHLIB_X86_BINARY(sse2F32Sub, "sse2", float, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_sub_ps, -)
+MATHLIB_X86_BINARY(sse2F32Mul, "sse2", float, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_mul_ps, *)
+MATHLIB_X86_SCALE(sse2F32Scale, "sse2", float, __m128, 4, _mm_set1_ps, _mm_loadu_ps, _mm_storeu_ps, _mm_mul_ps)
+MATHLIB_X86_AXPY(sse2F32Axpy, "sse2", float, __m128, 4, _mm_set1_ps, _mm_loadu_ps, _mm_storeu_ps, MATHLIB_SSE2_MADD_PS)
+MATHLIB_X86_BATCH(sse2F32Batch, "sse2", float, __m128, 4, _mm_setzero_ps, _mm_loadu_ps, _mm_storeu_ps, MATHLIB_SSE2_MADD_PS)
+MATHLIB_X86_GEMV(sse2F32Gemv, "sse2", float, __m128, 4, _mm_setzero_ps, _mm_loadu_ps, MATHLIB_SSE2_MADD_PS, sse2HsumPs)
+
+const int SSE2_F32_MR = 4;
+const int SSE2_F32_NR = 8;
+
+MATHLIB_TARGET("sse2")
+void sse2F32Micro(int kb, const float* a, const float* b,
+                  float* C, int ldc, bool accumulate) {
+    __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+    __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+    __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+    __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+
+    for (int p = 0; p < kb; ++p) {
+        __m128 b0 = _mm_loadu_ps(b);
+        __m128 b1 = _mm_loadu_ps(b + 4);
+        __m128 av;
+        av = _mm_set1_ps(a[0]);
+        c00 = _mm_add_ps(c00, _mm_mul_ps(av, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(av, b1));
+        av = _mm_set1_ps(a[1]);
+        c10 = _mm_add_ps(c10, _mm_mul_ps(av, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(av, b1));
+        av = _mm_set1_ps(a[2]);
+        c20 = _mm_add_ps(c20, _mm_mul_ps(av, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(av, b1));
+        av = _mm_set1_ps(a[3]);
+        c30 = _mm_add_ps(c30, _mm_mul_ps(av, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(av, b1));
+        a += SSE2_F32_MR;
+        b += SSE2_F32_NR;
+    }
+
+#define SSE2F32MICRO_STORE(row, v0, v1)                                        \
+    {                                                                          \
+        float* out = C + static_cast<std::size_t>(row) * ldc;                  \
+        if (accumulate) {                                                      \
+            v0 = _mm_add_ps(v0, _mm_loadu_ps(out));                            \
+            v1 = _mm_add_ps(v1, _mm_loadu_ps(out + 4));                        \
+        }                                                                      \
+        _mm_storeu_ps(out, v0);                                                \
+        _mm_storeu_ps(out + 4, v1);                                            \
+    }
+    SSE2F32MICRO_STORE(0, c00, c01)
+    SSE2F32MICRO_STORE(1, c10, c11)
+    SSE2F32MICRO_STORE(2, c20, c21)
+    SSE2F32MICRO_STORE(3, c30, c31)
+#undef SSE2F32MICRO_STORE
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 + FMA: vectores de 256 bits, micro-kernels 6x8 (double) y 6x16 (float)
+// ---------------------------------------------------------------------------
+
+MATHLIB_X86_BINARY(avx2F64Add, "avx2,fma", double, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_add_pd, +)
+MATHLIB_X86_BINARY(avx2F64Sub, "avx2,fma", double, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_sub_pd, -)
+MATHLIB_X86_BINARY(avx2F64Mul, "avx2,fma", double, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_mul_pd, *)
+MATHLIB_X86_SCALE(avx2F64Scale, "avx2,fma", double, __m256d, 4, _mm256_set1_pd, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_mul_pd)
+MATHLIB_X86_AXPY(avx2F64Axpy, "avx2,fma", double, __m256d, 4, _mm256_set1_pd, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_fmadd_pd)
+MATHLIB_X86_BATCH(avx2F64Batch, "avx2,fma", double, __m256d, 4, _mm256_setzero_pd, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_fmadd_pd)
+MATHLIB_X86_GEMV(avx2F64Gemv, "avx2,fma", double, __m256d, 4, _mm256_setzero_pd, _mm256_loadu_pd, _mm256_fmadd_pd, avx2HsumPd)
+
+const int AVX2_F64_MR = 6;
+const int AVX2_F64_NR = 8;
+
+MATHLIB_TARGET("avx2,fma")
+void avx2F64Micro(int kb, const double* a, const double* b,
+                  double* C, int ldc, bool accumulate) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (int p = 0; p < kb; ++p) {
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d av;
+        av = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(av, b0, c00); c01 = _mm256_fmadd_pd(av, b1, c01);
+        av = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(av, b0, c10); c11 = _mm256_fmadd_pd(av, b1, c11);
+        av = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(av, b0, c20); c21 = _mm256_fmadd_pd(av, b1, c21);
+        av = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(av, b0, c30); c31 = _mm256_fmadd_pd(av, b1, c31);
+        av = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(av, b0, c40); c41 = _mm256_fmadd_pd(av, b1, c41);
+        av = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(av, b0, c50); c51 = _mm256_fmadd_pd(av, b1, c51);
+        a += AVX2_F64_MR;
+        b += AVX2_F64_NR;
+    }
+
+#define AVX2F64MICRO_STORE(row, v0, v1)                                        \
+    {                                                                          \
+        double* out = C + static_cast<std::size_t>(row) * ldc;                 \
+        if (accumulate) {                                                      \
+            v0 = _mm256_add_pd(v0, _mm256_loadu_pd(out));                      \
+            v1 = _mm256_add_pd(v1, _mm256_loadu_pd(out + 4));                  \
+        }                                                                      \
+        _mm256_storeu_pd(out, v0);                                             \
+        _mm256_storeu_pd(out + 4, v1);                                         \
+    }
+    AVX2F64MICRO_STORE(0, c00, c01)
+    AVX2F64MICRO_STORE(1, c10, c11)
+    AVX2F64MICRO_STORE(2, c20, c21)
+    AVX2F64MICRO_STORE(3, c30, c31)
+    AVX2F64MICRO_STORE(4, c40, c41)
+    AVX2F64MICRO_STORE(5, c50, c51)
+#undef AVX2F64MICRO_STORE
+}
+
+MATHLIB_X86_BINARY(avx2F32Add, "avx2,fma", float, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps, +)
+MATHLIB_X86_BINARY(avx2F32Sub, "avx2,fma", float, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_sub_ps, -)
+MATHLIB_X86_BINARY(avx2F32Mul, "avx2,fma", float, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_mul_ps, *)
+MATHLIB_X86_SCALE(avx2F32Scale, "avx2,fma", float, __m256, 8, _mm256_set1_ps, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_mul_ps)
+MATHLIB_X86_AXPY(avx2F32Axpy, "avx2,fma", float, __m256, 8, _mm256_set1_ps, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_fmadd_ps)
+MATHLIB_X86_BATCH(avx2F32Batch, "avx2,fma", float, __m256, 8, _mm256_setzero_ps, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_fmadd_ps)
+MATHLIB_X86_GEMV(avx2F32Gemv, "avx2,fma", float, __m256, 8, _mm256_setzero_ps, _mm256_loadu_ps, _mm256_fmadd_ps, avx2HsumPs)
+
+const int AVX2_F32_MR = 6;
+const int AVX2_F32_NR = 16;
+
+MATHLIB_TARGET("avx2,fma")
+void avx2F32Micro(int kb, const float* a, const float* b,
+                  float* C, int ldc, bool accumulate) {
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (int p = 0; p < kb; ++p) {
+        __m256 b0 = _mm256_loadu_ps(b);
+        __m256 b1 = _mm256_loadu_ps(b + 8);
+        __m256 av;
+        av = _mm256_broadcast_ss(a + 0);
+        c00 = _mm256_fmadd_ps(av, b0, c00); c01 = _mm256_fmadd_ps(av, b1, c01);
+        av = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(av, b0, c10); c11 = _mm256_fmadd_ps(av, b1, c11);
+        av = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(av, b0, c20); c21 = _mm256_fmadd_ps(av, b1, c21);
+        av = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(av, b0, c30); c31 = _mm256_fmadd_ps(av, b1, c31);
+        av = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(av, b0, c40); c41 = _mm256_fmadd_ps(av, b1, c41);
+        av = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(av, b0, c50); c51 = _mm256_fmadd_ps(av, b1, c51);
+        a += AVX2_F32_MR;
+        b += AVX2_F32_NR;
+    }
+
+#define AVX2F32MICRO_STORE(row, v0, v1)                                        \
+    {                                                                          \
+        float* out = C + static_cast<std::size_t>(row) * ldc;                  \
+        if (accumulate) {                                                      \
+            v0 = _mm256_add_ps(v0, _mm256_loadu_ps(out));                      \
+            v1 = _mm256_add_ps(v1, _mm256_loadu_ps(out + 8));                  \
+        }                                                                      \
+        _mm256_storeu_ps(out, v0);                                             \
+        _mm256_storeu_ps(out + 8, v1);                                         \
+    }
+    AVX2F32MICRO_STORE(0, c00, c01)
+    AVX2F32MICRO_STORE(1, c10, c11)
+    AVX2F32MICRO_STORE(2, c20, c21)
+    AVX2F32MICRO_STORE(3, c30, c31)
+    AVX2F32MICRO_STORE(4, c40, c41)
+    AVX2F32MICRO_STORE(5, c50, c51)
+#undef AVX2F32MICRO_STORE
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512F: vectores de 512 bits, micro-kernels 8x16 (double) y 8x32 (float)
+// ---------------------------------------------------------------------------
+
+MATHLIB_X86_BINARY(avx512F64Add, "avx512f", double, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_add_pd, +)
+MATHLIB_X86_BINARY(avx512F64Sub, "avx512f", double, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_sub_pd, -)
+MATHLIB_X86_BINARY(avx512F64Mul, "avx512f", double, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_mul_pd, *)
+MATHLIB_X86_SCALE(avx512F64Scale, "avx512f", double, __m512d, 8, _mm512_set1_pd, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_mul_pd)
+MATHLIB_X86_AXPY(avx512F64Axpy, "avx512f", double, __m512d, 8, _mm512_set1_pd, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_fmadd_pd)
+MATHLIB_X86_BATCH(avx512F64Batch, "avx512f", double, __m512d, 8, _mm512_setzero_pd, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_fmadd_pd)
+MATHLIB_X86_GEMV(avx512F64Gemv, "avx512f", double, __m512d, 8, _mm512_setzero_pd, _mm512_loadu_pd, _mm512_fmadd_pd, avx512HsumPd)
+
+const int AVX512_F64_MR = 8;
+const int AVX512_F64_NR = 16;
+
+MATHLIB_TARGET("avx512f")
+void avx512F64Micro(int kb, const double* a, const double* b,
+                    double* C, int ldc, bool accumulate) {
+    __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+    __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+    __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+    __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+    __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+    __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+    __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+    __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+
+    for (int p = 0; p < kb; ++p) {
+        __m512d b0 = _mm512_loadu_pd(b);
+        __m512d b1 = _mm512_loadu_pd(b + 8);
+        __m512d av;
+        av = _mm512_set1_pd(a[0]);
+        c00 = _mm512_fmadd_pd(av, b0, c00); c01 = _mm512_fmadd_pd(av, b1, c01);
+        av = _mm512_set1_pd(a[1]);
+        c10 = _mm512_fmadd_pd(av, b0, c10); c11 = _mm512_fmadd_pd(av, b1, c11);
+        av = _mm512_set1_pd(a[2]);
+        c20 = _mm512_fmadd_pd(av, b0, c20); c21 = _mm512_fmadd_pd(av, b1, c21);
+        av = _mm512_set1_pd(a[3]);
+        c30 = _mm512_fmadd_pd(av, b0, c30); c31 = _mm512_fmadd_pd(av, b1, c31);
+        av = _mm512_set1_pd(a[4]);
+        c40 = _mm512_fmadd_pd(av, b0, c40); c41 = _mm512_fmadd_pd(av, b1, c41);
+        av = _mm512_set1_pd(a[5]);
+        c50 = _mm512_fmadd_pd(av, b0, c50); c51 = _mm512_fmadd_pd(av, b1, c51);
+        av = _mm512_set1_pd(a[6]);
+        c60 = _mm512_fmadd_pd(av, b0, c60); c61 = _mm512_fmadd_pd(av, b1, c61);
+        av = _mm512_set1_pd(a[7]);
+        c70 = _mm512_fmadd_pd(av, b0, c70); c71 = _mm512_fmadd_pd(av, b1, c71);
+        a += AVX512_F64_MR;
+        b += AVX512_F64_NR;
+    }
+
+#define AVX512F64MICRO_STORE(row, v0, v1)                                      \
+    {                                                                          \
+        double* out = C + static_cast<std::size_t>(row) * ldc;                 \
+        if (accumulate) {                                                      \
+            v0 = _mm512_add_pd(v0, _mm512_loadu_pd(out));                      \
+            v1 = _mm512_add_pd(v1, _mm512_loadu_pd(out + 8));                  \
+        }                                                                      \
+        _mm512_storeu_pd(out, v0);                                             \
+        _mm512_storeu_pd(out + 8, v1);                                         \
+    }
+    AVX512F64MICRO_STORE(0, c00, c01)
+    AVX512F64MICRO_STORE(1, c10, c11)
+    AVX512F64MICRO_STORE(2, c20, c21)
+    AVX512F64MICRO_STORE(3, c30, c31)
+    AVX512F64MICRO_STORE(4, c40, c41)
+    AVX512F64MICRO_STORE(5, c50, c51)
+    AVX512F64MICRO_STORE(6, c60, c61)
+    AVX512F64MICRO_STORE(7, c70, c71)
+#undef AVX512F64MICRO_STORE
+}
+
+MATHLIB_X86_BINARY(avx512F32Add, "avx512f", float, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_add_ps, +)
+MATHLIB_X86_BINARY(avx512F32Sub, "avx512f", float, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_sub_ps, -)
+MATHLIB_X86_BINARY(avx512F32Mul, "avx512f", float, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_mul_ps, *)
+MATHLIB_X86_SCALE(avx512F32Scale, "avx512f", float, __m512, 16, _mm512_set1_ps, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_mul_ps)
+MATHLIB_X86_AXPY(avx512F32Axpy, "avx512f", float, __m512, 16, _mm512_set1_ps, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_fmadd_ps)
+MATHLIB_X86_BATCH(avx512F32Batch, "avx512f", float, __m512, 16, _mm512_setzero_ps, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_fmadd_ps)
+MATHLIB_X86_GEMV(avx512F32Gemv, "avx512f", float, __m512, 16, _mm512_setzero_ps, _mm512_loadu_ps, _mm512_fmadd_ps, avx512HsumPs)
+
+const int AVX512_F32_MR = 8;
+const int AVX512_F32_NR = 32;
+
+MATHLIB_TARGET("avx512f")
+void avx512F32Micro(int kb, const float* a, const float* b,
+                    float* C, int ldc, bool accumulate) {
+    __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+    __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+    __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+    __m512 c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+
+    for (int p = 0; p < kb; ++p) {
+        __m512 b0 = _mm512_loadu_ps(b);
+        __m512 b1 = _mm512_loadu_ps(b + 16);
+        __m512 av;
+        av = _mm512_set1_ps(a[0]);
+        c00 = _mm512_fmadd_ps(av, b0, c00); c01 = _mm512_fmadd_ps(av, b1, c01);
+        av = _mm512_set1_ps(a[1]);
+        c10 = _mm512_fmadd_ps(av, b0, c10); c11 = _mm512_fmadd_ps(av, b1, c11);
+        av = _mm512_set1_ps(a[2]);
+        c20 = _mm512_fmadd_ps(av, b0, c20); c21 = _mm512_fmadd_ps(av, b1, c21);
+        av = _mm512_set1_ps(a[3]);
+        c30 = _mm512_fmadd_ps(av, b0, c30); c31 = _mm512_fmadd_ps(av, b1, c31);
+        av = _mm512_set1_ps(a[4]);
+        c40 = _mm512_fmadd_ps(av, b0, c40); c41 = _mm512_fmadd_ps(av, b1, c41);
+        av = _mm512_set1_ps(a[5]);
+        c50 = _mm512_fmadd_ps(av, b0, c50); c51 = _mm512_fmadd_ps(av, b1, c51);
+        av = _mm512_set1_ps(a[6]);
+        c60 = _mm512_fmadd_ps(av, b0, c60); c61 = _mm512_fmadd_ps(av, b1, c61);
+        av = _mm512_set1_ps(a[7]);
+        c70 = _mm512_fmadd_ps(av, b0, c70); c71 = _mm512_fmadd_ps(av, b1, c71);
+        a += AVX512_F32_MR;
+        b += AVX512_F32_NR;
+    }
+
+#define AVX512F32MICRO_STORE(row, v0, v1)                                      \
+    {                                                                          \
+        float* out = C + static_cast<std::size_t>(row) * ldc;                  \
+        if (accumulate) {                                                      \
+            v0 = _mm512_add_ps(v0, _mm512_loadu_ps(out));                      \
+            v1 = _mm512_add_ps(v1, _mm512_loadu_ps(out + 16));                 \
+        }                                                                      \
+        _mm512_storeu_ps(out, v0);                                             \
+        _mm512_storeu_ps(out + 16, v1);                                        \
+    }
+    AVX512F32MICRO_STORE(0, c00, c01)
+    AVX512F32MICRO_STORE(1, c10, c11)
+    AVX512F32MICRO_STORE(2, c20, c21)
+    AVX512F32MICRO_STORE(3, c30, c31)
+    AVX512F32MICRO_STORE(4, c40, c41)
+    AVX512F32MICRO_STORE(5, c50, c51)
+    AVX512F32MICRO_STORE(6, c60, c61)
+    AVX512F32MICRO_STORE(7, c70, c71)
+#undef AVX512F32MICRO_STORE
+}
+
+} // namespace
+
+const KernelTableT<double>& sse2_kernels_f64() {
+    static const KernelTableT<double> table = {
+        SIMD_SSE2, sse2F64Add, sse2F64Sub, sse2F64Mul, sse2F64Scale, sse2F64Axpy,
+        sse2F64Micro, SSE2_F64_MR, SSE2_F64_NR, sse2F64Batch, 2, sse2F64Gemv
+    };
+    return table;
+}
+
+const KernelTableT<float>& sse2_kernels_f32() {
+    static const KernelTableT<float> table = {
+        SIMD_SSE2, sse2F32Add, sse2F32Sub, sse2F32Mul, sse2F32Scale, sse2F32Axpy,
+        sse2F32Micro, SSE2_F32_MR, SSE2_F32_NR, sse2F32Batch, 4, sse2F32Gemv
+    };
+    return table;
+}
+
+const KernelTableT<double>& avx2_kernels_f64() {
+    static const KernelTableT<double> table = {
+        SIMD_AVX2, avx2F64Add, avx2F64Sub, avx2F64Mul, avx2F64Scale, avx2F64Axpy,
+        avx2F64Micro, AVX2_F64_MR, AVX2_F64_NR, avx2F64Batch, 4, avx2F64Gemv
+    };
+    return table;
+}
+
+const KernelTableT<float>& avx2_kernels_f32() {
+    static const KernelTableT<float> table = {
+        SIMD_AVX2, avx2F32Add, avx2F32Sub, avx2F32Mul, avx2F32Scale, avx2F32Axpy,
+        avx2F32Micro, AVX2_F32_MR, AVX2_F32_NR, avx2F32Batch, 8, avx2F32Gemv
+    };
+    return table;
+}
+
+const KernelTableT<double>& avx512_kernels_f64() {
+    static const KernelTableT<double> table = {
+        SIMD_AVX512, avx512F64Add, avx512F64Sub, avx512F64Mul, avx512F64Scale, avx512F64Axpy,
+        avx512F64Micro, AVX512_F64_MR, AVX512_F64_NR, avx512F64Batch, 8, avx512F64Gemv
+    };
+    return table;
+}
+
+const KernelTableT<float>& avx512_kernels_f32() {
+    static const KernelTableT<float> table = {
+        SIMD_AVX512, avx512F32Add, avx512F32Sub, avx512F32Mul, avx512F32Scale, avx512F32Axpy,
+        avx512F32Micro, AVX512_F32_MR, AVX512_F32_NR, avx512F32Batch, 16, avx512F32Gemv
+    };
+    return table;
+}
+
+} // namespace mathlib
+
+#endif
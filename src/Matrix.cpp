@@ -13,8 +13,88 @@
  */
 
 #include "Matrix.h"
+#include "Gemm.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include "KernelsInternal.h"
+#include "Transpose.h"
+#include "Profiling.h"
+#include "MatrixText.h"
+#include "Vector.h"
+#include <atomic>
 #include <iostream>
+#include <new>
 #include <stdexcept>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+/// Cabecera que precede a los elementos con el contador de referencias (mantiene la alineación)
+const std::size_t HEADER_BYTES = mathlib::MATRIX_ALIGNMENT;
+
+static_assert(sizeof(std::atomic<int>) <= HEADER_BYTES, "Matrix - El contador no cabe en la cabecera");
+
+/**
+ * @brief Reserva count elementos con alloc, con el contador de referencias a 1
+ *
+ * Con MATHLIB_PROFILING cuenta la reserva (sin la cabecera).
+ */
+template <class T>
+T* allocateElements(mathlib::MatrixAllocator& alloc, std::size_t count) {
+    MATHLIB_PROFILE_ALLOCATION(count * sizeof(T));
+    char* block = static_cast<char*>(alloc.allocate(HEADER_BYTES + count * sizeof(T)));
+    new (block) std::atomic<int>(1);
+    return reinterpret_cast<T*>(block + HEADER_BYTES);
+}
+
+/// Añade una matriz a las que comparten el bloque de elements
+template <class T>
+void retainElements(T* elements) {
+    reinterpret_cast<std::atomic<int>*>(reinterpret_cast<char*>(elements) - HEADER_BYTES)
+        ->fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Quita una matriz de las que comparten el bloque y lo libera si era la última
+ *
+ * El decremento es acquire-release: la matriz que libera el bloque ve
+ * todas las lecturas y escrituras que hicieron las demás antes de soltarlo.
+ */
+template <class T>
+void releaseElements(mathlib::MatrixAllocator& alloc, T* elements, std::size_t count) {
+    if (elements == NULL) {
+        return;
+    }
+    char* block = reinterpret_cast<char*>(elements) - HEADER_BYTES;
+    std::atomic<int>* references = reinterpret_cast<std::atomic<int>*>(block);
+    if (references->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        typedef std::atomic<int> Counter;
+        references->~Counter();
+        alloc.deallocate(block, HEADER_BYTES + count * sizeof(T));
+    }
+}
+
+/// Escribe la matriz en std::cout con el formato por defecto de operator<<
+template <class T>
+void printMatrix(const BasicMatrix<T>& m) {
+    mathlib::TextFormat format(' ');
+    format.precision = 6;
+    mathlib::write_text(m, std::cout, format);
+}
+
+/// Los complejos no tienen formato de texto propio y usan operator<<
+void printMatrix(const BasicMatrix<std::complex<double> >& m) {
+    for (int i = 0; i < m.num_rows(); ++i) {
+        for (int j = 0; j < m.num_cols(); ++j) {
+            std::cout << m(i, j) << " ";
+        }
+        std::cout << "\n";
+    }
+}
+
+} // namespace
 
 /**
  * @brief Constructor - Crea una matriz de dimensiones específicas inicializada con ceros
@@ -28,14 +108,243 @@
  * 
  * @throws std::invalid_argument Si r <= 0 o c <= 0
  */
-Matrix::Matrix(int r, int c) : rows(r), cols(c) {
+template <class T>
+BasicMatrix<T>::BasicMatrix(int r, int c)
+    : elements(NULL), rows(r), cols(c), ld(c), allocator(&mathlib::current_allocator()) {
     // Validar dimensiones positivas
     if (r <= 0 || c <= 0) {
         throw std::invalid_argument("Matrix::Matrix - Las dimensiones deben ser positivas");
     }
     
-    // Inicializar la matriz con ceros
-    data.resize(rows, std::vector<double>(cols, 0.0));
+    // Reservar un único bloque contiguo e inicializarlo con ceros
+    std::size_t count = static_cast<std::size_t>(rows) * ld;
+    elements = allocateElements<T>(*allocator, count);
+    std::fill(elements, elements + count, T());
+}
+
+/**
+ * @brief Constructor con asignador explícito
+ * 
+ * @param r Número de filas
+ * @param c Número de columnas
+ * @param alloc Asignador del que se obtiene el bloque de datos
+ * 
+ * @throws std::invalid_argument Si r <= 0 o c <= 0
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(int r, int c, mathlib::MatrixAllocator& alloc)
+    : elements(NULL), rows(r), cols(c), ld(c), allocator(&alloc) {
+    if (r <= 0 || c <= 0) {
+        throw std::invalid_argument("Matrix::Matrix - Las dimensiones deben ser positivas");
+    }
+    std::size_t count = static_cast<std::size_t>(rows) * ld;
+    elements = allocateElements<T>(*allocator, count);
+    std::fill(elements, elements + count, T());
+}
+
+template <class T>
+const typename BasicMatrix<T>::Uninitialized BasicMatrix<T>::UNINITIALIZED =
+    typename BasicMatrix<T>::Uninitialized();
+
+/**
+ * @brief Constructor sin inicialización - Reserva el bloque sin llenarlo
+ * 
+ * @param r Número de filas
+ * @param c Número de columnas
+ * 
+ * @throws std::invalid_argument Si r <= 0 o c <= 0
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(int r, int c, Uninitialized)
+    : elements(NULL), rows(r), cols(c), ld(c), allocator(&mathlib::current_allocator()) {
+    if (r <= 0 || c <= 0) {
+        throw std::invalid_argument("Matrix::Matrix - Las dimensiones deben ser positivas");
+    }
+    elements = allocateElements<T>(*allocator, static_cast<std::size_t>(rows) * ld);
+}
+
+/**
+ * @brief Constructor sin inicialización con asignador explícito
+ * 
+ * @param r Número de filas
+ * @param c Número de columnas
+ * @param alloc Asignador del que se obtiene el bloque de datos
+ * 
+ * @throws std::invalid_argument Si r <= 0 o c <= 0
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(int r, int c, Uninitialized, mathlib::MatrixAllocator& alloc)
+    : elements(NULL), rows(r), cols(c), ld(c), allocator(&alloc) {
+    if (r <= 0 || c <= 0) {
+        throw std::invalid_argument("Matrix::Matrix - Las dimensiones deben ser positivas");
+    }
+    elements = allocateElements<T>(*allocator, static_cast<std::size_t>(rows) * ld);
+}
+
+/**
+ * @brief Constructor de copia - Comparte el bloque de datos de otra matriz
+ *
+ * @param other Matriz a copiar
+ *
+ * El bloque solo se comparte si other lo reservó con el asignador actual
+ * del hilo; si no, se duplica con el asignador actual: así una copia
+ * hecha fuera de un AllocationScope sobrevive al reset() de la arena de
+ * la que proviene el original.
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& other)
+    : elements(NULL), rows(other.rows), cols(other.cols), ld(other.ld),
+      allocator(&mathlib::current_allocator()) {
+    std::size_t count = static_cast<std::size_t>(rows) * ld;
+    if (other.elements == NULL) {
+        return;
+    }
+    if (other.allocator == allocator) {
+        retainElements(other.elements);
+        elements = other.elements;
+    } else {
+        elements = allocateElements<T>(*allocator, count);
+        std::memcpy(elements, other.elements, count * sizeof(T));
+    }
+}
+
+/**
+ * @brief Copia profunda en un bloque reservado con el asignador actual del hilo
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::clone() const {
+    BasicMatrix copy(*this);
+    copy.make_unique();
+    return copy;
+}
+
+/**
+ * @brief Pasa a un bloque propio, reservado con el asignador de la matriz
+ *
+ * Todas las matrices que comparten un bloque tienen el mismo asignador,
+ * de modo que el bloque anterior se suelta con el asignador propio.
+ */
+template <class T>
+void BasicMatrix<T>::detach(bool keep) {
+    std::size_t count = static_cast<std::size_t>(rows) * ld;
+    T* fresh = allocateElements<T>(*allocator, count);
+    if (keep) {
+        std::memcpy(fresh, elements, count * sizeof(T));
+    }
+    releaseElements(*allocator, elements, count);
+    elements = fresh;
+}
+
+/**
+ * @brief Asignación por copia
+ *
+ * @param other Matriz a copiar
+ * @return BasicMatrix& Referencia a esta matriz
+ *
+ * Si other usa el mismo asignador se comparte su bloque. En otro caso la
+ * matriz conserva su propio asignador y copia los elementos: reutiliza
+ * el bloque actual si es propio y tiene el mismo número de elementos, y
+ * si no reserva uno nuevo antes de soltar el anterior, de modo que la
+ * matriz queda intacta si la reserva lanza una excepción.
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const BasicMatrix& other) {
+    if (this == &other || elements == other.elements) {
+        return *this;
+    }
+
+    std::size_t oldCount = static_cast<std::size_t>(rows) * ld;
+    std::size_t count = static_cast<std::size_t>(other.rows) * other.ld;
+    if (other.allocator == allocator || other.elements == NULL) {
+        if (other.elements != NULL) {
+            retainElements(other.elements);
+        }
+        releaseElements(*allocator, elements, oldCount);
+        elements = other.elements;
+    } else if (count != oldCount || is_shared()) {
+        T* fresh = count > 0 ? allocateElements<T>(*allocator, count) : NULL;
+        releaseElements(*allocator, elements, oldCount);
+        elements = fresh;
+        std::memcpy(elements, other.elements, count * sizeof(T));
+    } else {
+        std::memcpy(elements, other.elements, count * sizeof(T));
+    }
+    rows = other.rows;
+    cols = other.cols;
+    ld = other.ld;
+    return *this;
+}
+
+/**
+ * @brief Constructor de movimiento - Transfiere el bloque sin copiarlo
+ *
+ * @param other Matriz de origen, que queda vacía (0 x 0)
+ */
+template <class T>
+BasicMatrix<T>::BasicMatrix(BasicMatrix&& other) noexcept
+    : elements(other.elements), rows(other.rows), cols(other.cols), ld(other.ld),
+      allocator(other.allocator) {
+    other.elements = NULL;
+    other.rows = 0;
+    other.cols = 0;
+    other.ld = 0;
+}
+
+/**
+ * @brief Asignación por movimiento
+ *
+ * @param other Matriz de origen, que queda vacía (0 x 0)
+ * @return BasicMatrix& Referencia a esta matriz
+ *
+ * El bloque y su asignador se transfieren juntos, de modo que el bloque
+ * siempre se libera con el asignador que lo reservó.
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(BasicMatrix&& other) noexcept {
+    if (this != &other) {
+        releaseElements(*allocator, elements, static_cast<std::size_t>(rows) * ld);
+        elements = other.elements;
+        rows = other.rows;
+        cols = other.cols;
+        ld = other.ld;
+        allocator = other.allocator;
+        other.elements = NULL;
+        other.rows = 0;
+        other.cols = 0;
+        other.ld = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor - Suelta el bloque de datos; la última matriz que lo comparte lo devuelve a su asignador
+ */
+template <class T>
+BasicMatrix<T>::~BasicMatrix() {
+    releaseElements(*allocator, elements, static_cast<std::size_t>(rows) * ld);
+}
+
+/**
+ * @brief Ajusta las dimensiones reutilizando el bloque si es posible
+ *
+ * @param r Nuevo número de filas
+ * @param c Nuevo número de columnas
+ *
+ * Un bloque compartido nunca se reutiliza: el contenido se va a
+ * sobrescribir y no debe verse desde las copias.
+ */
+template <class T>
+void BasicMatrix<T>::reshapeUninitialized(int r, int c) {
+    std::size_t count = static_cast<std::size_t>(r) * c;
+    std::size_t oldCount = static_cast<std::size_t>(rows) * ld;
+    if (count != oldCount || is_shared()) {
+        T* fresh = count > 0 ? allocateElements<T>(*allocator, count) : NULL;
+        releaseElements(*allocator, elements, oldCount);
+        elements = fresh;
+    }
+    rows = r;
+    cols = c;
+    ld = c;
 }
 
 /**
@@ -43,7 +352,7 @@ Matrix::Matrix(int r, int c) : rows(r), cols(c) {
  * 
  * @param r Índice de fila
  * @param c Índice de columna
- * @return double Valor en la posición (r, c)
+ * @return T Valor en la posición (r, c)
  * 
  * Accede al elemento en la posición (r, c) de la matriz utilizando
  * índices base 0. Realiza validación completa de límites antes de
@@ -51,12 +360,13 @@ Matrix::Matrix(int r, int c) : rows(r), cols(c) {
  * 
  * @throws std::out_of_range Si r < 0, r >= rows, c < 0, o c >= cols
  */
-double Matrix::get(int r, int c) const {
+template <class T>
+T BasicMatrix<T>::get(int r, int c) const {
     // Validar índices
     if (r < 0 || r >= rows || c < 0 || c >= cols) {
         throw std::out_of_range("Matrix::get - Índice fuera de rango");
     }
-    return data[r][c];
+    return elements[static_cast<std::size_t>(r) * ld + c];
 }
 
 /**
@@ -72,84 +382,505 @@ double Matrix::get(int r, int c) const {
  * 
  * @throws std::out_of_range Si r < 0, r >= rows, c < 0, o c >= cols
  */
-void Matrix::set(int r, int c, double value) {
+template <class T>
+void BasicMatrix<T>::set(int r, int c, T value) {
     // Validar índices
     if (r < 0 || r >= rows || c < 0 || c >= cols) {
         throw std::out_of_range("Matrix::set - Índice fuera de rango");
     }
-    data[r][c] = value;
+    make_unique();
+    elements[static_cast<std::size_t>(r) * ld + c] = value;
+}
+
+/**
+ * @brief Asigna el mismo valor a todos los elementos
+ * 
+ * @param value Valor a asignar
+ * @return BasicMatrix& Referencia a esta matriz
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::fill(T value) {
+    // Se sobrescribe todo: un bloque compartido no hace falta copiarlo
+    if (is_shared()) {
+        detach(false);
+    }
+    for (int i = 0; i < rows; ++i) {
+        T* row = elements + static_cast<std::size_t>(i) * ld;
+        std::fill(row, row + cols, value);
+    }
+    return *this;
+}
+
+/**
+ * @brief Copia todos los elementos desde un buffer contiguo por filas
+ * 
+ * @param src Buffer de origen
+ * @return BasicMatrix& Referencia a esta matriz
+ * 
+ * @throws std::invalid_argument Si src es NULL
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::assign(const T* src) {
+    return assign(src, cols);
+}
+
+/**
+ * @brief Copia todos los elementos desde un buffer con separación entre filas
+ * 
+ * @param src Buffer de origen
+ * @param src_stride Separación entre filas de src
+ * @return BasicMatrix& Referencia a esta matriz
+ * 
+ * Si origen y destino son contiguos se copia todo con una sola llamada
+ * a memcpy; en otro caso, fila por fila.
+ * 
+ * @throws std::invalid_argument Si src es NULL o src_stride < cols
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::assign(const T* src, int src_stride) {
+    if (src == NULL) {
+        throw std::invalid_argument("Matrix::assign - El buffer de origen es nulo");
+    }
+    if (src_stride < cols) {
+        throw std::invalid_argument("Matrix::assign - La separación entre filas es menor que el número de columnas");
+    }
+    // Se sobrescribe todo; si src está en el bloque compartido, las copias lo mantienen vivo
+    if (is_shared()) {
+        detach(false);
+    }
+    
+    if (src_stride == cols && ld == cols) {
+        std::memcpy(elements, src, static_cast<std::size_t>(rows) * cols * sizeof(T));
+        return *this;
+    }
+    for (int i = 0; i < rows; ++i) {
+        std::memcpy(elements + static_cast<std::size_t>(i) * ld,
+                    src + static_cast<std::size_t>(i) * src_stride,
+                    static_cast<std::size_t>(cols) * sizeof(T));
+    }
+    return *this;
 }
 
 /**
  * @brief Suma esta matriz con otra matriz
  * 
  * @param other Matriz a sumar
- * @return Matrix Nueva matriz resultante
+ * @return BasicMatrix Nueva matriz resultante
  * 
  * Realiza la suma elemento por elemento entre esta matriz y la
  * matriz proporcionada como parámetro. Ambas matrices deben
  * tener exactamente las mismas dimensiones (mismo número de
  * filas y mismo número de columnas).
  * 
+ * La operación usa el kernel vectorizado elegido al arrancar
+ * (véase Kernels.h).
+ * 
  * Complejidad temporal: O(n²) donde n es el número de elementos
  * 
  * @throws std::invalid_argument Si rows != other.rows o cols != other.cols
  */
-Matrix Matrix::add(const Matrix& other) const {
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::add(const BasicMatrix& other) const {
     // Verificar dimensiones compatibles
     if (rows != other.rows || cols != other.cols) {
         throw std::invalid_argument("Matrix::add - Las matrices deben tener el mismo tamaño");
     }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_ADD, rows, cols, 0, static_cast<double>(rows) * cols);
     
     // Crear matriz resultado
-    Matrix result(rows, cols);
+    BasicMatrix result(rows, cols, UNINITIALIZED);
+    
+    // Realizar suma elemento por elemento con el kernel SIMD activo
+    mathlib::apply_elementwise<T>(mathlib::vec_add, rows, cols, elements, ld,
+                                  other.elements, other.ld, result.elements, result.ld);
+    
+    return result;
+}
+
+/**
+ * @brief Suma otra matriz sobre esta
+ * 
+ * @param other Matriz a sumar
+ * @return BasicMatrix& Referencia a esta matriz
+ * 
+ * El resultado se escribe en el propio bloque de datos, sin reservar
+ * memoria adicional.
+ * 
+ * @throws std::invalid_argument Si rows != other.rows o cols != other.cols
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::add_inplace(const BasicMatrix& other) {
+    if (rows != other.rows || cols != other.cols) {
+        throw std::invalid_argument("Matrix::add_inplace - Las matrices deben tener el mismo tamaño");
+    }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_ADD, rows, cols, 0, static_cast<double>(rows) * cols);
+    
+    make_unique();
+    mathlib::apply_elementwise<T>(mathlib::vec_add, rows, cols, elements, ld,
+                                  other.elements, other.ld, elements, ld);
+    return *this;
+}
+
+/**
+ * @brief Resta otra matriz sobre esta
+ * 
+ * @param other Matriz a restar
+ * @return BasicMatrix& Referencia a esta matriz
+ * 
+ * @throws std::invalid_argument Si rows != other.rows o cols != other.cols
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::subtract_inplace(const BasicMatrix& other) {
+    if (rows != other.rows || cols != other.cols) {
+        throw std::invalid_argument("Matrix::subtract_inplace - Las matrices deben tener el mismo tamaño");
+    }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_SUBTRACT, rows, cols, 0, static_cast<double>(rows) * cols);
     
-    // Realizar suma elemento por elemento
+    make_unique();
+    mathlib::apply_elementwise<T>(mathlib::vec_sub, rows, cols, elements, ld,
+                                  other.elements, other.ld, elements, ld);
+    return *this;
+}
+
+/**
+ * @brief Multiplica todos los elementos por un escalar sobre esta matriz
+ * 
+ * @param alpha Factor de escala
+ * @return BasicMatrix& Referencia a esta matriz
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(T alpha) {
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_SCALE, rows, cols, 0, static_cast<double>(rows) * cols);
+    make_unique();
     for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            result.data[i][j] = data[i][j] + other.data[i][j];
-        }
+        T* row = elements + static_cast<std::size_t>(i) * ld;
+        mathlib::vec_scale(static_cast<std::size_t>(cols), alpha, row, row);
+    }
+    return *this;
+}
+
+/**
+ * @brief Resta a esta matriz otra matriz
+ * 
+ * @param other Matriz a restar
+ * @return BasicMatrix Nueva matriz resultante
+ * 
+ * @throws std::invalid_argument Si rows != other.rows o cols != other.cols
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::subtract(const BasicMatrix& other) const {
+    if (rows != other.rows || cols != other.cols) {
+        throw std::invalid_argument("Matrix::subtract - Las matrices deben tener el mismo tamaño");
     }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_SUBTRACT, rows, cols, 0, static_cast<double>(rows) * cols);
     
+    BasicMatrix result(rows, cols, UNINITIALIZED);
+    mathlib::apply_elementwise<T>(mathlib::vec_sub, rows, cols, elements, ld,
+                                  other.elements, other.ld, result.elements, result.ld);
     return result;
 }
 
+/**
+ * @brief Producto elemento a elemento (Hadamard)
+ * 
+ * @param other Matriz con las mismas dimensiones
+ * @return BasicMatrix Nueva matriz resultante
+ * 
+ * @throws std::invalid_argument Si rows != other.rows o cols != other.cols
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::hadamard(const BasicMatrix& other) const {
+    if (rows != other.rows || cols != other.cols) {
+        throw std::invalid_argument("Matrix::hadamard - Las matrices deben tener el mismo tamaño");
+    }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_HADAMARD, rows, cols, 0, static_cast<double>(rows) * cols);
+    
+    BasicMatrix result(rows, cols, UNINITIALIZED);
+    mathlib::apply_elementwise<T>(mathlib::vec_mul, rows, cols, elements, ld,
+                                  other.elements, other.ld, result.elements, result.ld);
+    return result;
+}
+
+/**
+ * @brief Multiplica todos los elementos por un escalar
+ * 
+ * @param alpha Factor de escala
+ * @return BasicMatrix Nueva matriz resultante
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::scale(T alpha) const {
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_SCALE, rows, cols, 0, static_cast<double>(rows) * cols);
+    BasicMatrix result(rows, cols, UNINITIALIZED);
+    for (int i = 0; i < rows; ++i) {
+        mathlib::vec_scale(static_cast<std::size_t>(cols), alpha,
+                           elements + static_cast<std::size_t>(i) * ld,
+                           result.elements + static_cast<std::size_t>(i) * result.ld);
+    }
+    return result;
+}
+
+/**
+ * @brief Transpuesta de la matriz
+ * 
+ * @return BasicMatrix Nueva matriz de cols x rows
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::transpose() const {
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_TRANSPOSE, cols, rows, 0, 0.0);
+    BasicMatrix result(cols, rows, UNINITIALIZED);
+    mathlib::transpose(rows, cols, elements, ld, result.elements, result.ld);
+    return result;
+}
+
+/**
+ * @brief Transpone en el sitio una matriz cuadrada
+ * 
+ * @throws std::invalid_argument Si rows != cols
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::transpose_inplace() {
+    if (rows != cols) {
+        throw std::invalid_argument("Matrix::transpose_inplace - La matriz debe ser cuadrada");
+    }
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_TRANSPOSE, rows, cols, 0, 0.0);
+    make_unique();
+    mathlib::transpose_inplace(rows, elements, ld);
+    return *this;
+}
+
 /**
  * @brief Multiplica esta matriz por otra matriz
  * 
  * @param other Matriz a multiplicar
- * @return Matrix Nueva matriz resultante
+ * @param policy Política de ejecución
+ * @return BasicMatrix Nueva matriz resultante
  * 
  * Realiza la multiplicación matricial estándar entre esta matriz
  * y la matriz proporcionada. El número de columnas de esta matriz
  * debe coincidir con el número de filas de la otra matriz.
  * La matriz resultante tendrá dimensiones: rows x other.cols
  * 
+ * El resultado se reserva sin inicializar y se calcula con
+ * multiply_into().
+ * 
  * Complejidad temporal: O(n³) para matrices cuadradas n x n
  * 
  * @throws std::invalid_argument Si cols != other.rows
  */
-Matrix Matrix::multiply(const Matrix& other) const {
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::multiply(const BasicMatrix& other, mathlib::ExecutionPolicy policy) const {
     // Verificar dimensiones compatibles para multiplicación
     if (cols != other.rows) {
         throw std::invalid_argument("Matrix::multiply - Dimensiones incompatibles");
     }
     
-    // Crear matriz resultado (rows x other.cols)
-    Matrix result(rows, other.cols);
+    // Crear matriz resultado (rows x other.cols) sin llenarla de ceros
+    BasicMatrix result(rows, other.cols, UNINITIALIZED);
+    multiply_into(other, result, policy);
+    return result;
+}
+
+/**
+ * @brief Multiplica esta matriz por otra con el algoritmo indicado
+ * 
+ * @throws std::invalid_argument Si cols != other.rows
+ */
+template <class T>
+BasicMatrix<T> BasicMatrix<T>::multiply(const BasicMatrix& other, const mathlib::MultiplyOptions& options) const {
+    const bool ta = options.trans_a == mathlib::TRANS;
+    const bool tb = options.trans_b == mathlib::TRANS;
+    if ((ta ? rows : cols) != (tb ? other.cols : other.rows)) {
+        throw std::invalid_argument("Matrix::multiply - Dimensiones incompatibles");
+    }
     
-    // Algoritmo de multiplicación de matrices
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < other.cols; ++j) {
-            double sum = 0.0;
-            for (int k = 0; k < cols; ++k) {
-                sum += data[i][k] * other.data[k][j];
-            }
-            result.data[i][j] = sum;
+    BasicMatrix result(ta ? cols : rows, tb ? other.rows : other.cols, UNINITIALIZED);
+    multiply_into(other, result, options);
+    return result;
+}
+
+/**
+ * @brief Calcula out = this × other reutilizando el bloque de out
+ * 
+ * @param other Matriz a multiplicar
+ * @param out Matriz destino
+ * @param policy Política de ejecución
+ * 
+ * El cálculo se delega en mathlib::gemm(), que usa un kernel empaquetado
+ * por bloques con micro-kernel de registros para tamaños medianos y
+ * grandes, y el triple bucle de referencia para matrices pequeñas. Con
+ * mathlib::PARALLEL se usa mathlib::gemm_parallel() sobre el grupo de
+ * hilos global.
+ * 
+ * @throws std::invalid_argument Si cols != other.rows
+ */
+template <class T>
+void BasicMatrix<T>::multiply_into(const BasicMatrix& other, BasicMatrix& out,
+                           mathlib::ExecutionPolicy policy) const {
+    multiply_into(other, out, mathlib::MultiplyOptions(policy));
+}
+
+/**
+ * @brief Calcula out = this × other con el algoritmo indicado
+ * 
+ * @param other Matriz a multiplicar
+ * @param out Matriz destino
+ * @param options Algoritmo, umbral y política de ejecución
+ * 
+ * Con mathlib::MULTIPLY_STRASSEN el cálculo se delega en
+ * mathlib::gemm_strassen(), que reserva su espacio de trabajo una vez.
+ * Las transposiciones se pasan a mathlib::gemm(), que las resuelve al
+ * empaquetar los paneles.
+ * 
+ * @throws std::invalid_argument Si las dimensiones de op(this) y op(other)
+ *         son incompatibles o el umbral no es positivo
+ */
+template <class T>
+void BasicMatrix<T>::multiply_into(const BasicMatrix& other, BasicMatrix& out,
+                           const mathlib::MultiplyOptions& options) const {
+    // Dimensiones de op(this) (m x k) y op(other) (k x n)
+    const int m = options.trans_a == mathlib::TRANS ? cols : rows;
+    const int k = options.trans_a == mathlib::TRANS ? rows : cols;
+    const int n = options.trans_b == mathlib::TRANS ? other.rows : other.cols;
+    if (k != (options.trans_b == mathlib::TRANS ? other.cols : other.rows)) {
+        throw std::invalid_argument("Matrix::multiply_into - Dimensiones incompatibles");
+    }
+    if (options.algorithm == mathlib::MULTIPLY_STRASSEN && options.strassen_crossover < 1) {
+        throw std::invalid_argument("Matrix::multiply_into - El umbral de Strassen debe ser positivo");
+    }
+    
+    // El kernel no admite que el destino se solape con un operando
+    if (&out == this || &out == &other) {
+        BasicMatrix temp(m, n, UNINITIALIZED);
+        multiply_into(other, temp, options);
+        out = std::move(temp);
+        return;
+    }
+    
+    if (options.algorithm == mathlib::MULTIPLY_STRASSEN &&
+        (options.trans_a == mathlib::TRANS || options.trans_b == mathlib::TRANS)) {
+        // La recursión divide los operandos en bloques por filas: se
+        // transponen antes una sola vez
+        mathlib::MultiplyOptions plain(options);
+        plain.trans_a = mathlib::NO_TRANS;
+        plain.trans_b = mathlib::NO_TRANS;
+        if (options.trans_a == mathlib::TRANS && options.trans_b == mathlib::TRANS) {
+            transpose().multiply_into(other.transpose(), out, plain);
+        } else if (options.trans_a == mathlib::TRANS) {
+            transpose().multiply_into(other, out, plain);
+        } else {
+            multiply_into(other.transpose(), out, plain);
         }
+        return;
     }
     
-    return result;
+    out.reshapeUninitialized(m, n);
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_MULTIPLY, m, n, k, 2.0 * m * n * k);
+    
+    if (options.algorithm == mathlib::MULTIPLY_STRASSEN) {
+        mathlib::gemm_strassen(m, n, k,
+                               elements, ld,
+                               other.elements, other.ld,
+                               out.elements, out.ld,
+                               options.strassen_crossover, static_cast<T*>(nullptr),
+                               options.policy);
+        return;
+    }
+    
+    // Producto por bloques sobre los buffers contiguos
+    if (options.policy == mathlib::PARALLEL) {
+        mathlib::gemm_parallel(options.trans_a, options.trans_b, m, n, k,
+                               elements, ld,
+                               other.elements, other.ld,
+                               out.elements, out.ld,
+                               mathlib::ThreadPool::global());
+    } else {
+        mathlib::gemm(options.trans_a, options.trans_b, m, n, k,
+                      elements, ld,
+                      other.elements, other.ld,
+                      out.elements, out.ld);
+    }
+}
+
+/**
+ * @brief Producto matriz-vector this × x
+ * 
+ * @throws std::invalid_argument Si x.size() != cols
+ */
+template <class T>
+mathlib::BasicVector<T> BasicMatrix<T>::multiply(const mathlib::BasicVector<T>& x,
+                                                 mathlib::ExecutionPolicy policy) const {
+    mathlib::BasicVector<T> y(rows, UNINITIALIZED);
+    multiply_into(x, y, policy);
+    return y;
+}
+
+/**
+ * @brief Calcula y = this × x sin reservar memoria
+ * 
+ * @throws std::invalid_argument Si x.size() != cols o y.size() != rows
+ */
+template <class T>
+void BasicMatrix<T>::multiply_into(const mathlib::BasicVector<T>& x, mathlib::BasicVector<T>& y,
+                                   mathlib::ExecutionPolicy policy) const {
+    if (x.size() != cols || y.size() != rows) {
+        throw std::invalid_argument("Matrix::multiply_into - Dimensiones incompatibles para el producto por vector");
+    }
+    mathlib::gemv(T(1), *this, x, T(), y, mathlib::NO_TRANS, policy);
+}
+
+/**
+ * @brief Producto fusionado this = epilogue(alpha · op(A) × op(B) + beta · this)
+ * 
+ * Si esta matriz es uno de los operandos, ese operando se copia antes:
+ * el kernel escribe C mientras lee A y B.
+ * 
+ * @throws std::invalid_argument Si las dimensiones son incompatibles, si
+ *         se pide Strassen o ReLU con complejos
+ */
+template <class T>
+BasicMatrix<T>& BasicMatrix<T>::gemm(T alpha, const BasicMatrix& A, const BasicMatrix& B, T beta,
+                                     const mathlib::MultiplyOptions& options,
+                                     const mathlib::GemmEpilogue<T>& epilogue) {
+    const int m = options.trans_a == mathlib::TRANS ? A.cols : A.rows;
+    const int k = options.trans_a == mathlib::TRANS ? A.rows : A.cols;
+    const int n = options.trans_b == mathlib::TRANS ? B.rows : B.cols;
+    if (k != (options.trans_b == mathlib::TRANS ? B.cols : B.rows)) {
+        throw std::invalid_argument("Matrix::gemm - Dimensiones incompatibles para multiplicación");
+    }
+    if (options.algorithm != mathlib::MULTIPLY_CLASSIC) {
+        throw std::invalid_argument("Matrix::gemm - El producto fusionado solo admite MULTIPLY_CLASSIC");
+    }
+    if (&A == this) {
+        BasicMatrix copy(A);
+        return gemm(alpha, copy, &B == this ? copy : B, beta, options, epilogue);
+    }
+    if (&B == this) {
+        BasicMatrix copy(B);
+        return gemm(alpha, A, copy, beta, options, epilogue);
+    }
+    
+    if (beta == T()) {
+        reshapeUninitialized(m, n);
+    } else if (rows != m || cols != n) {
+        throw std::invalid_argument("Matrix::gemm - La matriz destino no tiene el tamaño del producto");
+    } else {
+        make_unique();
+    }
+    
+    MATHLIB_PROFILE_SCOPE(mathlib::PROFILE_MULTIPLY, m, n, k, 2.0 * m * n * k);
+    if (options.policy == mathlib::PARALLEL) {
+        mathlib::gemm_parallel(options.trans_a, options.trans_b, m, n, k,
+                               alpha, A.elements, A.ld,
+                               B.elements, B.ld,
+                               beta, elements, ld,
+                               mathlib::ThreadPool::global(), epilogue);
+    } else {
+        mathlib::gemm(options.trans_a, options.trans_b, m, n, k,
+                      alpha, A.elements, A.ld,
+                      B.elements, B.ld,
+                      beta, elements, ld, epilogue);
+    }
+    return *this;
 }
 
 /**
@@ -157,14 +888,15 @@ Matrix Matrix::multiply(const Matrix& other) const {
  * 
  * Muestra la matriz en un formato legible con cada fila en
  * una línea separada y elementos separados por espacios.
- * Esta función está diseñada principalmente para debugging
- * y no debe usarse en producción para matrices muy grandes.
+ * Las filas se formatean por bloques con mathlib::write_text(); para
+ * volcar matrices grandes a un archivo es preferible mathlib::save_text().
  */
-void Matrix::print() const {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            std::cout << data[i][j] << " ";
-        }
-        std::cout << "\n";
-    }
-}
\ No newline at end of file
+template <class T>
+void BasicMatrix<T>::print() const {
+    printMatrix(*this);
+}
+
+template class BasicMatrix<float>;
+template class BasicMatrix<double>;
+template class BasicMatrix<int>;
+template class BasicMatrix<std::complex<double> >;
@@ -0,0 +1,502 @@
+/**
+ * @file MatrixFile.cpp
+ * @brief Implementación del formato binario de matrices y del mapeo en memoria
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * La cabecera se codifica campo a campo en un buffer de 64 bytes en lugar
+ * de volcar un struct, para que el formato no dependa del relleno ni del
+ * compilador.
+ */
+
+#include "MatrixFile.h"
+#include "Matrix.h"
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+/// Firma de los archivos de matriz
+const char MAGIC[8] = {'M', 'L', 'M', 'A', 'T', 'R', 'I', 'X'};
+
+const unsigned char ENDIAN_LITTLE = 1;
+const unsigned char ENDIAN_BIG = 2;
+
+/**
+ * @brief true si el equipo es little-endian
+ */
+bool nativeLittleEndian() {
+    const std::uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+/**
+ * @brief Escribe un entero sin signo de bytes bytes en el orden indicado
+ */
+void putUnsigned(unsigned char* buf, std::size_t offset, std::uint64_t value,
+                 std::size_t bytes, bool little) {
+    for (std::size_t i = 0; i < bytes; ++i) {
+        unsigned char b = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+        buf[offset + (little ? i : bytes - 1 - i)] = b;
+    }
+}
+
+/**
+ * @brief Lee un entero sin signo de bytes bytes en el orden indicado
+ */
+std::uint64_t getUnsigned(const unsigned char* buf, std::size_t offset,
+                          std::size_t bytes, bool little) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < bytes; ++i) {
+        std::uint64_t b = buf[offset + (little ? i : bytes - 1 - i)];
+        value |= b << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Tamaño en bytes de un elemento y de cada componente escalar
+ *
+ * El componente escalar determina la unidad de conversión del orden de
+ * bytes (un complex<double> son dos double).
+ */
+bool dtypeSizes(MatrixDType dtype, std::size_t& element, std::size_t& scalar) {
+    switch (dtype) {
+        case DTYPE_FLOAT32:    element = 4;  scalar = 4; return true;
+        case DTYPE_FLOAT64:    element = 8;  scalar = 8; return true;
+        case DTYPE_INT32:      element = 4;  scalar = 4; return true;
+        case DTYPE_COMPLEX128: element = 16; scalar = 8; return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Codifica la cabecera en el orden de bytes del equipo
+ */
+void encodeHeader(const MatrixFileInfo& info, unsigned char* buf) {
+    bool little = nativeLittleEndian();
+    std::memset(buf, 0, MATRIX_FILE_HEADER_BYTES);
+    std::memcpy(buf, MAGIC, sizeof(MAGIC));
+    putUnsigned(buf, 8, static_cast<std::uint64_t>(info.version), 2, little);
+    putUnsigned(buf, 10, static_cast<std::uint64_t>(info.dtype), 2, little);
+    buf[12] = little ? ENDIAN_LITTLE : ENDIAN_BIG;
+    buf[13] = static_cast<unsigned char>(info.element_size);
+    putUnsigned(buf, 16, info.alignment, 4, little);
+    putUnsigned(buf, 24, static_cast<std::uint64_t>(info.rows), 8, little);
+    putUnsigned(buf, 32, static_cast<std::uint64_t>(info.cols), 8, little);
+    putUnsigned(buf, 40, info.data_offset, 8, little);
+    putUnsigned(buf, 48, info.data_bytes, 8, little);
+}
+
+/**
+ * @brief Decodifica y valida una cabecera
+ *
+ * @param buf Primeros MATRIX_FILE_HEADER_BYTES bytes del archivo
+ * @param fileBytes Tamaño total del archivo
+ * @param where Prefijo de los mensajes de error
+ * @throws std::runtime_error Si la cabecera no es válida
+ */
+MatrixFileInfo decodeHeader(const unsigned char* buf, std::uint64_t fileBytes, const std::string& where) {
+    if (std::memcmp(buf, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error(where + " - El archivo no es una matriz MathLib");
+    }
+    if (buf[12] != ENDIAN_LITTLE && buf[12] != ENDIAN_BIG) {
+        throw std::runtime_error(where + " - Orden de bytes desconocido en la cabecera");
+    }
+    bool little = buf[12] == ENDIAN_LITTLE;
+
+    MatrixFileInfo info;
+    info.version = static_cast<int>(getUnsigned(buf, 8, 2, little));
+    info.dtype = static_cast<MatrixDType>(getUnsigned(buf, 10, 2, little));
+    info.little_endian = little;
+    info.element_size = buf[13];
+    info.alignment = static_cast<std::size_t>(getUnsigned(buf, 16, 4, little));
+    std::uint64_t rows = getUnsigned(buf, 24, 8, little);
+    std::uint64_t cols = getUnsigned(buf, 32, 8, little);
+    info.data_offset = getUnsigned(buf, 40, 8, little);
+    info.data_bytes = getUnsigned(buf, 48, 8, little);
+
+    if (info.version < 1 || info.version > MATRIX_FILE_VERSION) {
+        throw std::runtime_error(where + " - Versión de formato no soportada");
+    }
+    std::size_t element = 0;
+    std::size_t scalar = 0;
+    if (!dtypeSizes(info.dtype, element, scalar) || element != info.element_size) {
+        throw std::runtime_error(where + " - Tipo de elemento no válido");
+    }
+    if (rows > static_cast<std::uint64_t>(INT_MAX) || cols > static_cast<std::uint64_t>(INT_MAX)) {
+        throw std::runtime_error(where + " - Dimensiones fuera de rango");
+    }
+    info.rows = static_cast<int>(rows);
+    info.cols = static_cast<int>(cols);
+    // cols · element cabe en 64 bits (cols <= INT_MAX); rows · rowBytes
+    // solo se calcula sabiendo que no supera el tamaño del archivo
+    const std::uint64_t rowBytes = cols * element;
+    if (rowBytes != 0 && rows > fileBytes / rowBytes) {
+        throw std::runtime_error(where + " - El archivo está truncado");
+    }
+    if (info.data_bytes != rows * rowBytes) {
+        throw std::runtime_error(where + " - El tamaño de los datos no coincide con las dimensiones");
+    }
+    // Los datos se leen directamente desde el mapeo: el desplazamiento
+    // debe dejar cada elemento en su alineación natural
+    if (info.alignment == 0 || (info.alignment & (info.alignment - 1)) != 0 ||
+        info.data_offset < MATRIX_FILE_HEADER_BYTES ||
+        info.data_offset % info.alignment != 0 || info.data_offset % element != 0) {
+        throw std::runtime_error(where + " - Desplazamiento de los datos no válido");
+    }
+    if (info.data_offset > fileBytes || info.data_bytes > fileBytes - info.data_offset) {
+        throw std::runtime_error(where + " - El archivo está truncado");
+    }
+    return info;
+}
+
+/**
+ * @brief Cabecera de un archivo nuevo en el orden de bytes del equipo
+ */
+MatrixFileInfo makeInfo(MatrixDType dtype, int rows, int cols) {
+    std::size_t element = 0;
+    std::size_t scalar = 0;
+    dtypeSizes(dtype, element, scalar);
+
+    MatrixFileInfo info;
+    info.version = MATRIX_FILE_VERSION;
+    info.dtype = dtype;
+    info.little_endian = nativeLittleEndian();
+    info.element_size = element;
+    info.alignment = MATRIX_ALIGNMENT;
+    info.rows = rows;
+    info.cols = cols;
+    info.data_offset = (MATRIX_FILE_HEADER_BYTES + MATRIX_ALIGNMENT - 1) / MATRIX_ALIGNMENT * MATRIX_ALIGNMENT;
+    info.data_bytes = static_cast<std::uint64_t>(rows) * cols * element;
+    return info;
+}
+
+/**
+ * @brief Tamaño de un archivo en bytes
+ */
+bool fileSize(const std::string& path, std::uint64_t& bytes) {
+#if defined(_WIN32)
+    struct _stat64 st;
+    if (_stat64(path.c_str(), &st) != 0) return false;
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+#endif
+    bytes = static_cast<std::uint64_t>(st.st_size);
+    return true;
+}
+
+/**
+ * @brief Invierte el orden de bytes de count componentes de scalar bytes
+ */
+void swapBytes(unsigned char* data, std::size_t count, std::size_t scalar) {
+    for (std::size_t i = 0; i < count; ++i) {
+        unsigned char* p = data + i * scalar;
+        for (std::size_t a = 0, b = scalar - 1; a < b; ++a, --b) {
+            std::swap(p[a], p[b]);
+        }
+    }
+}
+
+/**
+ * @brief Cierra un FILE* al salir del ámbito
+ */
+struct FileCloser {
+    std::FILE* file;
+    explicit FileCloser(std::FILE* f) : file(f) {}
+    ~FileCloser() { if (file) std::fclose(file); }
+};
+
+} // namespace
+
+const char* dtype_name(MatrixDType dtype) {
+    switch (dtype) {
+        case DTYPE_FLOAT32:    return "float32";
+        case DTYPE_FLOAT64:    return "float64";
+        case DTYPE_INT32:      return "int32";
+        case DTYPE_COMPLEX128: return "complex128";
+    }
+    return "desconocido";
+}
+
+MatrixFileInfo read_matrix_info(const std::string& path) {
+    const std::string where = "mathlib::read_matrix_info";
+    std::uint64_t bytes = 0;
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == NULL || !fileSize(path, bytes)) {
+        if (f) std::fclose(f);
+        throw std::runtime_error(where + " - No se pudo abrir el archivo: " + path);
+    }
+    FileCloser closer(f);
+
+    unsigned char buf[MATRIX_FILE_HEADER_BYTES];
+    if (std::fread(buf, 1, sizeof(buf), f) != sizeof(buf)) {
+        throw std::runtime_error(where + " - Cabecera incompleta: " + path);
+    }
+    return decodeHeader(buf, bytes, where);
+}
+
+MatrixFileInfo create_matrix_file(const std::string& path, int rows, int cols, MatrixDType dtype) {
+    const std::string where = "mathlib::create_matrix_file";
+    std::size_t element = 0;
+    std::size_t scalar = 0;
+    if (rows < 0 || cols < 0 || !dtypeSizes(dtype, element, scalar)) {
+        throw std::invalid_argument(where + " - Dimensiones o tipo de elemento no válidos");
+    }
+    MatrixFileInfo info = makeInfo(dtype, rows, cols);
+
+    unsigned char header[MATRIX_FILE_HEADER_BYTES];
+    encodeHeader(info, header);
+    std::uint64_t total = info.data_offset + info.data_bytes;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(where + " - No se pudo crear el archivo: " + path);
+    }
+    DWORD written = 0;
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(total);
+    bool ok = WriteFile(file, header, sizeof(header), &written, NULL) && written == sizeof(header) &&
+              SetFilePointerEx(file, end, NULL, FILE_BEGIN) && SetEndOfFile(file);
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error(where + " - No se pudo crear el archivo: " + path);
+    }
+    bool ok = ::write(fd, header, sizeof(header)) == static_cast<ssize_t>(sizeof(header)) &&
+              ::ftruncate(fd, static_cast<off_t>(total)) == 0;
+    ok = (::close(fd) == 0) && ok;
+#endif
+    if (!ok) {
+        throw std::runtime_error(where + " - Error al escribir el archivo: " + path);
+    }
+    return info;
+}
+
+namespace detail {
+
+template <class T>
+void save_matrix_view(const std::string& path, BasicMatrixView<const T> m) {
+    const std::string where = "mathlib::save_matrix";
+
+    MatrixFileInfo info = makeInfo(DTypeOf<T>::value, m.num_rows(), m.num_cols());
+
+    unsigned char header[MATRIX_FILE_HEADER_BYTES];
+    encodeHeader(info, header);
+
+    // Escribir en un temporal y renombrar, para no dejar nunca un archivo a medias
+    const std::string temp = path + ".tmp";
+    std::FILE* f = std::fopen(temp.c_str(), "wb");
+    if (f == NULL) {
+        throw std::runtime_error(where + " - No se pudo crear el archivo: " + temp);
+    }
+
+    bool ok = std::fwrite(header, 1, sizeof(header), f) == sizeof(header);
+    for (std::uint64_t pad = sizeof(header); ok && pad < info.data_offset; ++pad) {
+        ok = std::fputc(0, f) != EOF;
+    }
+    if (ok && m.is_contiguous() && info.data_bytes > 0) {
+        ok = std::fwrite(m.data(), 1, static_cast<std::size_t>(info.data_bytes), f) == info.data_bytes;
+    } else {
+        for (int i = 0; ok && i < m.num_rows(); ++i) {
+            std::size_t n = static_cast<std::size_t>(m.num_cols());
+            ok = std::fwrite(m.data() + static_cast<std::size_t>(i) * m.stride(), sizeof(T), n, f) == n;
+        }
+    }
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) {
+        std::remove(temp.c_str());
+        throw std::runtime_error(where + " - Error al escribir el archivo: " + temp);
+    }
+
+#if defined(_WIN32)
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temp.c_str(), path.c_str()) != 0) {
+        std::remove(temp.c_str());
+        throw std::runtime_error(where + " - No se pudo renombrar el archivo: " + path);
+    }
+}
+
+template void save_matrix_view<float>(const std::string&, BasicMatrixView<const float>);
+template void save_matrix_view<double>(const std::string&, BasicMatrixView<const double>);
+template void save_matrix_view<int>(const std::string&, BasicMatrixView<const int>);
+template void save_matrix_view<std::complex<double> >(const std::string&,
+                                                      BasicMatrixView<const std::complex<double> >);
+
+} // namespace detail
+
+template <class T>
+BasicMatrix<T> load_matrix(const std::string& path) {
+    const std::string where = "mathlib::load_matrix";
+    MatrixFileInfo info = read_matrix_info(path);
+    if (info.dtype != DTypeOf<T>::value) {
+        throw std::invalid_argument(where + " - El archivo contiene " + dtype_name(info.dtype) +
+                                    ", no " + dtype_name(DTypeOf<T>::value));
+    }
+    if (info.rows == 0 || info.cols == 0) {
+        throw std::runtime_error(where + " - El archivo contiene una matriz vacía (" +
+                                 std::to_string(info.rows) + "x" + std::to_string(info.cols) +
+                                 "), que BasicMatrix no admite: " + path);
+    }
+
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == NULL) {
+        throw std::runtime_error(where + " - No se pudo abrir el archivo: " + path);
+    }
+    FileCloser closer(f);
+
+    BasicMatrix<T> m(info.rows, info.cols, BasicMatrix<T>::UNINITIALIZED);
+    std::size_t count = static_cast<std::size_t>(info.rows) * info.cols;
+    if (std::fseek(f, static_cast<long>(info.data_offset), SEEK_SET) != 0 ||
+        std::fread(m.data(), sizeof(T), count, f) != count) {
+        throw std::runtime_error(where + " - Error al leer los datos: " + path);
+    }
+
+    if (info.little_endian != nativeLittleEndian()) {
+        std::size_t element = 0;
+        std::size_t scalar = 0;
+        dtypeSizes(info.dtype, element, scalar);
+        swapBytes(reinterpret_cast<unsigned char*>(m.data()), count * (element / scalar), scalar);
+    }
+    return m;
+}
+
+template BasicMatrix<float> load_matrix<float>(const std::string&);
+template BasicMatrix<double> load_matrix<double>(const std::string&);
+template BasicMatrix<int> load_matrix<int>(const std::string&);
+template BasicMatrix<std::complex<double> > load_matrix<std::complex<double> >(const std::string&);
+
+// ---------------------------------------------------------------------------
+// MappedMatrixFile
+// ---------------------------------------------------------------------------
+
+MappedMatrixFile::MappedMatrixFile(const std::string& path)
+    : base(NULL), length(0), mappingHandle(NULL) {
+    const std::string where = "mathlib::MappedMatrixFile";
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(where + " - No se pudo abrir el archivo: " + path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(MATRIX_FILE_HEADER_BYTES)) {
+        CloseHandle(file);
+        throw std::runtime_error(where + " - Cabecera incompleta: " + path);
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) {
+        throw std::runtime_error(where + " - No se pudo mapear el archivo: " + path);
+    }
+    base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == NULL) {
+        CloseHandle(mapping);
+        throw std::runtime_error(where + " - No se pudo mapear el archivo: " + path);
+    }
+    mappingHandle = mapping;
+    length = static_cast<std::size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(where + " - No se pudo abrir el archivo: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(MATRIX_FILE_HEADER_BYTES)) {
+        ::close(fd);
+        throw std::runtime_error(where + " - Cabecera incompleta: " + path);
+    }
+    length = static_cast<std::size_t>(st.st_size);
+    void* mapped = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error(where + " - No se pudo mapear el archivo: " + path);
+    }
+    base = mapped;
+#endif
+
+    try {
+        header = decodeHeader(static_cast<const unsigned char*>(base), length, where);
+        if (header.little_endian != nativeLittleEndian()) {
+            throw std::runtime_error(where + " - El orden de bytes del archivo no coincide con el del equipo;"
+                                             " use load_matrix para convertirlo");
+        }
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+MappedMatrixFile::~MappedMatrixFile() {
+    unmap();
+}
+
+MappedMatrixFile::MappedMatrixFile(MappedMatrixFile&& other) noexcept
+    : base(other.base), length(other.length), header(other.header),
+      mappingHandle(other.mappingHandle) {
+    other.base = NULL;
+    other.length = 0;
+    other.mappingHandle = NULL;
+}
+
+MappedMatrixFile& MappedMatrixFile::operator=(MappedMatrixFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        base = other.base;
+        length = other.length;
+        header = other.header;
+        mappingHandle = other.mappingHandle;
+        other.base = NULL;
+        other.length = 0;
+        other.mappingHandle = NULL;
+    }
+    return *this;
+}
+
+void MappedMatrixFile::checkDType(MatrixDType expected) const {
+    if (header.dtype != expected) {
+        throw std::invalid_argument(std::string("mathlib::MappedMatrixFile::view - El archivo contiene ") +
+                                    dtype_name(header.dtype) + ", no " + dtype_name(expected));
+    }
+}
+
+void MappedMatrixFile::unmap() {
+    if (base == NULL) {
+        return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+#else
+    munmap(base, length);
+#endif
+    base = NULL;
+    length = 0;
+    mappingHandle = NULL;
+}
+
+} // namespace mathlib
@@ -0,0 +1,761 @@
+/**
+ * @file MatrixText.cpp
+ * @brief Implementación de la lectura y escritura de matrices en texto
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * La escritura trabaja por bloques de unas TEXT_BLOCK_ELEMENTS celdas:
+ * cada bloque se formatea en su propio buffer y después se envía al
+ * destino en orden, de modo que con PARALLEL varios bloques se formatean
+ * a la vez sin que cambie el resultado.
+ *
+ * Los números se convierten sin pasar por iostream. Al escribir, los
+ * valores enteros usan una conversión directa de dígitos y el resto una
+ * sola llamada a snprintf cuyos dígitos se recortan mientras el valor se
+ * siga leyendo igual (no hay std::to_chars en C++11). Al leer, la vía
+ * rápida de Clinger es exacta cuando la mantisa decimal cabe en la
+ * mantisa binaria y la potencia de diez es representable (|e| <= 22 en
+ * double); los demás casos, poco habituales, pasan a strtod/strtof.
+ *
+ * El formato no depende de la configuración regional del proceso: el
+ * separador decimal es siempre '.', así que strtod/strtof se llaman con
+ * la configuración "C" (strtod_l, _strtod_l en Windows) y el punto que
+ * escribe snprintf se normaliza si LC_NUMERIC usa otro.
+ */
+
+#include "MatrixText.h"
+#include "Matrix.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <locale.h>
+#include <unistd.h>
+#endif
+#if defined(__APPLE__)
+#include <xlocale.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+/// Celdas que se formatean en cada bloque de salida
+const std::size_t TEXT_BLOCK_ELEMENTS = 1 << 16;
+
+/// Bytes mínimos de cada trozo de entrada convertido por separado
+const std::size_t TEXT_CHUNK_BYTES = 1 << 20;
+
+/// Tamaño de los buffers de formato; también el de la vía corta de lectura
+const int MAX_TOKEN = 64;
+
+/// Mayor precision de TextFormat que se respeta al escribir (cabe en MAX_TOKEN)
+const int MAX_PRECISION = 40;
+
+typedef std::function<void(const char*, std::size_t)> Sink;
+
+// ---------------------------------------------------------------------------
+// Escritura
+// ---------------------------------------------------------------------------
+
+/// Escribe v en decimal en out y devuelve el número de caracteres
+int formatInteger(long long v, char* out) {
+    char digits[24];
+    unsigned long long u = v < 0 ? 0ULL - static_cast<unsigned long long>(v)
+                                 : static_cast<unsigned long long>(v);
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    int len = 0;
+    if (v < 0) {
+        out[len++] = '-';
+    }
+    while (n > 0) {
+        out[len++] = digits[--n];
+    }
+    return len;
+}
+
+#if defined(_WIN32)
+typedef _locale_t CLocale;
+#else
+typedef locale_t CLocale;
+#endif
+
+/// Configuración regional "C", creada una vez y nunca liberada
+CLocale cLocale() {
+#if defined(_WIN32)
+    static const CLocale locale = _create_locale(LC_NUMERIC, "C");
+#else
+    static const CLocale locale = newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0));
+#endif
+    return locale;
+}
+
+template <class T>
+struct FloatTraits;
+
+template <>
+struct FloatTraits<double> {
+    static const int SHORT_DIGITS = 15;   ///< Dígitos que siempre se conservan
+    static const int EXACT_DIGITS = 17;   ///< Dígitos que siempre bastan para volver al valor
+#if defined(_WIN32)
+    static double parse(const char* s, char** end) { return _strtod_l(s, end, cLocale()); }
+#else
+    static double parse(const char* s, char** end) { return strtod_l(s, end, cLocale()); }
+#endif
+};
+
+template <>
+struct FloatTraits<float> {
+    static const int SHORT_DIGITS = 6;
+    static const int EXACT_DIGITS = 9;
+#if defined(_WIN32)
+    static float parse(const char* s, char** end) { return _strtof_l(s, end, cLocale()); }
+#else
+    static float parse(const char* s, char** end) { return strtof_l(s, end, cLocale()); }
+#endif
+};
+
+/**
+ * @brief Sustituye el separador decimal de LC_NUMERIC por '.' en out[0, len)
+ *
+ * snprintf no admite una configuración regional propia; con "C" (lo
+ * habitual) no hace nada.
+ *
+ * @return Nueva longitud (el separador regional puede ocupar varios bytes)
+ */
+int normalizeDecimalPoint(char* out, int len) {
+    const char* point = std::localeconv()->decimal_point;
+    if (point == NULL || point[0] == '\0' || (point[0] == '.' && point[1] == '\0')) {
+        return len;
+    }
+    const char* found = std::strstr(out, point);
+    if (found == NULL) {
+        return len;
+    }
+    const int at = static_cast<int>(found - out);
+    const int width = static_cast<int>(std::strlen(point));
+    out[at] = '.';
+    std::memmove(out + at + 1, out + at + width, static_cast<std::size_t>(len - at - width + 1));
+    return len - width + 1;
+}
+
+template <class T>
+struct ParseLimits;
+
+template <>
+struct ParseLimits<double> {
+    static const unsigned long long MAX_MANTISSA = 1ULL << 53;
+    static const int MAX_EXPONENT = 22;
+};
+
+template <>
+struct ParseLimits<float> {
+    static const unsigned long long MAX_MANTISSA = 1ULL << 24;
+    static const int MAX_EXPONENT = 10;
+};
+
+/// Potencias exactas de 10 para la vía rápida
+template <class T>
+struct PowersOfTen {
+    T value[ParseLimits<T>::MAX_EXPONENT + 1];
+
+    PowersOfTen() {
+        value[0] = T(1);
+        for (int e = 1; e <= ParseLimits<T>::MAX_EXPONENT; ++e) {
+            value[e] = value[e - 1] * T(10);
+        }
+    }
+};
+
+template <class T>
+const T* powersOfTen() {
+    static const PowersOfTen<T> table;
+    return table.value;
+}
+
+/**
+ * @brief Valor de m * 10^e si se puede calcular con un solo redondeo
+ *
+ * Es el caso en que ambos factores son exactos en T (vía de Clinger).
+ */
+template <class T>
+bool exactDecimal(unsigned long long m, int e, T& value) {
+    if (m > ParseLimits<T>::MAX_MANTISSA || e < -ParseLimits<T>::MAX_EXPONENT || e > ParseLimits<T>::MAX_EXPONENT) {
+        return false;
+    }
+    const T* powers = powersOfTen<T>();
+    value = e >= 0 ? static_cast<T>(m) * powers[e] : static_cast<T>(m) / powers[-e];
+    return true;
+}
+
+/**
+ * @brief Escribe digits[0, count) con el exponente decimal del primero
+ *
+ * Usa notación fija o científica con el mismo criterio que %g (con
+ * tantos dígitos de precisión como dígitos hay) y sin ceros finales.
+ */
+int formatDigits(bool negative, const char* digits, int count, int exponent, char* out) {
+    while (count > 1 && digits[count - 1] == '0') {
+        --count;
+    }
+    int len = 0;
+    if (negative) {
+        out[len++] = '-';
+    }
+    if (exponent >= -4 && exponent < count) {
+        if (exponent < 0) {
+            out[len++] = '0';
+            out[len++] = '.';
+            for (int i = exponent + 1; i < 0; ++i) {
+                out[len++] = '0';
+            }
+            std::memcpy(out + len, digits, static_cast<std::size_t>(count));
+            return len + count;
+        }
+        std::memcpy(out + len, digits, static_cast<std::size_t>(exponent + 1));
+        len += exponent + 1;
+        if (count > exponent + 1) {
+            out[len++] = '.';
+            std::memcpy(out + len, digits + exponent + 1, static_cast<std::size_t>(count - exponent - 1));
+            len += count - exponent - 1;
+        }
+        return len;
+    }
+    out[len++] = digits[0];
+    if (count > 1) {
+        out[len++] = '.';
+        std::memcpy(out + len, digits + 1, static_cast<std::size_t>(count - 1));
+        len += count - 1;
+    }
+    out[len++] = 'e';
+    out[len++] = exponent < 0 ? '-' : '+';
+    if (exponent > -10 && exponent < 10) {
+        out[len++] = '0';
+    }
+    return len + formatInteger(exponent < 0 ? -exponent : exponent, out + len);
+}
+
+/// Indica si m * 10^e se lee como v
+template <class T>
+bool readsAs(unsigned long long m, int e, T v) {
+    T value;
+    if (exactDecimal(m, e, value)) {
+        return value == v;
+    }
+    char text[MAX_TOKEN];
+    int len = formatInteger(static_cast<long long>(m), text);
+    text[len++] = 'e';
+    len += formatInteger(e, text + len);
+    text[len] = '\0';
+    return FloatTraits<T>::parse(text, NULL) == v;
+}
+
+/**
+ * @brief Representación más corta de v que se lee de vuelta sin pérdida
+ *
+ * Parte de los EXACT_DIGITS dígitos de snprintf, que siempre bastan, y
+ * prueba a recortarlos a SHORT_DIGITS, SHORT_DIGITS + 1, ... dígitos,
+ * redondeando hacia abajo y hacia arriba.
+ */
+template <class T>
+int formatShortest(T v, char* out) {
+    const int exact = FloatTraits<T>::EXACT_DIGITS;
+    char text[MAX_TOKEN];
+    normalizeDecimalPoint(text, std::snprintf(text, sizeof(text), "%.*e", exact - 1, static_cast<double>(v)));
+    const bool negative = text[0] == '-';
+    const char* p = text + (negative ? 1 : 0);
+    char digits[24];
+    digits[0] = p[0];
+    std::memcpy(digits + 1, p + 2, static_cast<std::size_t>(exact - 1));
+    const int exponent = std::atoi(p + exact + 2);
+    const T magnitude = negative ? -v : v;
+
+    unsigned long long m = 0;
+    for (int count = 1; count < exact; ++count) {
+        m = m * 10 + static_cast<unsigned long long>(digits[count - 1] - '0');
+        if (count < FloatTraits<T>::SHORT_DIGITS) {
+            continue;
+        }
+        const int scale = exponent - count + 1;
+        for (unsigned long long candidate = m; candidate <= m + 1; ++candidate) {
+            if (readsAs(candidate, scale, magnitude)) {
+                char shorter[24];
+                const int len = formatInteger(static_cast<long long>(candidate), shorter);
+                return formatDigits(negative, shorter, len, scale + len - 1, out);
+            }
+        }
+    }
+    return formatDigits(negative, digits, exact, exponent, out);
+}
+
+/**
+ * @brief Formatea un número en coma flotante en out (al menos MAX_TOKEN bytes)
+ *
+ * Con precision < 0 los valores enteros se escriben sin pasar por
+ * snprintf y el resto con formatShortest(); las precisiones mayores que
+ * MAX_PRECISION se reducen a MAX_PRECISION.
+ */
+template <class T>
+int formatFloat(T v, int precision, char* out) {
+    const double d = static_cast<double>(v);
+    if (precision >= 0) {
+        return normalizeDecimalPoint(out, std::snprintf(out, MAX_TOKEN, "%.*g", std::min(precision, MAX_PRECISION), d));
+    }
+    if (d == 0.0 && std::signbit(d)) {
+        std::memcpy(out, "-0", 2);
+        return 2;
+    }
+    if (std::fabs(d) < 1e15 && d == std::floor(d)) {
+        return formatInteger(static_cast<long long>(d), out);
+    }
+    if (v != v || std::isinf(d)) {
+        return normalizeDecimalPoint(out, std::snprintf(out, MAX_TOKEN, "%g", d));
+    }
+    return formatShortest(v, out);
+}
+
+int formatValue(float v, int precision, char* out) { return formatFloat(v, precision, out); }
+int formatValue(double v, int precision, char* out) { return formatFloat(v, precision, out); }
+int formatValue(int v, int, char* out) { return formatInteger(v, out); }
+
+/// Formatea las filas [r0, r1) de m en buffer (que se vacía antes)
+template <class T>
+void formatRows(const BasicMatrix<T>& m, int r0, int r1, const TextFormat& format, std::string& buffer) {
+    buffer.clear();
+    char cell[MAX_TOKEN];
+    const int cols = m.num_cols();
+    for (int i = r0; i < r1; ++i) {
+        const T* row = m.data() + static_cast<std::size_t>(i) * m.stride();
+        for (int j = 0; j < cols; ++j) {
+            int len = formatValue(row[j], format.precision, cell);
+            if (j + 1 < cols) {
+                cell[len++] = format.delimiter;
+            }
+            buffer.append(cell, static_cast<std::size_t>(len));
+        }
+        buffer.push_back('\n');
+    }
+}
+
+template <class T>
+void writeBlocks(const BasicMatrix<T>& m, const TextFormat& format, const Sink& sink) {
+    const int rows = m.num_rows();
+    const int rowsPerBlock = static_cast<int>(std::max<std::size_t>(
+        1, TEXT_BLOCK_ELEMENTS / static_cast<std::size_t>(m.num_cols())));
+    const int blocks = (rows + rowsPerBlock - 1) / rowsPerBlock;
+
+    ThreadPool* pool = format.policy == PARALLEL ? &ThreadPool::global() : NULL;
+    const int perRound = pool && pool->size() > 1 ? 2 * pool->size() : 1;
+    std::vector<std::string> buffers(static_cast<std::size_t>(std::min(perRound, blocks)));
+
+    for (int first = 0; first < blocks; first += perRound) {
+        const int count = std::min(perRound, blocks - first);
+        if (count > 1) {
+            pool->parallel_for(count, [&](int b) {
+                const int r0 = (first + b) * rowsPerBlock;
+                formatRows(m, r0, std::min(rows, r0 + rowsPerBlock), format, buffers[b]);
+            });
+        } else {
+            const int r0 = first * rowsPerBlock;
+            formatRows(m, r0, std::min(rows, r0 + rowsPerBlock), format, buffers[0]);
+        }
+        for (int b = 0; b < count; ++b) {
+            sink(buffers[b].data(), buffers[b].size());
+        }
+    }
+}
+
+void writeAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+#if defined(_WIN32)
+        const unsigned int piece = static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30));
+        const int written = _write(fd, data, piece);
+#else
+        const ssize_t written = ::write(fd, data, size);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("mathlib::write_text - Error al escribir: ") + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Lectura
+// ---------------------------------------------------------------------------
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/**
+ * @brief Convierte [s, end) a coma flotante; false si no es un número completo
+ */
+template <class T>
+bool parseFloat(const char* s, const char* end, T& value) {
+    const char* p = s;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    unsigned long long mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool any = false;
+    bool truncated = false;
+    for (; p < end && isDigit(*p); ++p) {
+        any = true;
+        const int d = *p - '0';
+        if (digits < 19) {
+            mantissa = mantissa * 10 + d;
+            digits += mantissa != 0;
+        } else {
+            ++exponent;
+            truncated = truncated || d != 0;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && isDigit(*p); ++p) {
+            any = true;
+            const int d = *p - '0';
+            if (digits < 19) {
+                mantissa = mantissa * 10 + d;
+                digits += mantissa != 0;
+                --exponent;
+            } else {
+                truncated = truncated || d != 0;
+            }
+        }
+    }
+    if (any && p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool expNegative = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            expNegative = *q == '-';
+            ++q;
+        }
+        if (q < end && isDigit(*q)) {
+            int e = 0;
+            for (; q < end && isDigit(*q); ++q) {
+                e = std::min(e * 10 + (*q - '0'), 100000);
+            }
+            exponent += expNegative ? -e : e;
+            p = q;
+        }
+    }
+
+    if (any && p == end && !truncated && exactDecimal(mantissa, exponent, value)) {
+        if (negative) {
+            value = -value;
+        }
+        return true;
+    }
+
+    // Mantisas largas, exponentes grandes, nan, inf, ... (sin límite de
+    // longitud: los números de más de MAX_TOKEN caracteres se copian aparte)
+    const std::size_t len = static_cast<std::size_t>(end - s);
+    if (len == 0) {
+        return false;
+    }
+    char shortToken[MAX_TOKEN];
+    std::string longToken;
+    char* token = shortToken;
+    if (len >= sizeof(shortToken)) {
+        longToken.assign(s, len);
+        token = &longToken[0];
+    } else {
+        std::memcpy(token, s, len);
+        token[len] = '\0';
+    }
+    char* stop = NULL;
+    value = FloatTraits<T>::parse(token, &stop);
+    return stop == token + len;
+}
+
+bool parseValue(const char* s, const char* end, float& value) { return parseFloat(s, end, value); }
+bool parseValue(const char* s, const char* end, double& value) { return parseFloat(s, end, value); }
+
+bool parseValue(const char* s, const char* end, int& value) {
+    const char* p = s;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == end) {
+        return false;
+    }
+    long long v = 0;
+    for (; p < end; ++p) {
+        if (!isDigit(*p)) {
+            return false;
+        }
+        v = v * 10 + (*p - '0');
+        if (v > static_cast<long long>(INT_MAX) + 1) {
+            return false;
+        }
+    }
+    v = negative ? -v : v;
+    if (v > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(v);
+    return true;
+}
+
+/**
+ * @brief Reglas de separación de una línea según el delimitador
+ */
+struct LineSyntax {
+    char delimiter;
+    bool whitespace;   ///< ' ': cualquier secuencia de blancos separa
+
+    explicit LineSyntax(char d) : delimiter(d), whitespace(d == ' ') {}
+
+    bool blank(char c) const {
+        return (c == ' ' || c == '\t' || c == '\r') && (whitespace || c != delimiter);
+    }
+    bool ends(char c) const { return blank(c) || (!whitespace && c == delimiter); }
+};
+
+[[noreturn]] void parseError(std::size_t row, const std::string& what) {
+    throw std::runtime_error("mathlib::parse_text - Fila " + std::to_string(row + 1) + ": " + what);
+}
+
+/**
+ * @brief Convierte una línea; devuelve el número de elementos
+ *
+ * Con out == NULL solo cuenta los elementos (y comprueba que son números).
+ */
+template <class T>
+int parseLine(const char* p, const char* end, const LineSyntax& syntax, T* out, int cols, std::size_t row) {
+    int count = 0;
+    bool expectField = false;
+    for (;;) {
+        while (p < end && syntax.blank(*p)) ++p;
+        if (p == end) {
+            if (expectField) {
+                parseError(row, "falta un elemento tras el separador");
+            }
+            break;
+        }
+        const char* tokenEnd = p;
+        while (tokenEnd < end && !syntax.ends(*tokenEnd)) ++tokenEnd;
+        T value;
+        if (tokenEnd == p || !parseValue(p, tokenEnd, value)) {
+            const std::size_t shown = tokenEnd == p ? 1 : std::min<std::size_t>(tokenEnd - p, 32);
+            parseError(row, "valor no válido '" + std::string(p, shown) + "'");
+        }
+        if (out) {
+            if (count >= cols) {
+                parseError(row, "tiene más de " + std::to_string(cols) + " columnas");
+            }
+            out[count] = value;
+        }
+        ++count;
+        p = tokenEnd;
+        while (p < end && syntax.blank(*p)) ++p;
+        expectField = false;
+        if (p < end && !syntax.whitespace) {
+            if (*p != syntax.delimiter) {
+                parseError(row, "se esperaba el separador");
+            }
+            ++p;
+            expectField = true;
+        }
+    }
+    if (out && count != cols) {
+        parseError(row, "tiene " + std::to_string(count) + " columnas; se esperaban " + std::to_string(cols));
+    }
+    return count;
+}
+
+bool blankLine(const char* p, const char* end) {
+    for (; p < end; ++p) {
+        if (*p != ' ' && *p != '\t' && *p != '\r') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Recorre las líneas no vacías de [begin, end) llamando a body(inicio, fin)
+template <class Body>
+void forEachLine(const char* begin, const char* end, Body body) {
+    const char* p = begin;
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        const char* lineEnd = nl ? nl : end;
+        if (!blankLine(p, lineEnd)) {
+            body(p, lineEnd);
+        }
+        p = nl ? nl + 1 : end;
+    }
+}
+
+} // namespace
+
+template <class T>
+void write_text(const BasicMatrix<T>& m, std::ostream& out, const TextFormat& format) {
+    writeBlocks(m, format, [&out](const char* data, std::size_t size) {
+        out.write(data, static_cast<std::streamsize>(size));
+        if (!out) {
+            throw std::runtime_error("mathlib::write_text - Error al escribir en el flujo");
+        }
+    });
+}
+
+template <class T>
+void write_text(const BasicMatrix<T>& m, int fd, const TextFormat& format) {
+    writeBlocks(m, format, [fd](const char* data, std::size_t size) { writeAll(fd, data, size); });
+}
+
+template <class T>
+void save_text(const std::string& path, const BasicMatrix<T>& m, const TextFormat& format) {
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("mathlib::save_text - No se pudo crear el archivo: " + path);
+    }
+    write_text(m, out, format);
+    out.close();
+    if (!out) {
+        throw std::runtime_error("mathlib::save_text - Error al escribir el archivo: " + path);
+    }
+}
+
+template <class T>
+BasicMatrix<T> parse_text(const char* data, std::size_t size, const TextFormat& format) {
+    const char* end = data + size;
+    const LineSyntax syntax(format.delimiter);
+
+    // Trozos que empiezan tras un salto de línea, de al menos TEXT_CHUNK_BYTES
+    ThreadPool* pool = format.policy == PARALLEL ? &ThreadPool::global() : NULL;
+    std::size_t wanted = pool ? static_cast<std::size_t>(4 * pool->size()) : 1;
+    wanted = std::max<std::size_t>(1, std::min(wanted, size / TEXT_CHUNK_BYTES));
+    std::vector<const char*> bounds(1, data);
+    for (std::size_t c = 1; c < wanted; ++c) {
+        const char* p = std::max(bounds.back(), data + size / wanted * c);
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        if (!nl) break;
+        bounds.push_back(nl + 1);
+    }
+    bounds.push_back(end);
+    const int chunks = static_cast<int>(bounds.size()) - 1;
+
+    // Filas de cada trozo y fila inicial de cada uno
+    std::vector<std::size_t> firstRow(static_cast<std::size_t>(chunks) + 1, 0);
+    std::function<void(int)> countRows = [&](int c) {
+        std::size_t rows = 0;
+        forEachLine(bounds[c], bounds[c + 1], [&rows](const char*, const char*) { ++rows; });
+        firstRow[c + 1] = rows;
+    };
+    if (chunks > 1) {
+        pool->parallel_for(chunks, countRows);
+    } else {
+        countRows(0);
+    }
+    for (int c = 0; c < chunks; ++c) {
+        firstRow[c + 1] += firstRow[c];
+    }
+    const std::size_t rows = firstRow[chunks];
+    if (rows == 0) {
+        throw std::runtime_error("mathlib::parse_text - El texto no contiene datos");
+    }
+    if (rows > static_cast<std::size_t>(INT_MAX)) {
+        throw std::runtime_error("mathlib::parse_text - Demasiadas filas");
+    }
+
+    // Columnas según la primera fila
+    int cols = 0;
+    bool found = false;
+    forEachLine(data, end, [&](const char* b, const char* e) {
+        if (!found) {
+            cols = parseLine<T>(b, e, syntax, NULL, 0, 0);
+            found = true;
+        }
+    });
+
+    BasicMatrix<T> result(static_cast<int>(rows), cols, BasicMatrix<T>::UNINITIALIZED);
+    std::function<void(int)> parseChunk = [&](int c) {
+        std::size_t row = firstRow[c];
+        forEachLine(bounds[c], bounds[c + 1], [&](const char* b, const char* e) {
+            parseLine(b, e, syntax, result.data() + row * static_cast<std::size_t>(result.stride()), cols, row);
+            ++row;
+        });
+    };
+    if (chunks > 1) {
+        pool->parallel_for(chunks, parseChunk);
+    } else {
+        parseChunk(0);
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> read_text(std::istream& in, const TextFormat& format) {
+    std::vector<char> text;
+    char buffer[1 << 16];
+    while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+        text.insert(text.end(), buffer, buffer + in.gcount());
+    }
+    if (in.bad()) {
+        throw std::runtime_error("mathlib::read_text - Error al leer el flujo");
+    }
+    return parse_text<T>(text.empty() ? "" : &text[0], text.size(), format);
+}
+
+template <class T>
+BasicMatrix<T> load_text(const std::string& path, const TextFormat& format) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("mathlib::load_text - No se pudo abrir el archivo: " + path);
+    }
+    in.seekg(0, std::ios::end);
+    const std::streamoff size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    std::vector<char> text(static_cast<std::size_t>(std::max<std::streamoff>(size, 0)));
+    if (!text.empty() && !in.read(&text[0], static_cast<std::streamsize>(text.size()))) {
+        throw std::runtime_error("mathlib::load_text - Error al leer el archivo: " + path);
+    }
+    return parse_text<T>(text.empty() ? "" : &text[0], text.size(), format);
+}
+
+#define MATHLIB_INSTANTIATE_TEXT(T)                                                        \
+    template void write_text<T>(const BasicMatrix<T>&, std::ostream&, const TextFormat&);  \
+    template void write_text<T>(const BasicMatrix<T>&, int, const TextFormat&);            \
+    template void save_text<T>(const std::string&, const BasicMatrix<T>&, const TextFormat&); \
+    template BasicMatrix<T> parse_text<T>(const char*, std::size_t, const TextFormat&);    \
+    template BasicMatrix<T> read_text<T>(std::istream&, const TextFormat&);                \
+    template BasicMatrix<T> load_text<T>(const std::string&, const TextFormat&);
+
+MATHLIB_INSTANTIATE_TEXT(float)
+MATHLIB_INSTANTIATE_TEXT(double)
+MATHLIB_INSTANTIATE_TEXT(int)
+
+#undef MATHLIB_INSTANTIATE_TEXT
+
+} // namespace mathlib
@@ -0,0 +1,168 @@
+/**
+ * @file MatrixView.cpp
+ * @brief Implementación de los kernels sobre vistas de matrices
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Las funciones de este archivo trabajan solo con punteros y separación
+ * entre filas, por lo que sirven igual para matrices propietarias, para
+ * sub-bloques y para buffers externos.
+ */
+
+#include "MatrixView.h"
+#include "Matrix.h"
+#include "Gemm.h"
+#include "Kernels.h"
+#include "KernelsInternal.h"
+#include "ThreadPool.h"
+#include <complex>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace mathlib {
+
+namespace {
+
+/**
+ * @brief Comprueba si dos vistas comparten alguna posición de memoria
+ *
+ * Compara los rangos de direcciones que abarcan ambas vistas; puede dar
+ * falsos positivos con vistas entrelazadas, lo que solo cuesta una copia.
+ */
+template <class T>
+bool overlaps(const BasicMatrixView<const T>& a, const BasicMatrixView<T>& b) {
+    if (a.num_rows() == 0 || a.num_cols() == 0 || b.num_rows() == 0 || b.num_cols() == 0) {
+        return false;
+    }
+    const T* aBegin = a.data();
+    const T* aEnd = a.data() + static_cast<std::size_t>(a.num_rows() - 1) * a.stride() + a.num_cols();
+    const T* bBegin = b.data();
+    const T* bEnd = b.data() + static_cast<std::size_t>(b.num_rows() - 1) * b.stride() + b.num_cols();
+    return std::less<const T*>()(aBegin, bEnd) && std::less<const T*>()(bBegin, aEnd);
+}
+
+/**
+ * @brief Verifica que dos vistas tengan las mismas dimensiones
+ */
+template <class A, class B>
+void checkSameShape(const A& a, const B& b, const char* message) {
+    if (a.num_rows() != b.num_rows() || a.num_cols() != b.num_cols()) {
+        throw std::invalid_argument(message);
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+template <class T>
+void multiply_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b,
+                    BasicMatrixView<T> out, ExecutionPolicy policy) {
+    if (a.num_cols() != b.num_rows()) {
+        throw std::invalid_argument("mathlib::multiply - Dimensiones incompatibles");
+    }
+    if (out.num_rows() != a.num_rows() || out.num_cols() != b.num_cols()) {
+        throw std::invalid_argument("mathlib::multiply - El destino no tiene las dimensiones del producto");
+    }
+    if (out.num_rows() == 0 || out.num_cols() == 0) {
+        return;
+    }
+
+    // El kernel no admite que el destino se solape con un operando
+    if (overlaps(a, out) || overlaps(b, out)) {
+        BasicMatrix<T> temp(out.num_rows(), out.num_cols(), BasicMatrix<T>::UNINITIALIZED);
+        multiply_views<T>(a, b, BasicMatrixView<T>(temp), policy);
+        copy_view<T>(BasicMatrixView<const T>(temp), out);
+        return;
+    }
+
+    if (a.num_cols() == 0) {
+        for (int i = 0; i < out.num_rows(); ++i) {
+            Span<T> r = out.row(i);
+            std::fill(r.begin(), r.end(), T());
+        }
+        return;
+    }
+
+    if (policy == PARALLEL) {
+        gemm_parallel(out.num_rows(), out.num_cols(), a.num_cols(),
+                      a.data(), a.stride(), b.data(), b.stride(),
+                      out.data(), out.stride(), ThreadPool::global());
+    } else {
+        gemm(out.num_rows(), out.num_cols(), a.num_cols(),
+             a.data(), a.stride(), b.data(), b.stride(),
+             out.data(), out.stride());
+    }
+}
+
+template <class T>
+void add_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out) {
+    checkSameShape(a, b, "mathlib::add - Las matrices deben tener el mismo tamaño");
+    checkSameShape(a, out, "mathlib::add - El destino debe tener el mismo tamaño");
+    apply_elementwise<T>(vec_add, a.num_rows(), a.num_cols(), a.data(), a.stride(),
+                         b.data(), b.stride(), out.data(), out.stride());
+}
+
+template <class T>
+void subtract_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out) {
+    checkSameShape(a, b, "mathlib::subtract - Las matrices deben tener el mismo tamaño");
+    checkSameShape(a, out, "mathlib::subtract - El destino debe tener el mismo tamaño");
+    apply_elementwise<T>(vec_sub, a.num_rows(), a.num_cols(), a.data(), a.stride(),
+                         b.data(), b.stride(), out.data(), out.stride());
+}
+
+template <class T>
+void hadamard_views(BasicMatrixView<const T> a, BasicMatrixView<const T> b, BasicMatrixView<T> out) {
+    checkSameShape(a, b, "mathlib::hadamard - Las matrices deben tener el mismo tamaño");
+    checkSameShape(a, out, "mathlib::hadamard - El destino debe tener el mismo tamaño");
+    apply_elementwise<T>(vec_mul, a.num_rows(), a.num_cols(), a.data(), a.stride(),
+                         b.data(), b.stride(), out.data(), out.stride());
+}
+
+template <class T>
+void scale_view(T alpha, BasicMatrixView<const T> a, BasicMatrixView<T> out) {
+    checkSameShape(a, out, "mathlib::scale - El destino debe tener el mismo tamaño");
+    for (int i = 0; i < a.num_rows(); ++i) {
+        vec_scale(static_cast<std::size_t>(a.num_cols()), alpha,
+                  a.data() + static_cast<std::size_t>(i) * a.stride(),
+                  out.data() + static_cast<std::size_t>(i) * out.stride());
+    }
+}
+
+template <class T>
+void copy_view(BasicMatrixView<const T> src, BasicMatrixView<T> dst) {
+    checkSameShape(src, dst, "mathlib::copy - Las matrices deben tener el mismo tamaño");
+    if (src.data() == dst.data() && src.stride() == dst.stride()) {
+        return;
+    }
+    for (int i = 0; i < src.num_rows(); ++i) {
+        std::memmove(dst.data() + static_cast<std::size_t>(i) * dst.stride(),
+                     src.data() + static_cast<std::size_t>(i) * src.stride(),
+                     static_cast<std::size_t>(src.num_cols()) * sizeof(T));
+    }
+}
+
+#define MATHLIB_INSTANTIATE_VIEW_KERNELS(T)                                                        \
+    template void multiply_views<T>(BasicMatrixView<const T>, BasicMatrixView<const T>,            \
+                                    BasicMatrixView<T>, ExecutionPolicy);                          \
+    template void add_views<T>(BasicMatrixView<const T>, BasicMatrixView<const T>,                 \
+                               BasicMatrixView<T>);                                                \
+    template void subtract_views<T>(BasicMatrixView<const T>, BasicMatrixView<const T>,            \
+                                    BasicMatrixView<T>);                                           \
+    template void hadamard_views<T>(BasicMatrixView<const T>, BasicMatrixView<const T>,            \
+                                    BasicMatrixView<T>);                                           \
+    template void scale_view<T>(T, BasicMatrixView<const T>, BasicMatrixView<T>);                  \
+    template void copy_view<T>(BasicMatrixView<const T>, BasicMatrixView<T>);
+
+MATHLIB_INSTANTIATE_VIEW_KERNELS(float)
+MATHLIB_INSTANTIATE_VIEW_KERNELS(double)
+MATHLIB_INSTANTIATE_VIEW_KERNELS(int)
+MATHLIB_INSTANTIATE_VIEW_KERNELS(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_VIEW_KERNELS
+
+} // namespace detail
+
+} // namespace mathlib
@@ -0,0 +1,391 @@
+/**
+ * @file OutOfCore.cpp
+ * @brief Implementación del producto de matrices fuera de memoria
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * El recorrido se aplana en una secuencia de pasos (tesela de C, índice
+ * de profundidad); cada paso necesita una tesela de A y otra de B. La
+ * lectura del paso s + 1 se lanza en un hilo de E/S antes de calcular el
+ * paso s, y la escritura de cada tesela de C terminada también se hace en
+ * segundo plano sobre uno de los dos acumuladores.
+ */
+
+#include "OutOfCore.h"
+#include "MatrixFile.h"
+#include "Gemm.h"
+#include "Kernels.h"
+#include "Profiling.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+/// Buffers de tesela del presupuesto: 2 de A, 2 de B, 2 acumuladores de C y 1 producto parcial
+const int TILE_BUFFERS = 7;
+
+/**
+ * @brief true si el equipo es little-endian
+ */
+bool nativeLittleEndian() {
+    const std::uint16_t probe = 1;
+    return *reinterpret_cast<const unsigned char*>(&probe) == 1;
+}
+
+/**
+ * @brief true si las dos rutas nombran el mismo archivo existente
+ *
+ * Compara la identidad del archivo (dispositivo e i-nodo, o volumen e
+ * índice en Windows), no el texto de las rutas, para detectar también
+ * enlaces y rutas relativas.
+ */
+bool sameFile(const std::string& a, const std::string& b) {
+#if defined(_WIN32)
+    BY_HANDLE_FILE_INFORMATION info[2];
+    const std::string* paths[2] = {&a, &b};
+    for (int i = 0; i < 2; ++i) {
+        HANDLE h = CreateFileA(paths[i]->c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+        if (h == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        BOOL ok = GetFileInformationByHandle(h, &info[i]);
+        CloseHandle(h);
+        if (!ok) {
+            return false;
+        }
+    }
+    return info[0].dwVolumeSerialNumber == info[1].dwVolumeSerialNumber &&
+           info[0].nFileIndexHigh == info[1].nFileIndexHigh &&
+           info[0].nFileIndexLow == info[1].nFileIndexLow;
+#else
+    struct stat sa;
+    struct stat sb;
+    if (stat(a.c_str(), &sa) != 0 || stat(b.c_str(), &sb) != 0) {
+        return false;
+    }
+    return sa.st_dev == sb.st_dev && sa.st_ino == sb.st_ino;
+#endif
+}
+
+/**
+ * @class TileFile
+ * @brief Archivo abierto para lecturas y escrituras posicionales
+ *
+ * pread/pwrite (ReadFile/WriteFile con OVERLAPPED en Windows) no
+ * comparten un puntero de posición, así que el hilo de E/S y el de
+ * escritura pueden usar el mismo archivo a la vez.
+ */
+class TileFile {
+public:
+    TileFile(const std::string& path, bool writable) : path(path) {
+#if defined(_WIN32)
+        handle = CreateFileA(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                             FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("mathlib::multiply_out_of_core - No se pudo abrir el archivo: " + path);
+        }
+#else
+        fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("mathlib::multiply_out_of_core - No se pudo abrir el archivo: " + path);
+        }
+#endif
+    }
+
+    ~TileFile() {
+#if defined(_WIN32)
+        CloseHandle(handle);
+#else
+        ::close(fd);
+#endif
+    }
+
+    /// Lee exactamente bytes bytes desde offset
+    void read(std::uint64_t offset, void* dst, std::size_t bytes) const {
+        char* out = static_cast<char*>(dst);
+        while (bytes > 0) {
+            std::size_t chunk = std::min<std::size_t>(bytes, 1u << 30);
+#if defined(_WIN32)
+            OVERLAPPED ov = OVERLAPPED();
+            ov.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+            ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD got = 0;
+            if (!ReadFile(handle, out, static_cast<DWORD>(chunk), &got, &ov) || got == 0) {
+                fail("Error al leer");
+            }
+#else
+            ssize_t got = ::pread(fd, out, chunk, static_cast<off_t>(offset));
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) {
+                fail("Error al leer");
+            }
+#endif
+            out += got;
+            offset += static_cast<std::uint64_t>(got);
+            bytes -= static_cast<std::size_t>(got);
+        }
+    }
+
+    /// Escribe exactamente bytes bytes en offset
+    void write(std::uint64_t offset, const void* src, std::size_t bytes) const {
+        const char* in = static_cast<const char*>(src);
+        while (bytes > 0) {
+            std::size_t chunk = std::min<std::size_t>(bytes, 1u << 30);
+#if defined(_WIN32)
+            OVERLAPPED ov = OVERLAPPED();
+            ov.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+            ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+            DWORD put = 0;
+            if (!WriteFile(handle, in, static_cast<DWORD>(chunk), &put, &ov) || put == 0) {
+                fail("Error al escribir");
+            }
+#else
+            ssize_t put = ::pwrite(fd, in, chunk, static_cast<off_t>(offset));
+            if (put < 0 && errno == EINTR) continue;
+            if (put <= 0) {
+                fail("Error al escribir");
+            }
+#endif
+            in += put;
+            offset += static_cast<std::uint64_t>(put);
+            bytes -= static_cast<std::size_t>(put);
+        }
+    }
+
+private:
+    TileFile(const TileFile&);
+    TileFile& operator=(const TileFile&);
+
+    void fail(const char* what) const {
+        throw std::runtime_error(std::string("mathlib::multiply_out_of_core - ") + what + ": " + path);
+    }
+
+    std::string path;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    int fd;
+#endif
+};
+
+/**
+ * @brief Lee la tesela (r0, c0) de nr x nc de una matriz en disco
+ *
+ * La tesela queda contigua en dst (separación nc). Si abarca filas
+ * completas se lee con una sola operación.
+ */
+template <class T>
+void readTile(const TileFile& file, const MatrixFileInfo& info,
+              int r0, int c0, int nr, int nc, T* dst) {
+    std::uint64_t rowBytes = static_cast<std::uint64_t>(info.cols) * sizeof(T);
+    std::uint64_t start = info.data_offset + static_cast<std::uint64_t>(r0) * rowBytes +
+                          static_cast<std::uint64_t>(c0) * sizeof(T);
+    if (nc == info.cols) {
+        file.read(start, dst, static_cast<std::size_t>(nr) * nc * sizeof(T));
+        return;
+    }
+    for (int r = 0; r < nr; ++r) {
+        file.read(start + r * rowBytes, dst + static_cast<std::size_t>(r) * nc,
+                  static_cast<std::size_t>(nc) * sizeof(T));
+    }
+}
+
+/**
+ * @brief Escribe una tesela contigua de nr x nc en la posición (r0, c0)
+ */
+template <class T>
+void writeTile(const TileFile& file, const MatrixFileInfo& info,
+               int r0, int c0, int nr, int nc, const T* src) {
+    std::uint64_t rowBytes = static_cast<std::uint64_t>(info.cols) * sizeof(T);
+    std::uint64_t start = info.data_offset + static_cast<std::uint64_t>(r0) * rowBytes +
+                          static_cast<std::uint64_t>(c0) * sizeof(T);
+    if (nc == info.cols) {
+        file.write(start, src, static_cast<std::size_t>(nr) * nc * sizeof(T));
+        return;
+    }
+    for (int r = 0; r < nr; ++r) {
+        file.write(start + r * rowBytes, src + static_cast<std::size_t>(r) * nc,
+                   static_cast<std::size_t>(nc) * sizeof(T));
+    }
+}
+
+/**
+ * @brief Producto fuera de memoria para el tipo de elemento T
+ */
+template <class T>
+OutOfCoreStats multiplyFiles(const MatrixFileInfo& ia, const MatrixFileInfo& ib,
+                             const std::string& a_path, const std::string& b_path,
+                             const std::string& out_path, const OutOfCoreOptions& options) {
+    const int m = ia.rows;
+    const int k = ia.cols;
+    const int n = ib.cols;
+
+    // Tesela cuadrada que cabe en el presupuesto, recortada a las dimensiones
+    double elems = static_cast<double>(options.memory_budget) / (TILE_BUFFERS * sizeof(T));
+    int t = static_cast<int>(std::sqrt(elems));
+    if (t < 1) {
+        throw std::invalid_argument("mathlib::multiply_out_of_core - El presupuesto de memoria es demasiado pequeño");
+    }
+    OutOfCoreStats stats;
+    stats.tile_rows = std::max(1, std::min(t, m));
+    stats.tile_cols = std::max(1, std::min(t, n));
+    stats.tile_depth = std::max(1, std::min(t, k));
+    stats.bytes_read = 0;
+    stats.bytes_written = 0;
+
+    const int tm = stats.tile_rows;
+    const int tn = stats.tile_cols;
+    const int tk = stats.tile_depth;
+    const std::size_t aElems = static_cast<std::size_t>(tm) * tk;
+    const std::size_t bElems = static_cast<std::size_t>(tk) * tn;
+    const std::size_t cElems = static_cast<std::size_t>(tm) * tn;
+    stats.buffer_bytes = (2 * aElems + 2 * bElems + 3 * cElems) * sizeof(T);
+
+    MatrixFileInfo ic = create_matrix_file(out_path, m, n, DTypeOf<T>::value);
+    if (m == 0 || n == 0) {
+        return stats;
+    }
+
+    TileFile fa(a_path, false);
+    TileFile fb(b_path, false);
+    TileFile fc(out_path, true);
+
+    std::vector<T> aBuf[2] = {std::vector<T>(aElems), std::vector<T>(aElems)};
+    std::vector<T> bBuf[2] = {std::vector<T>(bElems), std::vector<T>(bElems)};
+    std::vector<T> acc[2] = {std::vector<T>(cElems), std::vector<T>(cElems)};
+    std::vector<T> partial(cElems);
+
+    const int tilesM = (m + tm - 1) / tm;
+    const int tilesN = (n + tn - 1) / tn;
+    const int tilesK = k > 0 ? (k + tk - 1) / tk : 0;
+    const long long steps = static_cast<long long>(tilesM) * tilesN * std::max(tilesK, 1);
+
+    // Paso s -> tesela de C (s / tilesK) y bloque de profundidad (s % tilesK)
+    auto load = [&](long long s, int slot) {
+        if (tilesK == 0) return;
+        long long tile = s / tilesK;
+        int p = static_cast<int>(s % tilesK);
+        int i0 = static_cast<int>(tile / tilesN) * tm;
+        int j0 = static_cast<int>(tile % tilesN) * tn;
+        int p0 = p * tk;
+        int mb = std::min(tm, m - i0);
+        int nb = std::min(tn, n - j0);
+        int kb = std::min(tk, k - p0);
+        readTile(fa, ia, i0, p0, mb, kb, &aBuf[slot][0]);
+        readTile(fb, ib, p0, j0, kb, nb, &bBuf[slot][0]);
+    };
+
+    std::future<void> prefetch = std::async(std::launch::async, load, 0LL, 0);
+    std::future<void> writing[2];
+
+    for (long long s = 0; s < steps; ++s) {
+        const int slot = static_cast<int>(s & 1);
+        prefetch.get();
+        if (s + 1 < steps) {
+            prefetch = std::async(std::launch::async, load, s + 1, 1 - slot);
+        }
+
+        long long tile = tilesK > 0 ? s / tilesK : s;
+        int p = tilesK > 0 ? static_cast<int>(s % tilesK) : 0;
+        int i0 = static_cast<int>(tile / tilesN) * tm;
+        int j0 = static_cast<int>(tile % tilesN) * tn;
+        int mb = std::min(tm, m - i0);
+        int nb = std::min(tn, n - j0);
+        int kb = tilesK > 0 ? std::min(tk, k - p * tk) : 0;
+        std::vector<T>& c = acc[tile & 1];
+
+        if (p == 0) {
+            // El acumulador se reutiliza: esperar a que termine su escritura anterior
+            if (writing[tile & 1].valid()) {
+                writing[tile & 1].get();
+            }
+        }
+
+        if (kb == 0) {
+            std::fill(c.begin(), c.begin() + static_cast<std::size_t>(mb) * nb, T());
+        } else {
+            T* dst = p == 0 ? &c[0] : &partial[0];
+            if (options.policy == PARALLEL) {
+                gemm_parallel(mb, nb, kb, &aBuf[slot][0], kb, &bBuf[slot][0], nb, dst, nb,
+                              ThreadPool::global());
+            } else {
+                gemm(mb, nb, kb, &aBuf[slot][0], kb, &bBuf[slot][0], nb, dst, nb);
+            }
+            if (p > 0) {
+                vec_add(static_cast<std::size_t>(mb) * nb, &c[0], &partial[0], &c[0]);
+            }
+            stats.bytes_read += (static_cast<std::uint64_t>(mb) * kb + static_cast<std::uint64_t>(kb) * nb) * sizeof(T);
+        }
+
+        if (p == std::max(tilesK, 1) - 1 || kb == 0) {
+            const T* src = &c[0];
+            writing[tile & 1] = std::async(std::launch::async, [&fc, &ic, i0, j0, mb, nb, src]() {
+                writeTile(fc, ic, i0, j0, mb, nb, src);
+            });
+            stats.bytes_written += static_cast<std::uint64_t>(mb) * nb * sizeof(T);
+        }
+    }
+
+    for (int w = 0; w < 2; ++w) {
+        if (writing[w].valid()) {
+            writing[w].get();
+        }
+    }
+    return stats;
+}
+
+} // namespace
+
+OutOfCoreStats multiply_out_of_core(const std::string& a_path, const std::string& b_path,
+                                    const std::string& out_path, const OutOfCoreOptions& options) {
+    MatrixFileInfo ia = read_matrix_info(a_path);
+    MatrixFileInfo ib = read_matrix_info(b_path);
+    if (ia.cols != ib.rows) {
+        throw std::invalid_argument("mathlib::multiply_out_of_core - Dimensiones incompatibles");
+    }
+    if (ia.dtype != ib.dtype) {
+        throw std::invalid_argument(std::string("mathlib::multiply_out_of_core - Tipos de elemento distintos: ") +
+                                    dtype_name(ia.dtype) + " y " + dtype_name(ib.dtype));
+    }
+    if (ia.little_endian != nativeLittleEndian() || ib.little_endian != nativeLittleEndian()) {
+        throw std::runtime_error("mathlib::multiply_out_of_core - El orden de bytes de los operandos no coincide con el del equipo");
+    }
+    // create_matrix_file() trunca la salida antes de leer los operandos
+    if (sameFile(out_path, a_path) || sameFile(out_path, b_path)) {
+        throw std::invalid_argument("mathlib::multiply_out_of_core - El archivo de salida no puede ser uno de los operandos");
+    }
+    MATHLIB_PROFILE_SCOPE(PROFILE_OUT_OF_CORE, ia.rows, ib.cols, ia.cols,
+                          2.0 * static_cast<double>(ia.rows) * ib.cols * ia.cols);
+
+    switch (ia.dtype) {
+        case DTYPE_FLOAT32:
+            return multiplyFiles<float>(ia, ib, a_path, b_path, out_path, options);
+        case DTYPE_FLOAT64:
+            return multiplyFiles<double>(ia, ib, a_path, b_path, out_path, options);
+        case DTYPE_INT32:
+            return multiplyFiles<int>(ia, ib, a_path, b_path, out_path, options);
+        case DTYPE_COMPLEX128:
+            return multiplyFiles<std::complex<double> >(ia, ib, a_path, b_path, out_path, options);
+    }
+    throw std::invalid_argument("mathlib::multiply_out_of_core - Tipo de elemento no válido");
+}
+
+} // namespace mathlib
@@ -0,0 +1,187 @@
+/**
+ * @file Profiling.cpp
+ * @brief Implementación de los contadores de rendimiento por operación
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los contadores por operación son atómicos para no serializar las
+ * llamadas concurrentes; el histograma de formas usa un mutex, ya que
+ * solo existe en compilaciones con MATHLIB_PROFILING.
+ */
+
+#include "Profiling.h"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace mathlib {
+
+namespace {
+
+const char* const OP_NAMES[PROFILE_OP_COUNT] = {
+    "allocate", "add", "subtract", "hadamard", "scale", "transpose", "multiply",
+    "batched", "spmm", "spmv", "out_of_core", "factorize", "solve", "structured",
+    "gemv"
+};
+
+/**
+ * @brief Contadores de una operación
+ */
+struct OpCounters {
+    std::atomic<unsigned long long> calls;
+    std::atomic<unsigned long long> nanoseconds;
+    std::atomic<unsigned long long> flops;
+    std::atomic<unsigned long long> bytes;
+};
+
+struct ShapeKey {
+    int op;
+    int m;
+    int n;
+    int k;
+
+    bool operator<(const ShapeKey& other) const {
+        if (op != other.op) return op < other.op;
+        if (m != other.m) return m < other.m;
+        if (n != other.n) return n < other.n;
+        return k < other.k;
+    }
+};
+
+struct ShapeValue {
+    unsigned long long calls;
+    unsigned long long nanoseconds;
+};
+
+/**
+ * @brief Estado global de los contadores
+ *
+ * Se crea en el primer uso y no se destruye, para que las matrices
+ * estáticas que se liberen al salir del programa puedan seguir
+ * registrándose.
+ */
+struct ProfileState {
+    OpCounters ops[PROFILE_OP_COUNT];
+    std::mutex shapeMutex;
+    std::map<ShapeKey, ShapeValue> shapes;
+    ProfileHooks hooks;
+
+    ProfileState() {
+        for (int i = 0; i < PROFILE_OP_COUNT; ++i) {
+            ops[i].calls = 0;
+            ops[i].nanoseconds = 0;
+            ops[i].flops = 0;
+            ops[i].bytes = 0;
+        }
+    }
+};
+
+ProfileState& state() {
+    static ProfileState* instance = new ProfileState();
+    return *instance;
+}
+
+} // namespace
+
+const char* profile_op_name(ProfileOp op) {
+    return op >= 0 && op < PROFILE_OP_COUNT ? OP_NAMES[op] : "unknown";
+}
+
+bool profiling_enabled() {
+#if defined(MATHLIB_PROFILING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+ProfileSnapshot profile_snapshot() {
+    ProfileSnapshot snapshot;
+    snapshot.enabled = profiling_enabled();
+    ProfileState& s = state();
+    for (int i = 0; i < PROFILE_OP_COUNT; ++i) {
+        OperationStats stats;
+        stats.op = static_cast<ProfileOp>(i);
+        stats.name = OP_NAMES[i];
+        stats.calls = s.ops[i].calls.load(std::memory_order_relaxed);
+        stats.seconds = static_cast<double>(s.ops[i].nanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+        stats.flops = static_cast<double>(s.ops[i].flops.load(std::memory_order_relaxed));
+        stats.bytes = s.ops[i].bytes.load(std::memory_order_relaxed);
+        snapshot.operations.push_back(stats);
+    }
+
+    std::lock_guard<std::mutex> lock(s.shapeMutex);
+    for (std::map<ShapeKey, ShapeValue>::const_iterator it = s.shapes.begin(); it != s.shapes.end(); ++it) {
+        ShapeStats shape;
+        shape.op = static_cast<ProfileOp>(it->first.op);
+        shape.m = it->first.m;
+        shape.n = it->first.n;
+        shape.k = it->first.k;
+        shape.calls = it->second.calls;
+        shape.seconds = static_cast<double>(it->second.nanoseconds) * 1e-9;
+        snapshot.shapes.push_back(shape);
+    }
+    std::stable_sort(snapshot.shapes.begin(), snapshot.shapes.end(),
+                     [](const ShapeStats& a, const ShapeStats& b) { return a.calls > b.calls; });
+    return snapshot;
+}
+
+void profile_reset() {
+    ProfileState& s = state();
+    for (int i = 0; i < PROFILE_OP_COUNT; ++i) {
+        s.ops[i].calls = 0;
+        s.ops[i].nanoseconds = 0;
+        s.ops[i].flops = 0;
+        s.ops[i].bytes = 0;
+    }
+    std::lock_guard<std::mutex> lock(s.shapeMutex);
+    s.shapes.clear();
+}
+
+void set_profile_hooks(const ProfileHooks& hooks) {
+    state().hooks = hooks;
+}
+
+ProfileScope::ProfileScope(ProfileOp op, int m, int n, int k, double flops, std::size_t bytes)
+    : op(op), m(m), n(n), k(k), flops(flops), bytes(bytes) {
+    const ProfileHooks& hooks = state().hooks;
+    if (hooks.begin) {
+        hooks.begin(op, m, n, k, hooks.user);
+    }
+    start = std::chrono::steady_clock::now();
+}
+
+ProfileScope::~ProfileScope() {
+    const unsigned long long elapsed = static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    ProfileState& s = state();
+    OpCounters& counters = s.ops[op];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+    counters.flops.fetch_add(static_cast<unsigned long long>(flops), std::memory_order_relaxed);
+    counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    if (op != PROFILE_ALLOCATE) {
+        ShapeKey key = {op, m, n, k};
+        std::lock_guard<std::mutex> lock(s.shapeMutex);
+        std::map<ShapeKey, ShapeValue>::iterator it = s.shapes.find(key);
+        if (it == s.shapes.end()) {
+            if (static_cast<int>(s.shapes.size()) >= PROFILE_MAX_SHAPES) {
+                ShapeKey other = {op, -1, -1, -1};
+                key = other;
+            }
+            ShapeValue zero = {0, 0};
+            it = s.shapes.insert(std::make_pair(key, zero)).first;
+        }
+        it->second.calls += 1;
+        it->second.nanoseconds += elapsed;
+    }
+
+    if (s.hooks.end) {
+        s.hooks.end(op, s.hooks.user);
+    }
+}
+
+} // namespace mathlib
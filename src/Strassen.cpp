@@ -0,0 +1,267 @@
+/**
+ * @file Strassen.cpp
+ * @brief Multiplicación rápida de Strassen-Winograd
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada nivel usa dos temporales: X (m/2 x max(k/2, n/2)) e Y
+ * (k/2 x n/2), con el orden de operaciones de Boyer, Dumas, Pernet y
+ * Zhou («Memory efficient scheduling of Strassen-Winograd's matrix
+ * multiplication algorithm», 2009), que guarda los productos parciales
+ * en los propios bloques de C. Todo el espacio de trabajo se reserva una
+ * vez antes de empezar la recursión, y las 7^d hojas empaquetan sus
+ * paneles en los buffers por hilo del producto por bloques (Gemm.cpp),
+ * que ya tienen el tamaño de la primera hoja: la recursión no reserva.
+ */
+
+#include "Gemm.h"
+#include "GemmInternal.h"
+#include "Kernels.h"
+#include "KernelsInternal.h"
+#include "ThreadPool.h"
+#include "Tuning.h"
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+namespace mathlib {
+
+namespace {
+
+/**
+ * @brief Niveles de recursión: mientras las tres dimensiones a la mitad sigan >= crossover
+ */
+int strassenDepth(int m, int n, int k, int crossover) {
+    int depth = 0;
+    int smallest = std::min(m, std::min(n, k));
+    while (smallest / 2 >= crossover) {
+        smallest /= 2;
+        ++depth;
+    }
+    return depth;
+}
+
+/// Redondea d hacia arriba a un múltiplo de 2^depth
+int padTo(int d, int depth) {
+    const int unit = 1 << depth;
+    return (d + unit - 1) / unit * unit;
+}
+
+/// Elementos de temporales que necesitan los niveles restantes
+std::size_t levelWorkspace(int m, int n, int k, int depth) {
+    std::size_t total = 0;
+    for (; depth > 0; --depth) {
+        m /= 2;
+        n /= 2;
+        k /= 2;
+        total += static_cast<std::size_t>(m) * std::max(k, n) + static_cast<std::size_t>(k) * n;
+    }
+    return total;
+}
+
+template <class T>
+void blockAdd(int rows, int cols, const T* a, int lda, const T* b, int ldb, T* out, int ldo) {
+    apply_elementwise<T>(vec_add, rows, cols, a, lda, b, ldb, out, ldo);
+}
+
+template <class T>
+void blockSub(int rows, int cols, const T* a, int lda, const T* b, int ldb, T* out, int ldo) {
+    apply_elementwise<T>(vec_sub, rows, cols, a, lda, b, ldb, out, ldo);
+}
+
+/// Copia un bloque rows x cols y rellena con ceros hasta prows x pcols
+template <class T>
+void copyPadded(int rows, int cols, const T* src, int lds, int prows, int pcols, T* dst) {
+    for (int i = 0; i < prows; ++i) {
+        T* out = dst + static_cast<std::size_t>(i) * pcols;
+        if (i < rows) {
+            std::copy(src + static_cast<std::size_t>(i) * lds,
+                      src + static_cast<std::size_t>(i) * lds + cols, out);
+            std::fill(out + cols, out + pcols, T());
+        } else {
+            std::fill(out, out + pcols, T());
+        }
+    }
+}
+
+/// Producto clásico de las hojas con los parámetros params
+template <class T>
+void leafGemm(const TuningParameters& params, int m, int n, int k,
+              const T* A, int lda, const T* B, int ldb, T* C, int ldc, ExecutionPolicy policy) {
+    if (policy == PARALLEL) {
+        gemm_parallel(params, NO_TRANS, NO_TRANS, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc,
+                      ThreadPool::global());
+    } else {
+        gemm(params, NO_TRANS, NO_TRANS, m, n, k, T(1), A, lda, B, ldb, T(), C, ldc);
+    }
+}
+
+/**
+ * @brief Un nivel de Strassen-Winograd; m, n y k son múltiplos de 2^depth
+ */
+template <class T>
+void winograd(const TuningParameters& params, int m, int n, int k,
+              const T* A, int lda, const T* B, int ldb, T* C, int ldc,
+              int depth, T* work, ExecutionPolicy policy) {
+    if (depth == 0) {
+        leafGemm(params, m, n, k, A, lda, B, ldb, C, ldc, policy);
+        return;
+    }
+
+    const int m2 = m / 2;
+    const int n2 = n / 2;
+    const int k2 = k / 2;
+
+    const T* A11 = A;
+    const T* A12 = A + k2;
+    const T* A21 = A + static_cast<std::size_t>(m2) * lda;
+    const T* A22 = A21 + k2;
+    const T* B11 = B;
+    const T* B12 = B + n2;
+    const T* B21 = B + static_cast<std::size_t>(k2) * ldb;
+    const T* B22 = B21 + n2;
+    T* C11 = C;
+    T* C12 = C + n2;
+    T* C21 = C + static_cast<std::size_t>(m2) * ldc;
+    T* C22 = C21 + n2;
+
+    // X guarda primero sumas de bloques de A (separación k2) y después P1 (separación n2)
+    T* X = work;
+    T* Y = X + static_cast<std::size_t>(m2) * std::max(k2, n2);
+    T* next = Y + static_cast<std::size_t>(k2) * n2;
+    const int d = depth - 1;
+
+    blockSub(m2, k2, A11, lda, A21, lda, X, k2);                   // S3 = A11 - A21
+    blockSub(k2, n2, B22, ldb, B12, ldb, Y, n2);                   // T3 = B22 - B12
+    winograd(params, m2, n2, k2, X, k2, Y, n2, C21, ldc, d, next, policy); // P7 = S3·T3
+    blockAdd(m2, k2, A21, lda, A22, lda, X, k2);                   // S1 = A21 + A22
+    blockSub(k2, n2, B12, ldb, B11, ldb, Y, n2);                   // T1 = B12 - B11
+    winograd(params, m2, n2, k2, X, k2, Y, n2, C22, ldc, d, next, policy); // P5 = S1·T1
+    blockSub(m2, k2, X, k2, A11, lda, X, k2);                      // S2 = S1 - A11
+    blockSub(k2, n2, B22, ldb, Y, n2, Y, n2);                      // T2 = B22 - T1
+    winograd(params, m2, n2, k2, X, k2, Y, n2, C12, ldc, d, next, policy); // P6 = S2·T2
+    blockSub(m2, k2, A12, lda, X, k2, X, k2);                      // S4 = A12 - S2
+    winograd(params, m2, n2, k2, X, k2, B22, ldb, C11, ldc, d, next, policy); // P3 = S4·B22
+    winograd(params, m2, n2, k2, A11, lda, B11, ldb, X, n2, d, next, policy); // P1 = A11·B11
+    blockAdd(m2, n2, X, n2, C12, ldc, C12, ldc);                   // U2 = P1 + P6
+    blockAdd(m2, n2, C12, ldc, C21, ldc, C21, ldc);                // U3 = U2 + P7
+    blockAdd(m2, n2, C12, ldc, C22, ldc, C12, ldc);                // U4 = U2 + P5
+    blockAdd(m2, n2, C21, ldc, C22, ldc, C22, ldc);                // U7 = U3 + P5 -> C22
+    blockAdd(m2, n2, C12, ldc, C11, ldc, C12, ldc);                // U5 = U4 + P3 -> C12
+    blockSub(k2, n2, Y, n2, B21, ldb, Y, n2);                      // T4 = T2 - B21
+    winograd(params, m2, n2, k2, A22, lda, Y, n2, C11, ldc, d, next, policy); // P4 = A22·T4
+    blockSub(m2, n2, C21, ldc, C11, ldc, C21, ldc);                // U6 = U3 - P4 -> C21
+    winograd(params, m2, n2, k2, A12, lda, B21, ldb, C11, ldc, d, next, policy); // P2 = A12·B21
+    blockAdd(m2, n2, X, n2, C11, ldc, C11, ldc);                   // U1 = P1 + P2 -> C11
+}
+
+} // namespace
+
+template <class T>
+std::size_t gemm_strassen_workspace(int m, int n, int k, int crossover) {
+    if (m <= 0 || n <= 0 || k <= 0 || crossover < 1) {
+        return 0;
+    }
+    const int depth = strassenDepth(m, n, k, crossover);
+    if (depth == 0) {
+        return 0;
+    }
+    const int mp = padTo(m, depth);
+    const int np = padTo(n, depth);
+    const int kp = padTo(k, depth);
+    std::size_t total = levelWorkspace(mp, np, kp, depth);
+    if (mp != m || np != n || kp != k) {
+        total += static_cast<std::size_t>(mp) * kp + static_cast<std::size_t>(kp) * np +
+                 static_cast<std::size_t>(mp) * np;
+    }
+    return total;
+}
+
+namespace {
+
+/**
+ * @brief gemm_strassen() con los parámetros params en los productos de las hojas
+ */
+template <class T>
+void strassen(const TuningParameters& params, int m, int n, int k,
+              const T* A, int lda,
+              const T* B, int ldb,
+              T* C, int ldc,
+              int crossover, T* workspace,
+              ExecutionPolicy policy) {
+    if (crossover < 1) {
+        throw std::invalid_argument("mathlib::gemm_strassen - El umbral debe ser positivo");
+    }
+    const int depth = m > 0 && n > 0 && k > 0 ? strassenDepth(m, n, k, crossover) : 0;
+    if (depth == 0) {
+        leafGemm(params, m, n, k, A, lda, B, ldb, C, ldc, policy);
+        return;
+    }
+
+    std::vector<T> owned;
+    if (!workspace) {
+        owned.resize(gemm_strassen_workspace<T>(m, n, k, crossover));
+        workspace = &owned[0];
+    }
+
+    const int mp = padTo(m, depth);
+    const int np = padTo(n, depth);
+    const int kp = padTo(k, depth);
+    if (mp == m && np == n && kp == k) {
+        winograd(params, m, n, k, A, lda, B, ldb, C, ldc, depth, workspace, policy);
+        return;
+    }
+
+    // Copias rellenadas con ceros: los bloques sobrantes no alteran el producto
+    T* Ap = workspace;
+    T* Bp = Ap + static_cast<std::size_t>(mp) * kp;
+    T* Cp = Bp + static_cast<std::size_t>(kp) * np;
+    T* work = Cp + static_cast<std::size_t>(mp) * np;
+    copyPadded(m, k, A, lda, mp, kp, Ap);
+    copyPadded(k, n, B, ldb, kp, np, Bp);
+    winograd(params, mp, np, kp, Ap, kp, Bp, np, Cp, np, depth, work, policy);
+    for (int i = 0; i < m; ++i) {
+        std::copy(Cp + static_cast<std::size_t>(i) * np,
+                  Cp + static_cast<std::size_t>(i) * np + n,
+                  C + static_cast<std::size_t>(i) * ldc);
+    }
+}
+
+} // namespace
+
+template <class T>
+void gemm_strassen(int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   int crossover, T* workspace,
+                   ExecutionPolicy policy) {
+    strassen(tuning(), m, n, k, A, lda, B, ldb, C, ldc, crossover, workspace, policy);
+}
+
+template <class T>
+void gemm_strassen(const TuningParameters& params, int m, int n, int k,
+                   const T* A, int lda,
+                   const T* B, int ldb,
+                   T* C, int ldc,
+                   int crossover, T* workspace) {
+    strassen(params, m, n, k, A, lda, B, ldb, C, ldc, crossover, workspace, SEQUENTIAL);
+}
+
+#define MATHLIB_INSTANTIATE_STRASSEN(T)                                            \
+    template std::size_t gemm_strassen_workspace<T>(int, int, int, int);           \
+    template void gemm_strassen<T>(int, int, int, const T*, int, const T*, int,    \
+                                   T*, int, int, T*, ExecutionPolicy);             \
+    template void gemm_strassen<T>(const TuningParameters&, int, int, int,         \
+                                   const T*, int, const T*, int, T*, int, int, T*);
+
+MATHLIB_INSTANTIATE_STRASSEN(float)
+MATHLIB_INSTANTIATE_STRASSEN(double)
+MATHLIB_INSTANTIATE_STRASSEN(int)
+MATHLIB_INSTANTIATE_STRASSEN(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_STRASSEN
+
+} // namespace mathlib
@@ -0,0 +1,546 @@
+/**
+ * @file Structured.cpp
+ * @brief Implementación de las matrices simétricas, triangulares y de banda
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * SYMM y TRMM trabajan por paneles de filas: cada panel se
+ * desempaqueta en un búfer denso (coste O(n) por fila, despreciable frente
+ * al producto) y se multiplica con gemm(). Con PARALLEL los paneles se
+ * reparten entre los hilos si hay suficientes; si no, se recorren en serie
+ * y cada producto de panel se reparte en el grupo con gemm_parallel().
+ */
+
+#include "Structured.h"
+#include "Matrix.h"
+#include "Kernels.h"
+#include "Profiling.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+namespace mathlib {
+
+namespace {
+
+/// Filas de cada panel desempaquetado en SYMM
+const int SYMM_PANEL = 256;
+
+/// Filas de cada panel de TRMM; más bajos desperdician menos en el bloque diagonal
+const int TRMM_PANEL = 128;
+
+/// Operaciones mínimas por bloque al repartir entre hilos
+const double STRUCTURED_PARALLEL_GRAIN = 32768.0;
+
+/// Bloques por hilo al repartir las filas, para equilibrar la carga
+const int STRUCTURED_CHUNKS_PER_THREAD = 4;
+
+/// Grupo de hilos a usar, o nullptr si el trabajo debe hacerse en serie
+ThreadPool* poolFor(ExecutionPolicy policy, double work) {
+    if (policy != PARALLEL || work < 2 * STRUCTURED_PARALLEL_GRAIN) {
+        return nullptr;
+    }
+    ThreadPool* pool = &ThreadPool::global();
+    return pool->size() > 1 ? pool : nullptr;
+}
+
+/// Número de bloques en que se reparten count elementos con work operaciones
+int chunkCount(const ThreadPool* pool, int count, double work) {
+    if (pool == nullptr) {
+        return 1;
+    }
+    double byWork = work / STRUCTURED_PARALLEL_GRAIN;
+    int chunks = static_cast<int>(std::min(byWork, static_cast<double>(pool->size() * STRUCTURED_CHUNKS_PER_THREAD)));
+    return std::max(1, std::min(chunks, count));
+}
+
+/**
+ * @brief Ejecuta body(first, last) sobre bloques de filas del mismo tamaño
+ *
+ * Si el trabajo es pequeño o la política es secuencial se hace una sola
+ * llamada con todas las filas.
+ */
+template <class Body>
+void forRowChunks(int rows, double work, ExecutionPolicy policy, const Body& body) {
+    ThreadPool* pool = poolFor(policy, work);
+    const int chunks = chunkCount(pool, rows, work);
+    if (chunks <= 1) {
+        body(0, rows);
+        return;
+    }
+    pool->parallel_for(chunks, [&](int t) {
+        int first = static_cast<int>(static_cast<long long>(rows) * t / chunks);
+        int last = static_cast<int>(static_cast<long long>(rows) * (t + 1) / chunks);
+        if (first < last) {
+            body(first, last);
+        }
+    });
+}
+
+/**
+ * @brief Ejecuta body(p, inner) para cada panel de filas
+ *
+ * inner es el grupo en el que debe repartirse el producto del panel, o
+ * nullptr si el panel se calcula en serie (porque los paneles ya se
+ * reparten entre los hilos o porque el trabajo es pequeño).
+ */
+template <class Body>
+void forPanels(int panels, double work, ExecutionPolicy policy, const Body& body) {
+    ThreadPool* pool = poolFor(policy, work);
+    if (pool != nullptr && panels >= pool->size()) {
+        pool->parallel_for(panels, [&](int p) { body(p, static_cast<ThreadPool*>(nullptr)); });
+        return;
+    }
+    for (int p = 0; p < panels; ++p) {
+        body(p, pool);
+    }
+}
+
+/// C = A × B con el GEMM serie o el repartido en inner
+template <class T>
+void panelGemm(int m, int n, int k, const T* A, int lda, const T* B, int ldb, T* C, int ldc, ThreadPool* inner) {
+    if (inner != nullptr) {
+        gemm_parallel(m, n, k, A, lda, B, ldb, C, ldc, *inner);
+    } else {
+        gemm(m, n, k, A, lda, B, ldb, C, ldc);
+    }
+}
+
+std::size_t triangle(int n) {
+    return static_cast<std::size_t>(n) * (static_cast<std::size_t>(n) + 1) / 2;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// BasicSymmetricMatrix
+// ---------------------------------------------------------------------------
+
+template <class T>
+BasicSymmetricMatrix<T>::BasicSymmetricMatrix(int order) : n(order) {
+    if (order <= 0) {
+        throw std::invalid_argument("SymmetricMatrix::SymmetricMatrix - El orden debe ser positivo");
+    }
+    vals.assign(triangle(order), T());
+}
+
+template <class T>
+BasicSymmetricMatrix<T> BasicSymmetricMatrix<T>::from_dense(const BasicMatrix<T>& dense, Uplo uplo) {
+    if (dense.num_rows() != dense.num_cols()) {
+        throw std::invalid_argument("SymmetricMatrix::from_dense - La matriz debe ser cuadrada");
+    }
+    BasicSymmetricMatrix result(dense.num_rows());
+    T* out = result.vals.data();
+    for (int i = 0; i < result.n; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            *out++ = uplo == LOWER ? dense(i, j) : dense(j, i);
+        }
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicSymmetricMatrix<T>::to_dense() const {
+    BasicMatrix<T> dense(n, n, BasicMatrix<T>::UNINITIALIZED);
+    const T* row = vals.data();
+    for (int i = 0; i < n; ++i, row += i) {
+        for (int j = 0; j <= i; ++j) {
+            dense(i, j) = row[j];
+            dense(j, i) = row[j];
+        }
+    }
+    return dense;
+}
+
+template <class T>
+std::size_t BasicSymmetricMatrix<T>::offset(int r, int c) const {
+    if (r < c) {
+        std::swap(r, c);
+    }
+    return triangle(r) + c;
+}
+
+template <class T>
+T BasicSymmetricMatrix<T>::get(int r, int c) const {
+    if (r < 0 || r >= n || c < 0 || c >= n) {
+        throw std::out_of_range("SymmetricMatrix::get - Índice fuera de rango");
+    }
+    return vals[offset(r, c)];
+}
+
+template <class T>
+void BasicSymmetricMatrix<T>::set(int r, int c, T value) {
+    if (r < 0 || r >= n || c < 0 || c >= n) {
+        throw std::out_of_range("SymmetricMatrix::set - Índice fuera de rango");
+    }
+    vals[offset(r, c)] = value;
+}
+
+template <class T>
+BasicSymmetricMatrix<T> BasicSymmetricMatrix<T>::add(const BasicSymmetricMatrix& other) const {
+    if (n != other.n) {
+        throw std::invalid_argument("SymmetricMatrix::add - Las matrices deben tener el mismo orden");
+    }
+    MATHLIB_PROFILE_SCOPE(PROFILE_ADD, n, n, 0, static_cast<double>(vals.size()));
+    BasicSymmetricMatrix result(*this);
+    vec_add(vals.size(), vals.data(), other.vals.data(), result.vals.data());
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicSymmetricMatrix<T>::multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy) const {
+    if (dense.num_rows() != n) {
+        throw std::invalid_argument("SymmetricMatrix::multiply - Dimensiones incompatibles");
+    }
+    const int k = dense.num_cols();
+    const double flops = 2.0 * n * n * k;
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, n, k, n, flops);
+    BasicMatrix<T> out(n, k, BasicMatrix<T>::UNINITIALIZED);
+    const int panels = (n + SYMM_PANEL - 1) / SYMM_PANEL;
+
+    forPanels(panels, flops, policy, [&](int p, ThreadPool* inner) {
+        const int i0 = p * SYMM_PANEL;
+        const int height = std::min(SYMM_PANEL, n - i0);
+        std::vector<T> panel(static_cast<std::size_t>(height) * n);
+        // Parte de cada fila hasta la diagonal, contigua en el empaquetado
+        for (int r = 0; r < height; ++r) {
+            const int i = i0 + r;
+            const T* row = vals.data() + triangle(i);
+            std::copy(row, row + i + 1, panel.data() + static_cast<std::size_t>(r) * n);
+        }
+        // A la derecha de la diagonal, (i, j) = (j, i): se recorren las filas
+        // j siguientes, cuyos elementos i0..i0 + height también son contiguos
+        for (int j = i0 + 1; j < n; ++j) {
+            const T* row = vals.data() + triangle(j);
+            const int last = std::min(j, i0 + height);
+            for (int i = i0; i < last; ++i) {
+                panel[static_cast<std::size_t>(i - i0) * n + j] = row[i];
+            }
+        }
+        panelGemm(height, k, n, panel.data(), n, dense.data(), dense.stride(),
+                  out.data() + static_cast<std::size_t>(i0) * out.stride(), out.stride(), inner);
+    });
+    return out;
+}
+
+template <class T>
+void BasicSymmetricMatrix<T>::multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy) const {
+    if (x.size() != static_cast<std::size_t>(n) || y.size() != static_cast<std::size_t>(n)) {
+        throw std::invalid_argument("SymmetricMatrix::multiply_vector - Los tamaños de los vectores no coinciden");
+    }
+    const double work = 2.0 * static_cast<double>(vals.size());
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, n, 1, n, work);
+    const T* xs = x.data();
+
+    // Filas [first, last) acumuladas en acc (que debe tener last elementos a cero)
+    auto rowsInto = [&](int first, int last, T* acc) {
+        for (int i = first; i < last; ++i) {
+            const T* row = vals.data() + triangle(i);
+            acc[i] += vec_dot(static_cast<std::size_t>(i), row, xs) + row[i] * xs[i];
+            vec_axpy(static_cast<std::size_t>(i), xs[i], row, acc);
+        }
+    };
+
+    ThreadPool* pool = poolFor(policy, work);
+    const int chunks = chunkCount(pool, n, work);
+    if (chunks <= 1) {
+        std::fill(y.begin(), y.end(), T());
+        rowsInto(0, n, y.data());
+        return;
+    }
+    // Bloques con un número parecido de elementos: la fila i tiene i + 1,
+    // así que el bloque t empieza en n·sqrt(t / chunks)
+    std::vector<int> bounds(chunks + 1, n);
+    for (int t = 0; t < chunks; ++t) {
+        bounds[t] = static_cast<int>(n * std::sqrt(static_cast<double>(t) / chunks));
+    }
+    std::vector<std::vector<T> > partial(chunks);
+    pool->parallel_for(chunks, [&](int t) {
+        partial[t].assign(static_cast<std::size_t>(bounds[t + 1]), T());
+        rowsInto(bounds[t], bounds[t + 1], partial[t].data());
+    });
+    std::fill(y.begin(), y.end(), T());
+    for (int t = 0; t < chunks; ++t) {
+        vec_add(partial[t].size(), y.data(), partial[t].data(), y.data());
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BasicTriangularMatrix
+// ---------------------------------------------------------------------------
+
+template <class T>
+BasicTriangularMatrix<T>::BasicTriangularMatrix(int order, Uplo uplo) : n(order), part(uplo) {
+    if (order <= 0) {
+        throw std::invalid_argument("TriangularMatrix::TriangularMatrix - El orden debe ser positivo");
+    }
+    vals.assign(triangle(order), T());
+}
+
+template <class T>
+std::size_t BasicTriangularMatrix<T>::rowStart(int r) const {
+    return part == LOWER ? triangle(r) : triangle(n) - triangle(n - r);
+}
+
+template <class T>
+BasicTriangularMatrix<T> BasicTriangularMatrix<T>::from_dense(const BasicMatrix<T>& dense, Uplo uplo) {
+    if (dense.num_rows() != dense.num_cols()) {
+        throw std::invalid_argument("TriangularMatrix::from_dense - La matriz debe ser cuadrada");
+    }
+    BasicTriangularMatrix result(dense.num_rows(), uplo);
+    T* out = result.vals.data();
+    for (int i = 0; i < result.n; ++i) {
+        const T* row = dense.data() + static_cast<std::size_t>(i) * dense.stride();
+        out = std::copy(row + result.firstCol(i), row + result.lastCol(i), out);
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicTriangularMatrix<T>::to_dense() const {
+    BasicMatrix<T> dense(n, n);
+    for (int i = 0; i < n; ++i) {
+        const T* row = vals.data() + rowStart(i);
+        std::copy(row, row + (lastCol(i) - firstCol(i)),
+                  dense.data() + static_cast<std::size_t>(i) * dense.stride() + firstCol(i));
+    }
+    return dense;
+}
+
+template <class T>
+T BasicTriangularMatrix<T>::get(int r, int c) const {
+    if (r < 0 || r >= n || c < 0 || c >= n) {
+        throw std::out_of_range("TriangularMatrix::get - Índice fuera de rango");
+    }
+    if (c < firstCol(r) || c >= lastCol(r)) {
+        return T();
+    }
+    return vals[rowStart(r) + (c - firstCol(r))];
+}
+
+template <class T>
+void BasicTriangularMatrix<T>::set(int r, int c, T value) {
+    if (r < 0 || r >= n || c < 0 || c >= n) {
+        throw std::out_of_range("TriangularMatrix::set - Índice fuera de rango");
+    }
+    if (c < firstCol(r) || c >= lastCol(r)) {
+        throw std::out_of_range("TriangularMatrix::set - La posición está fuera del triángulo");
+    }
+    vals[rowStart(r) + (c - firstCol(r))] = value;
+}
+
+template <class T>
+BasicTriangularMatrix<T> BasicTriangularMatrix<T>::add(const BasicTriangularMatrix& other) const {
+    if (n != other.n || part != other.part) {
+        throw std::invalid_argument("TriangularMatrix::add - Las matrices deben tener el mismo orden y triángulo");
+    }
+    MATHLIB_PROFILE_SCOPE(PROFILE_ADD, n, n, 0, static_cast<double>(vals.size()));
+    BasicTriangularMatrix result(*this);
+    vec_add(vals.size(), vals.data(), other.vals.data(), result.vals.data());
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicTriangularMatrix<T>::multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy) const {
+    if (dense.num_rows() != n) {
+        throw std::invalid_argument("TriangularMatrix::multiply - Dimensiones incompatibles");
+    }
+    const int k = dense.num_cols();
+    const double flops = 2.0 * static_cast<double>(vals.size()) * k;
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, n, k, n, flops);
+    BasicMatrix<T> out(n, k, BasicMatrix<T>::UNINITIALIZED);
+    const int panels = (n + TRMM_PANEL - 1) / TRMM_PANEL;
+
+    forPanels(panels, flops, policy, [&](int p, ThreadPool* inner) {
+        const int i0 = p * TRMM_PANEL;
+        const int height = std::min(TRMM_PANEL, n - i0);
+        // Columnas que tocan las filas del panel: [0, i0 + height) en LOWER
+        // y [i0, n) en UPPER; el resto del triángulo del bloque diagonal es cero
+        const int c0 = part == LOWER ? 0 : i0;
+        const int c1 = part == LOWER ? i0 + height : n;
+        const int depth = c1 - c0;
+        std::vector<T> panel(static_cast<std::size_t>(height) * depth, T());
+        for (int r = 0; r < height; ++r) {
+            const int i = i0 + r;
+            const T* row = vals.data() + rowStart(i);
+            std::copy(row, row + (lastCol(i) - firstCol(i)),
+                      panel.data() + static_cast<std::size_t>(r) * depth + (firstCol(i) - c0));
+        }
+        panelGemm(height, k, depth, panel.data(), depth,
+                  dense.data() + static_cast<std::size_t>(c0) * dense.stride(), dense.stride(),
+                  out.data() + static_cast<std::size_t>(i0) * out.stride(), out.stride(), inner);
+    });
+    return out;
+}
+
+template <class T>
+void BasicTriangularMatrix<T>::multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy) const {
+    if (x.size() != static_cast<std::size_t>(n) || y.size() != static_cast<std::size_t>(n)) {
+        throw std::invalid_argument("TriangularMatrix::multiply_vector - Los tamaños de los vectores no coinciden");
+    }
+    const double work = 2.0 * static_cast<double>(vals.size());
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, n, 1, n, work);
+    const T* xs = x.data();
+    T* ys = y.data();
+    forRowChunks(n, work, policy, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            ys[i] = vec_dot(static_cast<std::size_t>(lastCol(i) - firstCol(i)), vals.data() + rowStart(i), xs + firstCol(i));
+        }
+    });
+}
+
+// ---------------------------------------------------------------------------
+// BasicBandedMatrix
+// ---------------------------------------------------------------------------
+
+template <class T>
+BasicBandedMatrix<T>::BasicBandedMatrix(int r, int c, int kl, int ku)
+    : rows(r), cols(c), lower(kl), upper(ku) {
+    if (r <= 0 || c <= 0) {
+        throw std::invalid_argument("BandedMatrix::BandedMatrix - Las dimensiones deben ser positivas");
+    }
+    if (kl < 0 || ku < 0) {
+        throw std::invalid_argument("BandedMatrix::BandedMatrix - Los anchos de banda no pueden ser negativos");
+    }
+    // Anchos mayores que la matriz no añaden elementos
+    lower = std::min(kl, r - 1);
+    upper = std::min(ku, c - 1);
+    vals.assign(static_cast<std::size_t>(r) * width(), T());
+}
+
+template <class T>
+BasicBandedMatrix<T> BasicBandedMatrix<T>::from_dense(const BasicMatrix<T>& dense, int kl, int ku) {
+    if (kl < 0 || ku < 0) {
+        throw std::invalid_argument("BandedMatrix::from_dense - Los anchos de banda no pueden ser negativos");
+    }
+    BasicBandedMatrix result(dense.num_rows(), dense.num_cols(), kl, ku);
+    for (int i = 0; i < result.rows; ++i) {
+        const T* row = dense.data() + static_cast<std::size_t>(i) * dense.stride();
+        T* dst = result.vals.data() + result.rowBase(i);
+        for (int j = result.firstCol(i); j < result.lastCol(i); ++j) {
+            dst[j] = row[j];
+        }
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicBandedMatrix<T>::to_dense() const {
+    BasicMatrix<T> dense(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+        const T* src = vals.data() + rowBase(i);
+        T* row = dense.data() + static_cast<std::size_t>(i) * dense.stride();
+        for (int j = firstCol(i); j < lastCol(i); ++j) {
+            row[j] = src[j];
+        }
+    }
+    return dense;
+}
+
+template <class T>
+T BasicBandedMatrix<T>::get(int r, int c) const {
+    if (r < 0 || r >= rows || c < 0 || c >= cols) {
+        throw std::out_of_range("BandedMatrix::get - Índice fuera de rango");
+    }
+    if (c - r > upper || r - c > lower) {
+        return T();
+    }
+    return vals[rowBase(r) + c];
+}
+
+template <class T>
+void BasicBandedMatrix<T>::set(int r, int c, T value) {
+    if (r < 0 || r >= rows || c < 0 || c >= cols) {
+        throw std::out_of_range("BandedMatrix::set - Índice fuera de rango");
+    }
+    if (c - r > upper || r - c > lower) {
+        throw std::out_of_range("BandedMatrix::set - La posición está fuera de la banda");
+    }
+    vals[rowBase(r) + c] = value;
+}
+
+template <class T>
+BasicBandedMatrix<T> BasicBandedMatrix<T>::add(const BasicBandedMatrix& other) const {
+    if (rows != other.rows || cols != other.cols) {
+        throw std::invalid_argument("BandedMatrix::add - Las matrices deben tener el mismo tamaño");
+    }
+    MATHLIB_PROFILE_SCOPE(PROFILE_ADD, rows, cols, 0, static_cast<double>(std::max(vals.size(), other.vals.size())));
+    if (lower == other.lower && upper == other.upper) {
+        BasicBandedMatrix result(*this);
+        vec_add(vals.size(), vals.data(), other.vals.data(), result.vals.data());
+        return result;
+    }
+    BasicBandedMatrix result(rows, cols, std::max(lower, other.lower), std::max(upper, other.upper));
+    const BasicBandedMatrix* operands[2] = {this, &other};
+    for (int o = 0; o < 2; ++o) {
+        const BasicBandedMatrix& op = *operands[o];
+        for (int i = 0; i < rows; ++i) {
+            const T* src = op.vals.data() + op.rowBase(i) + op.firstCol(i);
+            T* dst = result.vals.data() + result.rowBase(i) + op.firstCol(i);
+            const int count = op.lastCol(i) - op.firstCol(i);
+            vec_add(static_cast<std::size_t>(count), dst, src, dst);
+        }
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicBandedMatrix<T>::multiply(const BasicMatrix<T>& dense, ExecutionPolicy policy) const {
+    if (dense.num_rows() != cols) {
+        throw std::invalid_argument("BandedMatrix::multiply - Dimensiones incompatibles");
+    }
+    const int k = dense.num_cols();
+    const double flops = 2.0 * static_cast<double>(vals.size()) * k;
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, rows, k, cols, flops);
+    BasicMatrix<T> out(rows, k, BasicMatrix<T>::UNINITIALIZED);
+    const T* B = dense.data();
+    const int ldb = dense.stride();
+    T* C = out.data();
+    const int ldc = out.stride();
+    forRowChunks(rows, flops, policy, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            T* ci = C + static_cast<std::size_t>(i) * ldc;
+            std::fill(ci, ci + k, T());
+            const T* band = vals.data() + rowBase(i);
+            for (int j = firstCol(i); j < lastCol(i); ++j) {
+                vec_axpy(static_cast<std::size_t>(k), band[j], B + static_cast<std::size_t>(j) * ldb, ci);
+            }
+        }
+    });
+    return out;
+}
+
+template <class T>
+void BasicBandedMatrix<T>::multiply_vector(Span<const T> x, Span<T> y, ExecutionPolicy policy) const {
+    if (x.size() != static_cast<std::size_t>(cols) || y.size() != static_cast<std::size_t>(rows)) {
+        throw std::invalid_argument("BandedMatrix::multiply_vector - Los tamaños de los vectores no coinciden");
+    }
+    const double work = 2.0 * static_cast<double>(vals.size());
+    MATHLIB_PROFILE_SCOPE(PROFILE_STRUCTURED, rows, 1, cols, work);
+    const T* xs = x.data();
+    T* ys = y.data();
+    forRowChunks(rows, work, policy, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            const int j0 = firstCol(i);
+            ys[i] = vec_dot(static_cast<std::size_t>(lastCol(i) - j0), vals.data() + rowBase(i) + j0, xs + j0);
+        }
+    });
+}
+
+template class BasicSymmetricMatrix<float>;
+template class BasicSymmetricMatrix<double>;
+template class BasicSymmetricMatrix<int>;
+template class BasicSymmetricMatrix<std::complex<double> >;
+template class BasicTriangularMatrix<float>;
+template class BasicTriangularMatrix<double>;
+template class BasicTriangularMatrix<int>;
+template class BasicTriangularMatrix<std::complex<double> >;
+template class BasicBandedMatrix<float>;
+template class BasicBandedMatrix<double>;
+template class BasicBandedMatrix<int>;
+template class BasicBandedMatrix<std::complex<double> >;
+
+} // namespace mathlib
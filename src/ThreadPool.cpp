@@ -0,0 +1,284 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementación del grupo de hilos con robo de trabajo
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Cada cola está protegida por su propio mutex: el dueño toma tareas del
+ * final (LIFO, mejor localidad de caché) y los ladrones del principio
+ * (FIFO, tareas más antiguas y normalmente más grandes).
+ */
+
+#include "ThreadPool.h"
+#include "Tuning.h"
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace mathlib {
+
+/**
+ * @brief Cola de tareas de un hilo trabajador
+ */
+struct ThreadPool::Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+namespace {
+
+/// Grupo al que pertenece el hilo actual (NULL si no es un trabajador)
+thread_local ThreadPool* currentPool = NULL;
+
+/// Índice del hilo actual dentro de su grupo
+thread_local int currentIndex = -1;
+
+/**
+ * @brief Fija el hilo actual al procesador lógico cpu
+ */
+void pinCurrentThread(int cpu) {
+#if defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << (cpu % (8 * sizeof(DWORD_PTR))));
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+/**
+ * @brief Lee un entero de una variable de entorno
+ */
+int envInt(const char* name, int fallback) {
+    const char* value = std::getenv(name);
+    return value != NULL ? std::atoi(value) : fallback;
+}
+
+/**
+ * @brief Estado compartido por las iteraciones de un parallel_for
+ */
+struct ForState {
+    std::atomic<int> remaining;
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Grupo global, creado de forma perezosa
+ *
+ * globalSlot() es el propietario y solo se toca con globalMutex() tomado;
+ * globalPool() publica el mismo puntero para que global() lo lea sin
+ * cerrojo una vez creado.
+ */
+std::unique_ptr<ThreadPool>& globalSlot() {
+    static std::unique_ptr<ThreadPool> pool;
+    return pool;
+}
+
+std::atomic<ThreadPool*>& globalPool() {
+    static std::atomic<ThreadPool*> pool(nullptr);
+    return pool;
+}
+
+std::mutex& globalMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(int thread_count, bool pin_threads)
+    : pending(0), nextQueue(0), stopping(false), pinThreads(pin_threads) {
+    if (thread_count <= 0) {
+        thread_count = static_cast<int>(std::thread::hardware_concurrency());
+        if (thread_count <= 0) thread_count = 1;
+    }
+
+    for (int i = 0; i < thread_count; ++i) {
+        queues.push_back(new Queue());
+    }
+    for (int i = 0; i < thread_count; ++i) {
+        threads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    for (std::size_t i = 0; i < queues.size(); ++i) {
+        delete queues[i];
+    }
+}
+
+void ThreadPool::push(int queue, const Task& task) {
+    {
+        std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+        queues[queue]->tasks.push_back(task);
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        pending.fetch_add(1);
+    }
+    wake.notify_one();
+}
+
+void ThreadPool::submit(const Task& task) {
+    int queue;
+    if (currentPool == this) {
+        queue = currentIndex;
+    } else {
+        queue = static_cast<int>(nextQueue.fetch_add(1) % queues.size());
+    }
+    push(queue, task);
+}
+
+bool ThreadPool::tryRun(int self) {
+    Task task;
+    bool found = false;
+    int count = static_cast<int>(queues.size());
+
+    // Primero la cola propia, por el final
+    if (self >= 0) {
+        std::lock_guard<std::mutex> lock(queues[self]->mutex);
+        if (!queues[self]->tasks.empty()) {
+            task = queues[self]->tasks.back();
+            queues[self]->tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // Después robar del principio de las demás colas
+    int start = self >= 0 ? self + 1 : static_cast<int>(nextQueue.load() % count);
+    for (int offset = 0; !found && offset < count; ++offset) {
+        int victim = (start + offset) % count;
+        if (victim == self) continue;
+        std::lock_guard<std::mutex> lock(queues[victim]->mutex);
+        if (!queues[victim]->tasks.empty()) {
+            task = queues[victim]->tasks.front();
+            queues[victim]->tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+    pending.fetch_sub(1);
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(int index) {
+    currentPool = this;
+    currentIndex = index;
+    if (pinThreads) {
+        pinCurrentThread(index);
+    }
+
+    for (;;) {
+        if (tryRun(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this] { return stopping || pending.load() > 0; });
+        if (stopping && pending.load() == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallel_for(int count, const std::function<void(int)>& body) {
+    if (count <= 0) {
+        return;
+    }
+    if (count == 1) {
+        body(0);
+        return;
+    }
+
+    std::shared_ptr<ForState> state = std::make_shared<ForState>();
+    state->remaining.store(count);
+    const std::function<void(int)>* fn = &body;
+
+    int self = currentPool == this ? currentIndex : -1;
+    int first = self >= 0 ? self : static_cast<int>(nextQueue.fetch_add(1) % queues.size());
+    for (int i = 0; i < count; ++i) {
+        int queue = static_cast<int>((first + i) % queues.size());
+        push(queue, [state, fn, i] {
+            try {
+                (*fn)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (!state->error) state->error = std::current_exception();
+            }
+            if (state->remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->done.notify_all();
+            }
+        });
+    }
+
+    // El hilo llamante colabora hasta que no quedan iteraciones
+    while (state->remaining.load() > 0) {
+        if (tryRun(self)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait_for(lock, std::chrono::microseconds(200),
+                             [&state] { return state->remaining.load() == 0; });
+    }
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+bool ThreadPool::run_pending_task() {
+    return tryRun(currentPool == this ? currentIndex : -1);
+}
+
+ThreadPool& ThreadPool::global() {
+    ThreadPool* published = globalPool().load(std::memory_order_acquire);
+    if (published != nullptr) {
+        return *published;
+    }
+    // Antes del cerrojo: la primera consulta puede calibrar, y eso usa el grupo
+    const int tunedThreads = tuning().threads;
+    std::lock_guard<std::mutex> lock(globalMutex());
+    std::unique_ptr<ThreadPool>& pool = globalSlot();
+    if (!pool) {
+        pool.reset(new ThreadPool(envInt("MATHLIB_THREADS", tunedThreads), envInt("MATHLIB_PIN_THREADS", 0) != 0));
+        globalPool().store(pool.get(), std::memory_order_release);
+    }
+    return *pool;
+}
+
+void ThreadPool::configure_global(int thread_count, bool pin_threads) {
+    std::unique_ptr<ThreadPool> replacement(new ThreadPool(thread_count, pin_threads));
+    std::lock_guard<std::mutex> lock(globalMutex());
+    globalSlot().swap(replacement);
+    globalPool().store(globalSlot().get(), std::memory_order_release);
+    // replacement, ahora el grupo anterior, se destruye al salir
+}
+
+} // namespace mathlib
@@ -0,0 +1,125 @@
+/**
+ * @file Transpose.cpp
+ * @brief Implementación de la transposición por bloques recursivos
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ */
+
+#include "Transpose.h"
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+
+namespace mathlib {
+
+namespace {
+
+/**
+ * @brief Transpone una tesela de a lo sumo TRANSPOSE_TILE x TRANSPOSE_TILE
+ *
+ * Se recorre el destino por filas: las lecturas saltan entre filas del
+ * origen, pero la tesela completa del origen ya está en L1.
+ */
+template <class T>
+void transposeTile(int rows, int cols, const T* src, int lds, T* dst, int ldd) {
+    for (int j = 0; j < cols; ++j) {
+        T* out = dst + static_cast<std::size_t>(j) * ldd;
+        const T* in = src + j;
+        for (int i = 0; i < rows; ++i) {
+            out[i] = in[static_cast<std::size_t>(i) * lds];
+        }
+    }
+}
+
+template <class T>
+void transposeRecursive(int rows, int cols, const T* src, int lds, T* dst, int ldd) {
+    if (rows <= TRANSPOSE_TILE && cols <= TRANSPOSE_TILE) {
+        transposeTile(rows, cols, src, lds, dst, ldd);
+    } else if (rows >= cols) {
+        const int half = rows / 2;
+        transposeRecursive(half, cols, src, lds, dst, ldd);
+        transposeRecursive(rows - half, cols, src + static_cast<std::size_t>(half) * lds, lds,
+                           dst + half, ldd);
+    } else {
+        const int half = cols / 2;
+        transposeRecursive(rows, half, src, lds, dst, ldd);
+        transposeRecursive(rows, cols - half, src + half, lds,
+                           dst + static_cast<std::size_t>(half) * ldd, ldd);
+    }
+}
+
+/**
+ * @brief Intercambia el bloque a (rows x cols) con la transpuesta del bloque b (cols x rows)
+ */
+template <class T>
+void swapTransposed(int rows, int cols, T* a, T* b, int ld) {
+    if (rows <= TRANSPOSE_TILE && cols <= TRANSPOSE_TILE) {
+        for (int i = 0; i < rows; ++i) {
+            T* rowA = a + static_cast<std::size_t>(i) * ld;
+            T* colB = b + i;
+            for (int j = 0; j < cols; ++j) {
+                std::swap(rowA[j], colB[static_cast<std::size_t>(j) * ld]);
+            }
+        }
+    } else if (rows >= cols) {
+        const int half = rows / 2;
+        swapTransposed(half, cols, a, b, ld);
+        swapTransposed(rows - half, cols, a + static_cast<std::size_t>(half) * ld, b + half, ld);
+    } else {
+        const int half = cols / 2;
+        swapTransposed(rows, half, a, b, ld);
+        swapTransposed(rows, cols - half, a + half, b + static_cast<std::size_t>(half) * ld, ld);
+    }
+}
+
+template <class T>
+void transposeSquare(int n, T* a, int lda) {
+    if (n <= TRANSPOSE_TILE) {
+        for (int i = 0; i < n; ++i) {
+            T* row = a + static_cast<std::size_t>(i) * lda;
+            for (int j = i + 1; j < n; ++j) {
+                std::swap(row[j], a[static_cast<std::size_t>(j) * lda + i]);
+            }
+        }
+        return;
+    }
+    // [A11 A12; A21 A22]ᵀ = [A11ᵀ A21ᵀ; A12ᵀ A22ᵀ]
+    const int half = n / 2;
+    T* a12 = a + half;
+    T* a21 = a + static_cast<std::size_t>(half) * lda;
+    transposeSquare(half, a, lda);
+    transposeSquare(n - half, a21 + half, lda);
+    swapTransposed(half, n - half, a12, a21, lda);
+}
+
+} // namespace
+
+template <class T>
+void transpose(int rows, int cols, const T* src, int lds, T* dst, int ldd) {
+    if (rows <= 0 || cols <= 0) {
+        return;
+    }
+    transposeRecursive(rows, cols, src, lds, dst, ldd);
+}
+
+template <class T>
+void transpose_inplace(int n, T* a, int lda) {
+    if (n <= 1) {
+        return;
+    }
+    transposeSquare(n, a, lda);
+}
+
+#define MATHLIB_INSTANTIATE_TRANSPOSE(T)                                     \
+    template void transpose<T>(int, int, const T*, int, T*, int);            \
+    template void transpose_inplace<T>(int, T*, int);
+
+MATHLIB_INSTANTIATE_TRANSPOSE(float)
+MATHLIB_INSTANTIATE_TRANSPOSE(double)
+MATHLIB_INSTANTIATE_TRANSPOSE(int)
+MATHLIB_INSTANTIATE_TRANSPOSE(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_TRANSPOSE
+
+} // namespace mathlib
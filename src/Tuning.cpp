@@ -0,0 +1,767 @@
+/**
+ * @file Tuning.cpp
+ * @brief Carga, guardado y calibración de los parámetros de despacho
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los parámetros activos viven en una única ranura que se rellena la
+ * primera vez que se consultan. La calibración es una búsqueda por
+ * coordenadas: cada parámetro se ajusta por separado, con los ya
+ * elegidos fijos, y un candidato solo sustituye al actual si es al menos
+ * un 2 % más rápido, para que el ruido de medida no cambie los valores.
+ *
+ * Las medidas pasan los parámetros del candidato de forma explícita
+ * (GemmInternal.h) y reparten en grupos de hilos propios: nunca leen ni
+ * escriben la ranura ni tocan el grupo global, que otros hilos pueden
+ * estar usando mientras se calibra.
+ */
+
+#include "Tuning.h"
+#include "GemmInternal.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mathlib {
+
+namespace {
+
+/// Fracción del tiempo del candidato actual que otro debe mejorar para sustituirlo
+const double MIN_IMPROVEMENT = 0.98;
+
+/// Rondas de medida de cada candidato
+const int TUNE_ROUNDS = 3;
+
+/**
+ * @brief Parámetros activos, cargados de forma perezosa
+ *
+ * Cada valor publicado es una copia inmutable y current apunta a la
+ * última; tuning() solo hace una lectura atómica. Las versiones
+ * anteriores se conservan hasta el final del programa porque las
+ * operaciones en curso siguen usando la referencia que obtuvieron. Solo
+ * crecen con cada set_tuning(), que no se llama en bucles.
+ */
+struct TuningSlot {
+    std::atomic<const TuningParameters*> current;   ///< nullptr hasta la primera carga
+    std::vector<std::unique_ptr<TuningParameters> > versions;
+    std::mutex mutex;                                ///< Protege versions y la carga inicial
+
+    TuningSlot() : current(nullptr) {}
+};
+
+/// Publica una copia de params como parámetros activos (con slot.mutex tomado)
+void publish(TuningSlot& slot, const TuningParameters& params) {
+    slot.versions.push_back(std::unique_ptr<TuningParameters>(new TuningParameters(params)));
+    slot.current.store(slot.versions.back().get(), std::memory_order_release);
+}
+
+TuningSlot& tuningSlot() {
+    static TuningSlot slot;
+    return slot;
+}
+
+/// Comprueba los rangos de params; where identifica al llamante en el mensaje
+template <class Error>
+void validate(const TuningParameters& params, const char* where) {
+    const TuningBlocking* blocks[] = { &params.blocking_f64, &params.blocking_f32 };
+    for (int i = 0; i < 2; ++i) {
+        if (blocks[i]->mc < 0 || blocks[i]->kc < 0 || blocks[i]->nc < 0) {
+            throw Error(std::string(where) + " - Los tamaños de bloque no pueden ser negativos");
+        }
+    }
+    if (params.small_gemm_volume < 0 || params.parallel_gemm_volume < 0 ||
+        params.parallel_gemv_elements < 0 || params.threads < 0) {
+        throw Error(std::string(where) + " - Los umbrales y los hilos no pueden ser negativos");
+    }
+    if (params.tiles_per_thread < 1 || params.strassen_crossover < 1) {
+        throw Error(std::string(where) + " - tiles_per_thread y strassen_crossover deben ser >= 1");
+    }
+}
+
+/// Nombre del equipo, con los caracteres no válidos en un fichero sustituidos
+std::string hostName() {
+    std::string name;
+#if defined(_WIN32)
+    const char* computer = std::getenv("COMPUTERNAME");
+    if (computer != NULL) name = computer;
+#else
+    char buffer[256];
+    if (gethostname(buffer, sizeof(buffer)) == 0) {
+        buffer[sizeof(buffer) - 1] = '\0';
+        name = buffer;
+    }
+#endif
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        const char c = name[i];
+        if (!(std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.')) {
+            name[i] = '_';
+        }
+    }
+    return name.empty() ? "localhost" : name;
+}
+
+/// Crea el directorio de path y los que falten por encima
+void createParentDirectories(const std::string& path) {
+    for (std::size_t pos = path.find_first_of("/\\", 1); pos != std::string::npos;
+         pos = path.find_first_of("/\\", pos + 1)) {
+        const std::string dir = path.substr(0, pos);
+#if defined(_WIN32)
+        CreateDirectoryA(dir.c_str(), NULL);
+#else
+        mkdir(dir.c_str(), 0755);
+#endif
+    }
+}
+
+/// Texto sin espacios al principio ni al final
+std::string trim(const std::string& text) {
+    const std::size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+        return std::string();
+    }
+    const std::size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+/// Interpreta value como un número finito completo; lanza si no lo es
+double parseNumber(const std::string& value, const std::string& key, const std::string& path) {
+    const char* begin = value.c_str();
+    char* end = NULL;
+    errno = 0;
+    const double number = std::strtod(begin, &end);
+    if (end == begin || *end != '\0' || errno != 0 || !std::isfinite(number)) {
+        throw std::runtime_error("mathlib::load_tuning - Valor no válido para " + key + " en " + path);
+    }
+    return number;
+}
+
+/// Como parseNumber(), pero exige un entero representable en int antes de convertirlo
+int parseInteger(const std::string& value, const std::string& key, const std::string& path) {
+    const double number = parseNumber(value, key, path);
+    if (number != std::floor(number) ||
+        number < static_cast<double>(std::numeric_limits<int>::min()) ||
+        number > static_cast<double>(std::numeric_limits<int>::max())) {
+        throw std::runtime_error("mathlib::load_tuning - Se esperaba un entero para " + key + " en " + path);
+    }
+    return static_cast<int>(number);
+}
+
+/**
+ * @brief Lee path en params y deja en simd el nivel anotado (vacío si no lo hay)
+ *
+ * @return false si el fichero no existe
+ */
+bool readTuningFile(const std::string& path, TuningParameters& params, std::string& simd) {
+    std::ifstream in(path.c_str());
+    if (!in) {
+        return false;
+    }
+    TuningParameters result(params);
+    simd.clear();
+    std::string line;
+    while (std::getline(in, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        const std::size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            throw std::runtime_error("mathlib::load_tuning - Línea sin '=' en " + path + ": " + line);
+        }
+        const std::string key = trim(line.substr(0, eq));
+        const std::string value = trim(line.substr(eq + 1));
+        if (key == "simd") {
+            simd = value;
+            continue;
+        }
+        if (key == "f64.mc") result.blocking_f64.mc = parseInteger(value, key, path);
+        else if (key == "f64.kc") result.blocking_f64.kc = parseInteger(value, key, path);
+        else if (key == "f64.nc") result.blocking_f64.nc = parseInteger(value, key, path);
+        else if (key == "f32.mc") result.blocking_f32.mc = parseInteger(value, key, path);
+        else if (key == "f32.kc") result.blocking_f32.kc = parseInteger(value, key, path);
+        else if (key == "f32.nc") result.blocking_f32.nc = parseInteger(value, key, path);
+        else if (key == "small_gemm_volume") result.small_gemm_volume = parseNumber(value, key, path);
+        else if (key == "parallel_gemm_volume") result.parallel_gemm_volume = parseNumber(value, key, path);
+        else if (key == "tiles_per_thread") result.tiles_per_thread = parseInteger(value, key, path);
+        else if (key == "parallel_gemv_elements") result.parallel_gemv_elements = parseNumber(value, key, path);
+        else if (key == "strassen_crossover") result.strassen_crossover = parseInteger(value, key, path);
+        else if (key == "threads") result.threads = parseInteger(value, key, path);
+        else throw std::runtime_error("mathlib::load_tuning - Clave desconocida en " + path + ": " + key);
+    }
+    validate<std::runtime_error>(result, "mathlib::load_tuning");
+    params = result;
+    return true;
+}
+
+TuningParameters calibrate(const TuningParameters& start, std::ostream* log, const TuneOptions& options);
+
+/**
+ * @brief Rellena la ranura la primera vez, según MATHLIB_TUNING
+ *
+ * Todo ocurre con el cerrojo tomado, incluida la calibración automática,
+ * y current se publica al final: los demás hilos que consultan tuning()
+ * entretanto esperan en el cerrojo y no ven nunca parámetros a medio
+ * calcular. calibrate() no consulta tuning(), así que no hay reentrada.
+ * El grupo global no se toca; ThreadPool::global() consulta tuning()
+ * antes de crearse y toma entonces los hilos calibrados.
+ */
+void loadAtStartup(TuningSlot& slot) {
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    if (slot.current.load(std::memory_order_relaxed) != nullptr) {
+        return;
+    }
+    const char* mode = std::getenv("MATHLIB_TUNING");
+    const bool off = mode != NULL && std::strcmp(mode, "off") == 0;
+    const bool automatic = mode != NULL && std::strcmp(mode, "auto") == 0;
+    const std::string path = off ? std::string() : tuning_file_path();
+    TuningParameters active;
+    if (!path.empty()) {
+        TuningParameters params;
+        std::string simd;
+        bool usable = false;
+        try {
+            usable = readTuningFile(path, params, simd) &&
+                     (simd.empty() || simd == simd_level_name(simd_level()));
+        } catch (const std::exception&) {
+            // Un fichero dañado no impide arrancar: se usan los valores por defecto
+        }
+        if (usable) {
+            active = params;
+        } else if (automatic) {
+            params = calibrate(TuningParameters(), nullptr, TuneOptions());
+            try {
+                save_tuning(path, params);
+            } catch (const std::exception&) {
+                // Sin permiso de escritura se calibrará de nuevo en la próxima ejecución
+            }
+            active = params;
+        }
+    }
+    publish(slot, active);
+}
+
+/**
+ * @brief Segundos por llamada de f, el mínimo de varias rondas
+ *
+ * Cada ronda duplica las llamadas de la anterior hasta acumular
+ * min_time, de modo que los casos muy cortos no miden el reloj.
+ */
+double secondsPerCall(const std::function<void()>& f, double minTime) {
+    typedef std::chrono::steady_clock Clock;
+    f();
+    double best = 0.0;
+    double elapsed = 0.0;
+    for (long batch = 1; elapsed < minTime || best == 0.0; batch *= 2) {
+        const Clock::time_point t0 = Clock::now();
+        for (long i = 0; i < batch; ++i) {
+            f();
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+        elapsed += seconds;
+        const double perCall = seconds / batch;
+        if (best == 0.0 || perCall < best) {
+            best = perCall;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Operandos de prueba de n x n, con valores en [0, 1)
+ */
+template <class T>
+struct TuneOperands {
+    int n;
+    std::vector<T> a;
+    std::vector<T> b;
+    std::vector<T> c;
+
+    explicit TuneOperands(int size)
+        : n(size), a(static_cast<std::size_t>(size) * size), b(a.size()), c(a.size()) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<T>((i * 7919 % 1009) / 1009.0);
+            b[i] = static_cast<T>((i * 104729 % 1013) / 1013.0);
+        }
+    }
+};
+
+/**
+ * @brief Registro opcional de las medidas y de los valores elegidos
+ */
+class TuneLog {
+public:
+    explicit TuneLog(std::ostream* out) : out(out) {}
+
+    void measure(const std::string& what, double seconds) {
+        if (out != nullptr) {
+            *out << what << ": " << seconds * 1e3 << " ms\n";
+        }
+    }
+
+    void choose(const std::string& what, double value) {
+        if (out != nullptr) {
+            *out << "  -> " << what << " = " << value << "\n";
+        }
+    }
+
+private:
+    std::ostream* out;
+};
+
+/**
+ * @brief Grupos de hilos propios de la calibración, uno por tamaño
+ *
+ * Se crean en el primer uso y viven hasta el final de la calibración.
+ */
+class TunePools {
+public:
+    /// Empieza con los hilos que tendría el grupo global: MATHLIB_THREADS, threads o todos
+    explicit TunePools(int threads) : current(threads) {
+        const char* env = std::getenv("MATHLIB_THREADS");
+        if (env != NULL && std::atoi(env) > 0) {
+            current = std::atoi(env);
+        }
+        if (current <= 0) {
+            current = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+    }
+
+    /// Grupo de threads hilos (0: los actuales)
+    ThreadPool& get(int threads) {
+        std::unique_ptr<ThreadPool>& pool = pools[threads > 0 ? threads : current];
+        if (!pool) {
+            pool.reset(new ThreadPool(threads > 0 ? threads : current, false));
+        }
+        return *pool;
+    }
+
+    int current;  ///< Hilos de los candidatos que no fijan otro número
+
+private:
+    std::map<int, std::unique_ptr<ThreadPool> > pools;
+};
+
+/// Operación medida, con los parámetros del candidato y su grupo de hilos
+typedef std::function<void(const TuningParameters&, ThreadPool&)> TuneRun;
+
+/**
+ * @brief Configuración candidata: parámetros, hilos del grupo y operación medida
+ */
+struct Candidate {
+    std::string name;               ///< Descripción para el registro
+    TuningParameters params;        ///< Parámetros que recibe run
+    int threads;                    ///< Hilos del grupo que recibe run (0: TunePools::current)
+    TuneRun run;                    ///< Operación medida
+
+    Candidate(const std::string& name, const TuningParameters& params, const TuneRun& run,
+              int threads = 0)
+        : name(name), params(params), threads(threads), run(run) {}
+};
+
+/**
+ * @brief Segundos por llamada de cada candidato, el mínimo de TUNE_ROUNDS rondas
+ *
+ * Cada ronda mide todos los candidatos por turno, para que el
+ * calentamiento o un cambio de frecuencia no favorezca al primero.
+ */
+std::vector<double> measure(const std::vector<Candidate>& candidates, double minTime, TunePools& pools,
+                            TuneLog& log) {
+    std::vector<double> best(candidates.size(), 0.0);
+    for (int round = 0; round < TUNE_ROUNDS; ++round) {
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            const Candidate& c = candidates[i];
+            ThreadPool& pool = pools.get(c.threads);
+            const double seconds = secondsPerCall([&c, &pool] { c.run(c.params, pool); }, minTime);
+            if (round == 0 || seconds < best[i]) {
+                best[i] = seconds;
+            }
+        }
+    }
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        log.measure(candidates[i].name, best[i]);
+    }
+    return best;
+}
+
+/// Índice del candidato elegido: el primero salvo que otro mejore MIN_IMPROVEMENT
+std::size_t fastest(const std::vector<double>& times) {
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < times.size(); ++i) {
+        if (times[i] < times[best] * MIN_IMPROVEMENT) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+/// true si el segundo de dos candidatos gana al primero
+bool secondWins(const std::vector<Candidate>& pair, double minTime, TunePools& pools, TuneLog& log) {
+    return fastest(measure(pair, minTime, pools, log)) == 1;
+}
+
+/**
+ * @brief Elige para field el valor más rápido del producto de n x n
+ *
+ * El valor actual va primero, de modo que solo se cambia si otro lo
+ * mejora claramente.
+ */
+template <class T>
+void tuneBlockingField(TuningParameters& params, TuningBlocking TuningParameters::*blocking,
+                       int TuningBlocking::*field, const std::vector<int>& values,
+                       const std::string& name, TuneOperands<T>& ops, double minTime, TunePools& pools,
+                       TuneLog& log) {
+    const int n = ops.n;
+    const TuneRun run = [&ops, n](const TuningParameters& p, ThreadPool&) {
+        gemm(p, NO_TRANS, NO_TRANS, n, n, n, T(1), &ops.a[0], n, &ops.b[0], n, T(), &ops.c[0], n);
+    };
+    std::vector<Candidate> candidates;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        TuningParameters candidate(params);
+        (candidate.*blocking).*field = values[i];
+        std::ostringstream what;
+        what << name << " = " << values[i];
+        candidates.push_back(Candidate(what.str(), candidate, run));
+    }
+    const std::size_t best = fastest(measure(candidates, minTime, pools, log));
+    (params.*blocking).*field = values[best];
+    log.choose(name, values[best]);
+}
+
+/// value, su mitad y su doble, redondeados a múltiplos de step
+std::vector<int> aroundValue(int value, int step) {
+    std::vector<int> values;
+    values.push_back(value);
+    values.push_back(std::max(step, value / 2 / step * step));
+    values.push_back(value * 2);
+    return values;
+}
+
+/// Ajusta kc, mc y nc de T empezando por los bloques actuales
+template <class T>
+void tuneBlocking(TuningParameters& params, TuningBlocking TuningParameters::*blocking, const char* prefix,
+                  const TuneOptions& options, TunePools& pools, TuneLog& log) {
+    TuneOperands<T> ops(options.max_size);
+    const GemmBlocking current = gemm_blocking<T>(params);
+    const std::string p(prefix);
+    tuneBlockingField(params, blocking, &TuningBlocking::kc, aroundValue(current.kc, 8),
+                      p + ".kc", ops, options.min_time, pools, log);
+    tuneBlockingField(params, blocking, &TuningBlocking::mc, aroundValue(current.mc, current.mr),
+                      p + ".mc", ops, options.min_time, pools, log);
+    // nc solo influye si el panel no cubre ya todas las columnas
+    if (current.nc / 2 < options.max_size) {
+        tuneBlockingField(params, blocking, &TuningBlocking::nc, aroundValue(current.nc, current.nr),
+                          p + ".nc", ops, options.min_time, pools, log);
+    }
+}
+
+/// Menor tamaño en que el kernel por bloques supera al de referencia
+void tuneSmallGemm(TuningParameters& params, const TuneOptions& options, TunePools& pools, TuneLog& log) {
+    static const int sizes[] = { 8, 12, 16, 24, 32, 48, 64, 96 };
+    const std::size_t count = sizeof(sizes) / sizeof(sizes[0]);
+    TuneOperands<double> ops(sizes[count - 1]);
+    int crossover = 0;
+    for (std::size_t i = 0; i < count && crossover == 0; ++i) {
+        const int s = sizes[i];
+        std::ostringstream what;
+        what << "GEMM " << s;
+        std::vector<Candidate> pair;
+        pair.push_back(Candidate(what.str() + " referencia", params, [&ops, s](const TuningParameters&, ThreadPool&) {
+            gemm_reference(s, s, s, &ops.a[0], s, &ops.b[0], s, &ops.c[0], s);
+        }));
+        pair.push_back(Candidate(what.str() + " bloques", params, [&ops, s](const TuningParameters& p, ThreadPool&) {
+            gemm_blocked(p, s, s, s, &ops.a[0], s, &ops.b[0], s, &ops.c[0], s);
+        }));
+        if (secondWins(pair, options.min_time, pools, log)) {
+            crossover = s;
+        }
+    }
+    if (crossover == 0) {
+        crossover = sizes[count - 1] * 2;
+    }
+    params.small_gemm_volume = static_cast<double>(crossover) * crossover * crossover;
+    log.choose("small_gemm_volume", params.small_gemm_volume);
+}
+
+/**
+ * @brief Menor hoja con que un nivel de Strassen supera al producto clásico
+ *
+ * Solo se prueban hojas c con 2·c <= max_size; si ninguna gana, el corte
+ * no baja de max_size.
+ */
+void tuneStrassen(TuningParameters& params, const TuneOptions& options, TunePools& pools, TuneLog& log) {
+    int crossover = 0;
+    for (int c = 64; 2 * c <= options.max_size && crossover == 0; c *= 2) {
+        const int n = 2 * c;
+        TuneOperands<double> ops(n);
+        std::vector<double> workspace(gemm_strassen_workspace<double>(n, n, n, c));
+        std::ostringstream what;
+        what << "GEMM " << n;
+        std::vector<Candidate> pair;
+        pair.push_back(Candidate(what.str() + " clásico", params, [&ops, n](const TuningParameters& p, ThreadPool&) {
+            gemm(p, NO_TRANS, NO_TRANS, n, n, n, 1.0, &ops.a[0], n, &ops.b[0], n, 0.0, &ops.c[0], n);
+        }));
+        pair.push_back(Candidate(what.str() + " Strassen", params,
+                                 [&ops, &workspace, n, c](const TuningParameters& p, ThreadPool&) {
+            gemm_strassen(p, n, n, n, &ops.a[0], n, &ops.b[0], n, &ops.c[0], n, c, &workspace[0]);
+        }));
+        if (secondWins(pair, options.min_time, pools, log)) {
+            crossover = c;
+        }
+    }
+    if (crossover == 0) {
+        crossover = std::max(params.strassen_crossover, options.max_size);
+    }
+    params.strassen_crossover = crossover;
+    log.choose("strassen_crossover", crossover);
+}
+
+/// Tamaño del grupo global más rápido en el producto paralelo de max_size
+void tuneThreads(TuningParameters& params, const TuneOptions& options, TunePools& pools, TuneLog& log) {
+    const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware <= 1) {
+        return;
+    }
+    const int proposed[] = { hardware, hardware / 2, hardware > 4 ? hardware * 3 / 4 : hardware };
+    std::vector<int> counts;
+    for (std::size_t i = 0; i < sizeof(proposed) / sizeof(proposed[0]); ++i) {
+        const int count = std::max(1, proposed[i]);
+        if (std::find(counts.begin(), counts.end(), count) == counts.end()) {
+            counts.push_back(count);
+        }
+    }
+    TuneOperands<double> ops(options.max_size);
+    const int n = ops.n;
+    std::vector<Candidate> candidates;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        std::ostringstream what;
+        what << "hilos = " << counts[i];
+        candidates.push_back(Candidate(what.str(), params, [&ops, n](const TuningParameters& p, ThreadPool& pool) {
+            gemm_parallel(p, NO_TRANS, NO_TRANS, n, n, n, 1.0, &ops.a[0], n, &ops.b[0], n, 0.0, &ops.c[0], n, pool);
+        }, counts[i]));
+    }
+    const int best = counts[fastest(measure(candidates, options.min_time, pools, log))];
+    // Se guarda 0 si gana el equipo completo, para seguir a MATHLIB_THREADS y al hardware
+    params.threads = best == hardware ? 0 : best;
+    pools.current = best;
+    log.choose("threads", best);
+}
+
+/// Umbrales del reparto paralelo de GEMM y GEMV y teselas por hilo
+void tuneParallel(TuningParameters& params, const TuneOptions& options, TunePools& pools, TuneLog& log) {
+    if (pools.current <= 1) {
+        return;
+    }
+
+    // Menor tamaño en que repartir (con el umbral a 0) gana al cálculo en serie
+    static const int gemmSizes[] = { 32, 48, 64, 96, 128, 192, 256 };
+    const std::size_t gemmCount = sizeof(gemmSizes) / sizeof(gemmSizes[0]);
+    TuneOperands<double> ops(std::max(options.max_size, gemmSizes[gemmCount - 1]));
+    TuningParameters forced(params);
+    forced.parallel_gemm_volume = 0.0;
+    forced.parallel_gemv_elements = 0.0;
+    int gemmCrossover = 0;
+    for (std::size_t i = 0; i < gemmCount && gemmCrossover == 0; ++i) {
+        const int s = gemmSizes[i];
+        std::ostringstream what;
+        what << "GEMM " << s;
+        std::vector<Candidate> pair;
+        pair.push_back(Candidate(what.str() + " serie", params, [&ops, s](const TuningParameters& p, ThreadPool&) {
+            gemm(p, NO_TRANS, NO_TRANS, s, s, s, 1.0, &ops.a[0], s, &ops.b[0], s, 0.0, &ops.c[0], s);
+        }));
+        pair.push_back(Candidate(what.str() + " paralelo", forced, [&ops, s](const TuningParameters& p, ThreadPool& pool) {
+            gemm_parallel(p, NO_TRANS, NO_TRANS, s, s, s, 1.0, &ops.a[0], s, &ops.b[0], s, 0.0, &ops.c[0], s, pool);
+        }));
+        if (secondWins(pair, options.min_time, pools, log)) {
+            gemmCrossover = s;
+        }
+    }
+    if (gemmCrossover == 0) {
+        gemmCrossover = gemmSizes[gemmCount - 1] * 2;
+    }
+    params.parallel_gemm_volume = static_cast<double>(gemmCrossover) * gemmCrossover * gemmCrossover;
+    log.choose("parallel_gemm_volume", params.parallel_gemm_volume);
+
+    // GEMV: el mismo criterio con matrices cuadradas de s x s
+    int gemvCrossover = 0;
+    for (int s = 128; s <= ops.n && gemvCrossover == 0; s *= 2) {
+        std::ostringstream what;
+        what << "GEMV " << s;
+        std::vector<Candidate> pair;
+        pair.push_back(Candidate(what.str() + " serie", params, [&ops, s](const TuningParameters&, ThreadPool&) {
+            gemv(NO_TRANS, s, s, 1.0, &ops.a[0], s, &ops.b[0], 0.0, &ops.c[0]);
+        }));
+        pair.push_back(Candidate(what.str() + " paralelo", forced, [&ops, s](const TuningParameters& p, ThreadPool& pool) {
+            gemv_parallel(p, NO_TRANS, s, s, 1.0, &ops.a[0], s, &ops.b[0], 0.0, &ops.c[0], pool);
+        }));
+        if (secondWins(pair, options.min_time, pools, log)) {
+            gemvCrossover = s;
+        }
+    }
+    params.parallel_gemv_elements = gemvCrossover != 0
+        ? static_cast<double>(gemvCrossover) * gemvCrossover
+        : std::max(params.parallel_gemv_elements, 4.0 * ops.n * ops.n);
+    log.choose("parallel_gemv_elements", params.parallel_gemv_elements);
+
+    // Teselas por hilo en el producto paralelo de max_size
+    static const int tiles[] = { 4, 2, 8 };
+    const int n = options.max_size;
+    std::vector<Candidate> candidates;
+    std::vector<int> values;
+    for (std::size_t i = 0; i < sizeof(tiles) / sizeof(tiles[0]); ++i) {
+        const int value = i == 0 ? params.tiles_per_thread : tiles[i];
+        if (i > 0 && value == params.tiles_per_thread) {
+            continue;
+        }
+        TuningParameters candidate(params);
+        candidate.tiles_per_thread = value;
+        std::ostringstream what;
+        what << "tiles_per_thread = " << value;
+        candidates.push_back(Candidate(what.str(), candidate, [&ops, n](const TuningParameters& p, ThreadPool& pool) {
+            gemm_parallel(p, NO_TRANS, NO_TRANS, n, n, n, 1.0, &ops.a[0], n, &ops.b[0], n, 0.0, &ops.c[0], n, pool);
+        }));
+        values.push_back(value);
+    }
+    params.tiles_per_thread = values[fastest(measure(candidates, options.min_time, pools, log))];
+    log.choose("tiles_per_thread", params.tiles_per_thread);
+}
+
+/**
+ * @brief Calibra a partir de start sin consultar tuning() ni el grupo global
+ *
+ * @param log Si no es nullptr, recibe una línea por medida
+ */
+TuningParameters calibrate(const TuningParameters& start, std::ostream* log, const TuneOptions& options) {
+    TuningParameters params(start);
+    TuneLog tuneLog(log);
+    TunePools pools(start.threads);
+
+    tuneBlocking<double>(params, &TuningParameters::blocking_f64, "f64", options, pools, tuneLog);
+    tuneBlocking<float>(params, &TuningParameters::blocking_f32, "f32", options, pools, tuneLog);
+    tuneSmallGemm(params, options, pools, tuneLog);
+    tuneStrassen(params, options, pools, tuneLog);
+    if (options.tune_threads) {
+        tuneThreads(params, options, pools, tuneLog);
+    }
+    tuneParallel(params, options, pools, tuneLog);
+    return params;
+}
+
+} // namespace
+
+const TuningParameters& tuning() {
+    TuningSlot& slot = tuningSlot();
+    const TuningParameters* params = slot.current.load(std::memory_order_acquire);
+    if (params == nullptr) {
+        loadAtStartup(slot);
+        params = slot.current.load(std::memory_order_acquire);
+    }
+    return *params;
+}
+
+void set_tuning(const TuningParameters& params) {
+    validate<std::invalid_argument>(params, "mathlib::set_tuning");
+    tuning();   // Carga inicial fuera del cerrojo, que loadAtStartup() toma
+    TuningSlot& slot = tuningSlot();
+    int previousThreads;
+    {
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        previousThreads = slot.current.load(std::memory_order_relaxed)->threads;
+        publish(slot, params);
+    }
+    if (params.threads > 0 && params.threads != previousThreads) {
+        ThreadPool::configure_global(params.threads, false);
+    }
+}
+
+int default_strassen_crossover() {
+    return tuning().strassen_crossover;
+}
+
+std::string tuning_file_path() {
+    const char* explicitPath = std::getenv("MATHLIB_TUNING_FILE");
+    if (explicitPath != NULL && explicitPath[0] != '\0') {
+        return explicitPath;
+    }
+    std::string base;
+    const char* xdg = std::getenv("XDG_CONFIG_HOME");
+    const char* home = std::getenv("HOME");
+    const char* appData = std::getenv("APPDATA");
+    if (xdg != NULL && xdg[0] != '\0') {
+        base = xdg;
+    } else if (home != NULL && home[0] != '\0') {
+        base = std::string(home) + "/.config";
+    } else if (appData != NULL && appData[0] != '\0') {
+        base = appData;
+    } else {
+        return std::string();
+    }
+    return base + "/mathlib/tuning-" + hostName() + ".conf";
+}
+
+bool load_tuning(const std::string& path, TuningParameters& params) {
+    std::string simd;
+    return readTuningFile(path, params, simd);
+}
+
+void save_tuning(const std::string& path, const TuningParameters& params) {
+    validate<std::invalid_argument>(params, "mathlib::save_tuning");
+    createParentDirectories(path);
+    std::ofstream out(path.c_str());
+    if (!out) {
+        throw std::runtime_error("mathlib::save_tuning - No se puede escribir " + path);
+    }
+    out.precision(17);
+    out << "# Parámetros de MathLib calibrados en " << hostName() << " (mathlib_tune)\n"
+        << "simd = " << simd_level_name(simd_level()) << "\n"
+        << "f64.mc = " << params.blocking_f64.mc << "\n"
+        << "f64.kc = " << params.blocking_f64.kc << "\n"
+        << "f64.nc = " << params.blocking_f64.nc << "\n"
+        << "f32.mc = " << params.blocking_f32.mc << "\n"
+        << "f32.kc = " << params.blocking_f32.kc << "\n"
+        << "f32.nc = " << params.blocking_f32.nc << "\n"
+        << "small_gemm_volume = " << params.small_gemm_volume << "\n"
+        << "parallel_gemm_volume = " << params.parallel_gemm_volume << "\n"
+        << "tiles_per_thread = " << params.tiles_per_thread << "\n"
+        << "parallel_gemv_elements = " << params.parallel_gemv_elements << "\n"
+        << "strassen_crossover = " << params.strassen_crossover << "\n"
+        << "threads = " << params.threads << "\n";
+    out.close();
+    if (!out) {
+        throw std::runtime_error("mathlib::save_tuning - Error al escribir " + path);
+    }
+}
+
+TuningParameters autotune(std::ostream* log, const TuneOptions& options) {
+    if (options.max_size < 64 || options.min_time <= 0.0) {
+        throw std::invalid_argument("mathlib::autotune - max_size debe ser >= 64 y min_time positivo");
+    }
+    return calibrate(tuning(), log, options);
+}
+
+} // namespace mathlib
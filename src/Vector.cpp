@@ -0,0 +1,185 @@
+/**
+ * @file Vector.cpp
+ * @brief Implementación de BasicVector y del GEMV sobre matrices y vectores
+ * @version 1.0.0
+ * @author Jhon Wilson
+ * @date 2025
+ *
+ * Los elementos viven en una BasicMatrix de 1 x n, que aporta la reserva
+ * alineada con el asignador activo y la semántica de copia y movimiento.
+ */
+
+#include "Vector.h"
+#include "Kernels.h"
+#include "Profiling.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace mathlib {
+
+namespace {
+
+/// Cuadrado del módulo de un elemento
+template <class T>
+double squaredMagnitude(const T& value) {
+    double v = static_cast<double>(value);
+    return v * v;
+}
+
+double squaredMagnitude(const std::complex<double>& value) {
+    return std::norm(value);
+}
+
+/// Comprueba que dos vectores tengan el mismo tamaño
+template <class T>
+void requireSameSize(const BasicVector<T>& a, const BasicVector<T>& b, const char* where) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument(std::string(where) + " - Los vectores deben tener el mismo tamaño");
+    }
+}
+
+} // namespace
+
+template <class T>
+BasicVector<T>::BasicVector(int n) : storage(1, n) {}
+
+template <class T>
+BasicVector<T>::BasicVector(int n, typename BasicMatrix<T>::Uninitialized)
+    : storage(1, n, BasicMatrix<T>::UNINITIALIZED) {}
+
+template <class T>
+BasicVector<T>::BasicVector(Span<const T> values)
+    : storage(1, static_cast<int>(values.size()), BasicMatrix<T>::UNINITIALIZED) {
+    std::copy(values.begin(), values.end(), storage.data());
+}
+
+template <class T>
+BasicVector<T> BasicVector<T>::from_column(const BasicMatrix<T>& m, int c) {
+    if (c < 0 || c >= m.num_cols()) {
+        throw std::out_of_range("Vector::from_column - Columna fuera de rango");
+    }
+    BasicVector result(m.num_rows(), BasicMatrix<T>::UNINITIALIZED);
+    const T* src = m.data() + c;
+    for (int i = 0; i < m.num_rows(); ++i) {
+        result.data()[i] = src[static_cast<std::size_t>(i) * m.stride()];
+    }
+    return result;
+}
+
+template <class T>
+BasicMatrix<T> BasicVector<T>::to_column() const {
+    // Una matriz de n x 1 es contigua: basta copiar el bloque
+    BasicMatrix<T> column(size(), 1, BasicMatrix<T>::UNINITIALIZED);
+    std::copy(data(), data() + size(), column.data());
+    return column;
+}
+
+template <class T>
+T BasicVector<T>::get(int i) const {
+    if (i < 0 || i >= size()) {
+        throw std::out_of_range("Vector::get - Índice fuera de rango");
+    }
+    return data()[i];
+}
+
+template <class T>
+void BasicVector<T>::set(int i, T value) {
+    if (i < 0 || i >= size()) {
+        throw std::out_of_range("Vector::set - Índice fuera de rango");
+    }
+    data()[i] = value;
+}
+
+template <class T>
+BasicVector<T>& BasicVector<T>::fill(T value) {
+    std::fill(data(), data() + size(), value);
+    return *this;
+}
+
+template <class T>
+BasicVector<T> BasicVector<T>::add(const BasicVector& other) const {
+    requireSameSize(*this, other, "Vector::add");
+    BasicVector result(size(), BasicMatrix<T>::UNINITIALIZED);
+    vec_add(static_cast<std::size_t>(size()), data(), other.data(), result.data());
+    return result;
+}
+
+template <class T>
+BasicVector<T> BasicVector<T>::subtract(const BasicVector& other) const {
+    requireSameSize(*this, other, "Vector::subtract");
+    BasicVector result(size(), BasicMatrix<T>::UNINITIALIZED);
+    vec_sub(static_cast<std::size_t>(size()), data(), other.data(), result.data());
+    return result;
+}
+
+template <class T>
+BasicVector<T> BasicVector<T>::scale(T alpha) const {
+    BasicVector result(size(), BasicMatrix<T>::UNINITIALIZED);
+    vec_scale(static_cast<std::size_t>(size()), alpha, data(), result.data());
+    return result;
+}
+
+template <class T>
+BasicVector<T>& BasicVector<T>::axpy(T alpha, const BasicVector& x) {
+    requireSameSize(*this, x, "Vector::axpy");
+    vec_axpy(static_cast<std::size_t>(size()), alpha, x.data(), data());
+    return *this;
+}
+
+template <class T>
+T BasicVector<T>::dot(const BasicVector& other) const {
+    requireSameSize(*this, other, "Vector::dot");
+    return vec_dot(static_cast<std::size_t>(size()), data(), other.data());
+}
+
+template <class T>
+double BasicVector<T>::norm() const {
+    double sum = 0.0;
+    for (int i = 0; i < size(); ++i) {
+        sum += squaredMagnitude(data()[i]);
+    }
+    return std::sqrt(sum);
+}
+
+template <class T>
+void gemv(T alpha, const BasicMatrix<T>& A, const BasicVector<T>& x, T beta, BasicVector<T>& y,
+          Transpose trans, ExecutionPolicy policy) {
+    const int rows = A.num_rows();
+    const int cols = A.num_cols();
+    const int xSize = trans == NO_TRANS ? cols : rows;
+    const int ySize = trans == NO_TRANS ? rows : cols;
+    if (x.size() != xSize || y.size() != ySize) {
+        throw std::invalid_argument("mathlib::gemv - Dimensiones incompatibles");
+    }
+    // El kernel escribe y mientras lee x: si son el mismo vector se copia x
+    if (&x == &y) {
+        BasicVector<T> copy(x);
+        gemv(alpha, A, copy, beta, y, trans, policy);
+        return;
+    }
+
+    MATHLIB_PROFILE_SCOPE(PROFILE_GEMV, ySize, 1, xSize, 2.0 * rows * cols);
+    if (policy == PARALLEL) {
+        gemv_parallel(trans, rows, cols, alpha, A.data(), A.stride(), x.data(), beta, y.data(),
+                      ThreadPool::global());
+    } else {
+        gemv(trans, rows, cols, alpha, A.data(), A.stride(), x.data(), beta, y.data());
+    }
+}
+
+#define MATHLIB_INSTANTIATE_VECTOR(T)                                                   \
+    template class BasicVector<T>;                                                      \
+    template void gemv<T>(T, const BasicMatrix<T>&, const BasicVector<T>&, T,           \
+                          BasicVector<T>&, Transpose, ExecutionPolicy);
+
+MATHLIB_INSTANTIATE_VECTOR(float)
+MATHLIB_INSTANTIATE_VECTOR(double)
+MATHLIB_INSTANTIATE_VECTOR(int)
+MATHLIB_INSTANTIATE_VECTOR(std::complex<double>)
+
+#undef MATHLIB_INSTANTIATE_VECTOR
+
+} // namespace mathlib
@@ -1,5 +1,61 @@
 #include "Matrix.h"
+#include "FixedMatrix.h"
+#include "Batched.h"
+#include "MatrixFile.h"
+#include "SparseMatrix.h"
+#include "Structured.h"
+#include "Vector.h"
+#include "OutOfCore.h"
+#include "Factorization.h"
+#include "Profiling.h"
+#include "MatrixText.h"
+#include "Async.h"
+#include "Device.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include "Tuning.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <new>
+static std::atomic<long> reservas(0);
+void* operator new(std::size_t bytes) {
+ ++reservas;
+ if (void* p = std::malloc(bytes ? bytes : 1)) return p;
+ throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+template <class T>
+static bool gemmCorrecto(int m, int n, int k, mathlib::ThreadPool& grupo) {
+ const mathlib::Transpose ops[] = {mathlib::NO_TRANS, mathlib::TRANS};
+ for (int ta = 0; ta < 2; ++ta) for (int tb = 0; tb < 2; ++tb) for (int par = 0; par < 2; ++par) {
+  const int lda = (ta ? m : k) + 3, ldb = (tb ? k : n) + 5, ldc = n + 1;
+  std::vector<T> A((ta ? k : m) * lda), B((tb ? n : k) * ldb), C0(m * ldc), R(m * ldc), C(m * ldc), bias(n);
+  for (size_t i = 0; i < A.size(); ++i) A[i] = T(int(i * 37 % 23) - 11) / T(8);
+  for (size_t i = 0; i < B.size(); ++i) B[i] = T(int(i * 29 % 19) - 9) / T(8);
+  for (size_t i = 0; i < C0.size(); ++i) C0[i] = T(int(i * 13 % 7) - 3);
+  for (int j = 0; j < n; ++j) bias[j] = T(j % 5 - 2) / T(4);
+  mathlib::gemm_reference(ops[ta], ops[tb], m, n, k, &A[0], lda, &B[0], ldb, &R[0], ldc);
+  if (par) mathlib::gemm_parallel(ops[ta], ops[tb], m, n, k, &A[0], lda, &B[0], ldb, &C[0], ldc, grupo);
+  else mathlib::gemm(ops[ta], ops[tb], m, n, k, &A[0], lda, &B[0], ldb, &C[0], ldc);
+  for (int i = 0; i < m; ++i) for (int j = 0; j < n; ++j)
+   if (std::fabs(C[i * ldc + j] - R[i * ldc + j]) > T(1e-4) * (T(1) + std::fabs(R[i * ldc + j]))) return false;
+  mathlib::GemmEpilogue<T> ep; ep.bias = &bias[0]; ep.activation = mathlib::ACTIVATION_RELU;
+  C = C0;
+  if (par) mathlib::gemm_parallel(ops[ta], ops[tb], m, n, k, T(0.5), &A[0], lda, &B[0], ldb, T(-2), &C[0], ldc, grupo, ep);
+  else mathlib::gemm(ops[ta], ops[tb], m, n, k, T(0.5), &A[0], lda, &B[0], ldb, T(-2), &C[0], ldc, ep);
+  for (int i = 0; i < m; ++i) for (int j = 0; j < n; ++j) {
+   T r = T(0.5) * R[i * ldc + j] - T(2) * C0[i * ldc + j] + bias[j];
+   if (r < T(0)) r = T(0);
+   if (std::fabs(C[i * ldc + j] - r) > T(1e-4) * (T(1) + std::fabs(r))) return false;
+  }
+ }
+ return true;
+}
 int main() {
  Matrix A(2,2), B(2,2);
  A.set(0,0,1); A.set(0,1,2); A.set(1,0,3); A.set(1,1,4);
@@ -8,5 +64,138 @@ int main() {
  Matrix D = A.multiply(B);
  std::cout << "Suma:\n"; C.print();
  std::cout << "Multiplicación:\n"; D.print();
+ Matrix E(2,2,Matrix::UNINITIALIZED);
+ A.multiply_into(B,E); E += C;
+ std::cout << "Multiplicación acumulada (A*B + A+B):\n"; E.print();
+ Matrix P(67,131), Q(131,45), Pq(67,45,Matrix::UNINITIALIZED); P.fill(0.5); Q.fill(2.0);
+ P.multiply_into(Q, Pq);
+ const long antes = reservas.load();
+ for (int it = 0; it < 10; ++it) P.multiply_into(Q, Pq);
+ std::cout << "Reservas en 10 multiply_into de 67x131x45: " << reservas.load() - antes << "\n";
+ if (reservas.load() != antes || Pq(66,44) != 131.0) return 1;
+ {
+  mathlib::TuningParameters reparto = mathlib::tuning(), previos = reparto;
+  reparto.parallel_gemm_volume = 0.0; reparto.threads = 0; mathlib::set_tuning(reparto);
+  mathlib::ThreadPool grupo(3);
+  const mathlib::SimdLevel nivelActivo = mathlib::simd_level();
+  const mathlib::SimdLevel niveles[] = {mathlib::SIMD_SCALAR, mathlib::SIMD_SSE2, mathlib::SIMD_AVX2, mathlib::SIMD_AVX512, mathlib::SIMD_NEON};
+  for (int l = 0; l < 5; ++l) {
+   if (!mathlib::set_simd_level(niveles[l])) continue;
+   const bool correcto = gemmCorrecto<double>(67, 45, 131, grupo) && gemmCorrecto<float>(67, 45, 131, grupo)
+                      && gemmCorrecto<double>(33, 1, 70, grupo) && gemmCorrecto<double>(1, 29, 17, grupo);
+   std::cout << "GEMM 67x131x45 frente a gemm_reference (" << mathlib::simd_level_name(niveles[l]) << "): " << correcto << "\n";
+   if (!correcto) return 1;
+  }
+  mathlib::set_simd_level(nivelActivo);
+  previos.threads = 0; mathlib::set_tuning(previos);
+ }
+ Matrix F = A + B - 2.0*C;
+ std::cout << "Expresión fusionada (A + B - 2C):\n"; F.print();
+ Matrix3 R = {0,-1,0, 1,0,0, 0,0,1};
+ FixedMatrix<3,1> p = {1,2,3};
+ std::cout << "Rotación fija 3x3 (R*p):\n"; R.multiply(p).print();
+ FixedMatrix<32,32> I32 = FixedMatrix<32,32>::identity();
+ std::cout << "Fija 32x32 (2I)(31,31): " << I32.add(I32)(31,31) << "\n";
+ Matrix G(2,2); G.fill(1.0);
+ for (int i = 0; i < 2; ++i) G(i,i) = 0.0;
+ mathlib::Span<double> fila = G.row(1); fila[0] = 5.0;
+ std::cout << "Relleno y acceso directo:\n"; G.print();
+ const double datosB[] = {5,6, 7,8};
+ Matrix Bb(2,2); Bb.assign(datosB);
+ std::cout << "Copia en bloque (assign) de los elementos de B:\n"; Bb.print();
+ double externo[] = {1,0, 0,1, 9,9};
+ mathlib::ConstMatrixView I(externo, 2, 2);
+ Matrix H(3,3);
+ mathlib::multiply(I, D, H.block(1,1,2,2));
+ std::cout << "Producto sobre vistas (bloque inferior derecho = I*D):\n"; H.print();
+ mathlib::save_matrix("test_matrix.mlm", D);
+ {
+  mathlib::MappedMatrixFile archivo("test_matrix.mlm");
+  Matrix L(archivo.view<double>());
+  std::cout << "Leída desde archivo mapeado:\n"; L.print();
+ }
+ mathlib::save_matrix("test_b.mlm", B);
+ mathlib::OutOfCoreOptions opciones; opciones.memory_budget = 7 * sizeof(double);
+ mathlib::multiply_out_of_core("test_matrix.mlm", "test_b.mlm", "test_c.mlm", opciones);
+ std::cout << "Producto fuera de memoria (A*B)*B, teselas 1x1:\n"; mathlib::load_matrix<double>("test_c.mlm").print();
+ bool rechazada = false;
+ try { mathlib::multiply_out_of_core("test_matrix.mlm", "test_b.mlm", "./test_b.mlm", opciones); } catch (const std::invalid_argument&) { rechazada = true; }
+ std::cout << "Salida igual a un operando rechazada: " << rechazada << ", B intacta: " << (mathlib::load_matrix<double>("test_b.mlm").get(1,1) == 8) << "\n";
+ mathlib::create_matrix_file("test_vacia.mlm", 0, 3, mathlib::DTYPE_FLOAT64);
+ bool vaciaRechazada = false;
+ try { mathlib::load_matrix<double>("test_vacia.mlm"); } catch (const std::runtime_error&) { vaciaRechazada = true; }
+ std::cout << "Archivo vacío " << mathlib::read_matrix_info("test_vacia.mlm").rows << "x" << mathlib::read_matrix_info("test_vacia.mlm").cols << ", carga rechazada: " << vaciaRechazada << "\n";
+ const char* ajustesMalos[] = {"threads = 1e300\n", "tiles_per_thread = nan\n", "f64.mc = 2.5\n", "small_gemm_volume = inf\n"};
+ for (int i = 0; i < 4; ++i) {
+  { std::ofstream ajustes("test_tuning.conf"); ajustes << ajustesMalos[i]; }
+  mathlib::TuningParameters leidos; bool ajusteRechazado = false;
+  try { mathlib::load_tuning("test_tuning.conf", leidos); } catch (const std::runtime_error&) { ajusteRechazado = true; }
+  if (!ajusteRechazado) return 1;
+ }
+ std::remove("test_tuning.conf");
+ {
+  // Cabeceras manipuladas: datos a 68 bytes (no múltiplo de 8) y alineación 12
+  std::ifstream original("test_b.mlm", std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+  const unsigned desalineadas[][2] = {{4, 68}, {12, 72}};
+  for (int i = 0; i < 2; ++i) {
+   std::vector<char> copia(bytes); copia.resize(desalineadas[i][1] + 32, 0);
+   for (int b = 0; b < 4; ++b) copia[16 + b] = char((desalineadas[i][0] >> (8 * b)) & 0xff);
+   for (int b = 0; b < 8; ++b) copia[40 + b] = char(b < 4 ? (desalineadas[i][1] >> (8 * b)) & 0xff : 0);
+   { std::ofstream manipulado("test_desalineado.mlm", std::ios::binary); manipulado.write(&copia[0], copia.size()); }
+   bool desalineadoRechazado = false;
+   try { mathlib::load_matrix<double>("test_desalineado.mlm"); } catch (const std::runtime_error&) { desalineadoRechazado = true; }
+   if (!desalineadoRechazado) return 1;
+  }
+  std::remove("test_desalineado.mlm");
+ }
+ std::remove("test_matrix.mlm"); std::remove("test_b.mlm"); std::remove("test_c.mlm"); std::remove("test_vacia.mlm");
+ std::vector<Matrix> lotesA(3, A), lotesB(3, B), lotesC;
+ lotesA[1] = C; lotesA[2] = D;
+ mathlib::multiply_batched(lotesA, lotesB, lotesC);
+ std::cout << "Producto por lotes ((A+B)*B):\n"; lotesC[1].print();
+ mathlib::MultiplyOptions rapido;
+ rapido.algorithm = mathlib::MULTIPLY_STRASSEN; rapido.strassen_crossover = 1;
+ std::cout << "Multiplicación Strassen-Winograd:\n"; A.multiply(B, rapido).print();
+ {
+  Matrix S(128,128), St(128,128,Matrix::UNINITIALIZED); S.fill(0.25);
+  std::vector<double> trabajo(mathlib::gemm_strassen_workspace<double>(128, 128, 128, 32));
+  mathlib::gemm_strassen(128, 128, 128, S.data(), 128, S.data(), 128, St.data(), 128, 32, &trabajo[0]);
+  const long antesS = reservas.load();
+  for (int it = 0; it < 3; ++it) mathlib::gemm_strassen(128, 128, 128, S.data(), 128, S.data(), 128, St.data(), 128, 32, &trabajo[0]);
+  std::cout << "Reservas en 3 Strassen de 128 (49 hojas): " << reservas.load() - antesS << "\n";
+  if (reservas.load() != antesS || St(127,127) != 8.0) return 1;
+ }
+ mathlib::SparseMatrix Gs = mathlib::SparseMatrix::from_dense(G);
+ std::cout << "Dispersa (" << Gs.nnz() << " no nulos) por A:\n"; Gs.multiply(A).print();
+ mathlib::SymmetricMatrix As = mathlib::SymmetricMatrix::from_dense(A);
+ std::cout << "Simétrica (triángulo inferior de A) por B:\n"; As.multiply(B).print();
+ mathlib::BandedMatrix Ab = mathlib::BandedMatrix::from_dense(A, 0, 1);
+ std::cout << "Banda superior de A por B:\n"; Ab.multiply(B).print();
+ mathlib::Vector x = mathlib::Vector::from_column(B, 0), y = A.multiply(x);
+ mathlib::gemv(2.0, A, x, 1.0, y, mathlib::TRANS);
+ std::cout << "A*x + 2*Aᵀ*x con x = primera columna de B: " << y[0] << " " << y[1] << "\n";
+ Matrix Cf = A; mathlib::GemmEpilogue<double> sesgo; double b[] = {-50.0, 1.0}; sesgo.bias = b; sesgo.activation = mathlib::ACTIVATION_RELU;
+ std::cout << "relu(A*B + A + [-50 1]) fusionado:\n"; Cf.gemm(1.0, A, B, 1.0, mathlib::MultiplyOptions(), sesgo).print();
+ mathlib::LUFactorization lu(A);
+ std::cout << "Solución de A*X = B con LU (det = " << lu.determinant() << "):\n"; lu.solve(B).print();
+ mathlib::MultiplyOptions abt; abt.trans_b = mathlib::TRANS;
+ std::cout << "Producto A*Bᵀ sin transponer B:\n"; A.multiply(B, abt).print();
+ std::cout << "Transpuesta de A:\n"; A.transpose().print();
+ BasicMatrix<float> Af = A.cast<float>(), Bf = B.cast<float>();
+ std::cout << "Multiplicación en float:\n"; Af.multiply(Bf).print();
+ const char csv[] = "1.5, -2\r\n3e2,0.25\n";
+ std::cout << "Leída desde CSV:\n"; mathlib::parse_text<double>(csv, sizeof(csv) - 1).print();
+ mathlib::MatrixFuture<double> fa(A), fb(B);
+ mathlib::MatrixFuture<double> suma = mathlib::async_add(mathlib::async_multiply(fa, fb), mathlib::async_multiply(fb, fa));
+ std::cout << "Asíncrono A*B + B*A:\n"; suma.get().print();
+ mathlib::DeviceMatrix<double> da(A), db(B);
+ std::cout << "DeviceMatrix (" << mathlib::device_backend() << ") A*B + A:\n"; da.multiply(db).add(da).host().print();
+ Matrix Ac = A; bool compartida = Ac.is_shared(); Ac.set(0, 0, 0.0);
+ std::cout << "Copia compartida hasta escribir: " << compartida << " " << Ac.is_shared() << " " << A.get(0, 0) << "\n";
+ Matrix Au = A; Au.make_unique(); Au(0, 0) = -1.0;
+ if (Au.is_shared() || A.get(0, 0) == -1.0) return 1;
+ mathlib::ProfileSnapshot perfil = mathlib::profile_snapshot();
+ if (perfil.enabled) std::cout << "Productos registrados: " << perfil.operations[mathlib::PROFILE_MULTIPLY].calls << "\n";
  return 0;
 }